@@ -103,6 +103,13 @@ class Controller {
         
         
         //  2. methods
+        void __loadBoundResources(
+            ElectricalLoad*,
+            std::vector<Renewable*>*,
+            std::vector<Noncombustion*>*,
+            Resources*
+        );
+        
         void __computeRenewableProduction(
             ElectricalLoad*,
             std::vector<Renewable*>*,
@@ -111,7 +118,19 @@ class Controller {
         
         void __constructCombustionMap(std::vector<Combustion*>*);
         
-        double __getRenewableProduction(int, double, Renewable*, Resources*);
+        void __getRenewableProductionSeries(
+            int,
+            Renewable*,
+            Resources*,
+            std::vector<double>*
+        );
+        
+        void __getRenewableNormalizedProductionSeries(
+            int,
+            Renewable*,
+            Resources*,
+            std::vector<double>*
+        );
         
         // **** DEPRECATED ****
         /*
@@ -215,11 +234,19 @@ class Controller {
         void setFirmDispatchRatio(double);
         void setLoadReserveRatio(double);
         
+        void getBoundResourceKeys(
+            std::vector<Renewable*>*,
+            std::vector<Noncombustion*>*,
+            std::vector<int>*,
+            std::vector<int>*
+        );
+        
         void init(
             ElectricalLoad*,
             std::vector<Renewable*>*,
             Resources*,
-            std::vector<Combustion*>*
+            std::vector<Combustion*>*,
+            std::vector<Noncombustion*>* = nullptr
         );
         
         void applyDispatchControl(
@@ -0,0 +1,213 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file DataCache.h
+///
+/// \brief Header file for the DataCache class.
+///
+
+
+#ifndef DATACACHE_H
+#define DATACACHE_H
+
+
+// std and third-party
+#include "std_includes.h"
+
+// interpolation
+#include "Interpolator.h"
+
+
+///
+/// \struct NormalizedSeriesData
+///
+/// \brief A struct which holds a parsed (but unchecked) normalized production time
+///     series, as read from disk.
+///
+
+struct NormalizedSeriesData {
+    std::vector<double> time_vec_hrs = {}; ///< A vector of time points [hrs] as read.
+    std::vector<double> normalized_vec = {}; ///< A vector of normalized production values [ ] as read.
+};
+
+
+///
+/// \struct SolarEphemerisData
+///
+/// \brief A struct which holds a site-level solar ephemeris (i.e., the position of the
+///     sun at every point of a modelling time series), stored column-wise.
+///
+
+struct SolarEphemerisData {
+    std::vector<double> time_vec_hrs = {}; ///< A vector of the time points [hrs] for which the ephemeris was computed.
+    std::vector<double> solar_zenith_vec_rad = {}; ///< A vector of the solar zenith [rad] at each time point.
+    std::vector<double> solar_azimuth_vec_rad = {}; ///< A vector of the solar azimuth [rad] at each time point.
+    
+    std::vector<double> cos_zenith_vec = {}; ///< A vector of the cosine of the solar zenith at each time point.
+    std::vector<double> sin_zenith_vec = {}; ///< A vector of the sine of the solar zenith at each time point.
+    std::vector<double> cos_azimuth_vec = {}; ///< A vector of the cosine of the solar azimuth at each time point.
+    std::vector<double> sin_azimuth_vec = {}; ///< A vector of the sine of the solar azimuth at each time point.
+};
+
+
+///
+/// \struct SeaStateMemoData
+///
+/// \brief A struct which holds a quantized memo of normalized production over sea
+///     states (i.e., significant wave height and energy period), stored as a direct
+///     indexed grid at the resolution of the resource data. Unlike the other cached
+///     data, this is filled lazily (and concurrently) by every asset which shares it,
+///     hence its elements are atomic. Unfilled elements hold NaN.
+///
+
+struct SeaStateMemoData {
+    double resolution_x = 0; ///< The resolution (grid spacing) of the first query value (significant wave height [m]).
+    double resolution_y = 0; ///< The resolution (grid spacing) of the second query value (energy period [s]).
+    
+    double inv_resolution_x = 0; ///< The reciprocal of resolution_x.
+    double inv_resolution_y = 0; ///< The reciprocal of resolution_y.
+    
+    int min_idx_x = 0; ///< The grid index (i.e., multiple of resolution_x) of the first column of the memo.
+    int min_idx_y = 0; ///< The grid index (i.e., multiple of resolution_y) of the first row of the memo.
+    
+    int n_x = 0; ///< The number of columns in the memo.
+    int n_y = 0; ///< The number of rows in the memo.
+    
+    std::vector<std::atomic<double>> value_vec; ///< A (contiguous, row-major) grid of memoized values, such that element (i, j) is value_vec[i * n_x + j].
+};
+
+
+///
+/// \struct DataCacheStamp
+///
+/// \brief A struct which records the on-disk state of a cached file, so that stale
+///     entries can be detected.
+///
+
+struct DataCacheStamp {
+    std::filesystem::file_time_type last_write_time; ///< The last write time of the file when it was read.
+    std::uintmax_t file_size = 0; ///< The size [bytes] of the file when it was read.
+};
+
+
+///
+/// \class DataCache
+///
+/// \brief A process-wide, path-keyed cache of parsed normalized production series and
+///     interpolation tables. Entries are held by reference counted pointer, and are
+///     invalidated (re-read) whenever the last write time or size of the underlying
+///     file changes. Intended to allow asset construction (and hence Model::reset()
+///     cycles in an optimizer) to reuse already parsed data rather than re-read it
+///     from disk (either copying it, or, for read only tables, borrowing it; see
+///     Interpolator::borrowData1D()). Also holds interpolation tables and solar ephemerides derived from
+///     asset parameters (keyed by those parameters, and never stale), so that they are
+///     computed once per distinct parameter set, as well as sea state memos which are
+///     shared (and filled) by every wave asset using the same performance matrix.
+///
+
+class DataCache {
+    private:
+        //  1. attributes
+        static std::mutex cache_mutex; ///< A mutex guarding all cache maps and counters.
+        
+        static std::map<std::string, DataCacheStamp> stamp_map; ///< A map <key, DataCacheStamp> of the on-disk state of every cached file.
+        
+        static std::map<std::string, std::shared_ptr<const NormalizedSeriesData>> normalized_series_map; ///< A map <key, pointer> of cached normalized production series.
+        static std::map<std::string, std::shared_ptr<const InterpolatorStruct1D>> interp_map_1D; ///< A map <key, pointer> of cached 1D interpolation tables.
+        static std::map<std::string, std::shared_ptr<const InterpolatorStruct2D>> interp_map_2D; ///< A map <key, pointer> of cached 2D interpolation tables.
+        static std::map<std::string, std::shared_ptr<const SolarEphemerisData>> solar_ephemeris_map; ///< A map <key, pointer> of cached (derived) solar ephemerides (one per site, over the most recently requested time series).
+        static std::map<std::string, std::shared_ptr<SeaStateMemoData>> sea_state_memo_map; ///< A map <key, pointer> of cached (derived, lazily filled) sea state memos.
+        
+        
+        //  2. methods
+        static std::string __getKey(std::string, std::string);
+        static bool __getStamp(std::string, DataCacheStamp*);
+        static bool __isCurrent(std::string, const DataCacheStamp&);
+        
+        
+    public:
+        //  1. attributes
+        static bool enabled; ///< A boolean which indicates whether the cache is in use (if false, every request is read from disk and nothing is stored).
+        
+        static int n_disk_reads; ///< The number of requests served by reading from disk (since last clear).
+        static int n_cache_hits; ///< The number of requests served from the cache (since last clear).
+        static int n_derived_builds; ///< The number of requests served by building derived data (since last clear).
+        
+        
+        //  2. methods
+        static std::shared_ptr<const NormalizedSeriesData> getNormalizedSeries(
+            std::string,
+            std::function<NormalizedSeriesData(void)>
+        );
+        
+        static std::shared_ptr<const InterpolatorStruct1D> getInterpolatorData1D(
+            std::string,
+            std::function<InterpolatorStruct1D(void)>
+        );
+        
+        static std::shared_ptr<const InterpolatorStruct2D> getInterpolatorData2D(
+            std::string,
+            std::function<InterpolatorStruct2D(void)>
+        );
+        
+        static std::shared_ptr<const InterpolatorStruct1D> getDerivedData1D(
+            std::string,
+            std::function<InterpolatorStruct1D(void)>
+        );
+        
+        static std::shared_ptr<const SolarEphemerisData> getSolarEphemeris(
+            std::string,
+            const std::vector<double>*,
+            std::function<SolarEphemerisData(void)>
+        );
+        
+        static std::shared_ptr<SeaStateMemoData> getSeaStateMemo(
+            std::string,
+            std::function<SeaStateMemoData(void)>
+        );
+        
+        static int getNumEntries(void);
+        
+        static void prune(void);
+        static void clear(void);
+        
+};  /* DataCache */
+
+
+#endif  /* DATACACHE_H */
@@ -59,11 +59,30 @@
 ///
 
 class ElectricalLoad {
+    private:
+        //  1. attributes
+        std::shared_ptr<io::CSVReader<2>> stream_reader_ptr; ///< A pointer to the open CSV reader (streaming only).
+        
+        bool has_lookahead; ///< A boolean which indicates whether a lookahead row has been read (streaming only).
+        double lookahead_time_hrs; ///< The time [hrs] of the lookahead row (streaming only).
+        double lookahead_load_kW; ///< The load [kW] of the lookahead row (streaming only).
+        double last_dt_hrs; ///< The last time delta [hrs] of the previous window (streaming only).
+        
+        
+        //  2. methods
+        //...
+        
+        
     public:
         //  1. attributes
-        int n_points; ///< The number of points in the modelling time series.
+        bool is_streaming; ///< A boolean which indicates whether the time series is being streamed in windows (see openLoadStream()).
+        
+        int n_points; ///< The number of points in the modelling time series (if streaming, the number of points in the current window).
+        int n_points_total; ///< The number of points in the full modelling time series.
+        int window_points; ///< The (maximum) number of points per window (if streaming, otherwise equal to n_points).
+        int window_start; ///< The index, in the full modelling time series, of the first point in the current window.
         
-        double n_years; ///< The number of years being modelled (inferred from time_vec_hrs).
+        double n_years; ///< The number of years being modelled (inferred from time_vec_hrs, or from the full time series if streaming).
         
         double min_load_kW; ///< The minimum [kW] of the given electrical load time series.
         double mean_load_kW; ///< The mean, or average, [kW] of the given electrical load time series.
@@ -82,6 +101,11 @@ class ElectricalLoad {
         ElectricalLoad(std::string);
         
         void readLoadData(std::string);
+        
+        void openLoadStream(std::string, int);
+        void rewindLoadStream(void);
+        bool readLoadWindow(void);
+        
         void clear(void);
         
         ~ElectricalLoad(void);
@@ -0,0 +1,92 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+///
+/// \file FastMath.h
+///
+/// \brief Header file for the FastMath class.
+///
+
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+
+// std and third-party
+#include "std_includes.h"
+
+
+constexpr double FAST_MATH_MAX_RELATIVE_ERROR = 1e-8; ///< The documented maximum relative error of FastMath::exp() and FastMath::pow() (the latter for |y * ln(x)| <= 700, however large |y|), as compared to the standard library. See test_FastMath.cpp for the validation sweep.
+
+
+///
+/// \class FastMath
+///
+/// \brief A class of static, polynomial approximations of the transcendental functions
+///     used by the analytic production, degradation, and economics models. Used in
+///     place of the standard library when an asset is in fast kernels mode (see
+///     ModelInputs::fast_kernels). Every approximation has a maximum relative error of
+///     FAST_MATH_MAX_RELATIVE_ERROR; arguments outside of the approximated domain (or
+///     non-finite) are passed through to the standard library.
+///
+
+class FastMath {
+    private:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        //...
+        
+        
+    public:
+        //  1. attributes
+        //...
+        
+        
+        //  2. methods
+        static double exp(double);
+        static double log(double);
+        static double pow(double, double);
+        
+};  /* FastMath */
+
+
+#endif  /* FASTMATH_H */
@@ -49,6 +49,25 @@
 #include "std_includes.h"
 #include "../third_party/fast-cpp-csv-parser/csv.h"
 
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+#endif
+
+
+///
+/// \enum InterpolatorBoundsPolicy
+///
+/// \brief An enumeration of the ways in which an interpolation table may handle query
+///     values outside of its data domain.
+///
+
+enum InterpolatorBoundsPolicy {
+    INTERP_BOUNDS_THROW, ///< Throw an error (the default)
+    INTERP_BOUNDS_CLAMP, ///< Clamp the query value(s) to the data domain
+    INTERP_BOUNDS_EXTRAPOLATE, ///< Linearly extrapolate from the nearest interval(s)
+    N_INTERP_BOUNDS_POLICIES ///< A simple hack to get the number of elements in InterpolatorBoundsPolicy
+};
+
 
 ///
 /// \struct InterpolatorStruct1D
@@ -64,7 +83,17 @@ struct InterpolatorStruct1D {
     double min_x = 0; ///< The minimum (i.e., first) element of x_vec.
     double max_x = 0; ///< The maximum (i.e., last) element of x_vec.
     
+    bool is_uniform_x = false; ///< A boolean which indicates whether x_vec is uniformly spaced (in which case interpolation indices are computed directly, rather than searched for).
+    double inv_dx = 0; ///< The reciprocal of the (uniform) spacing of x_vec (0 if not uniform).
+    
     std::vector<double> y_vec = {}; ///< A vector of dependent data.
+    
+    std::vector<double> slope_vec = {}; ///< A vector of the slopes of the intervals of the piecewise linear interpolant (length n_points - 1).
+    
+    InterpolatorBoundsPolicy bounds_policy = INTERP_BOUNDS_THROW; ///< The policy for handling query values outside of the data domain.
+    
+    bool is_resampled = false; ///< A boolean which indicates whether the data has been resampled onto a uniform grid (see Interpolator::resampleData1D()).
+    double max_resample_deviation = 0; ///< The maximum absolute deviation of the resampled interpolant from the original (piecewise linear) interpolant.
 };
 
 
@@ -84,12 +113,68 @@ struct InterpolatorStruct2D {
     double min_x = 0; ///< The minimum (i.e., first) element of x_vec.
     double max_x = 0; ///< The maximum (i.e., last) element of x_vec.
     
+    bool is_uniform_x = false; ///< A boolean which indicates whether x_vec is uniformly spaced.
+    double inv_dx = 0; ///< The reciprocal of the (uniform) spacing of x_vec (0 if not uniform).
+    
     std::vector<double> y_vec = {}; ///< A vector of independent data (rows).
     
     double min_y = 0; ///< The minimum (i.e., first) element of y_vec.
     double max_y = 0; ///< The maximum (i.e., last) element of y_vec.
     
-    std::vector<std::vector<double>> z_matrix = {}; ///< A matrix of dependent data.
+    bool is_uniform_y = false; ///< A boolean which indicates whether y_vec is uniformly spaced.
+    double inv_dy = 0; ///< The reciprocal of the (uniform) spacing of y_vec (0 if not uniform).
+    
+    std::vector<double> inv_dx_vec = {}; ///< A vector of the reciprocal widths of the intervals of x_vec (length n_cols - 1).
+    std::vector<double> inv_dy_vec = {}; ///< A vector of the reciprocal widths of the intervals of y_vec (length n_rows - 1).
+    
+    InterpolatorBoundsPolicy bounds_policy = INTERP_BOUNDS_THROW; ///< The policy for handling query values outside of the data domain.
+    
+    std::vector<double> z_vec = {}; ///< A (contiguous, row-major) matrix of dependent data, such that element (i, j) is z_vec[i * n_cols + j].
+};
+
+
+///
+/// \struct InterpolatorCursor
+///
+/// \brief A struct which remembers the last bracketing interval(s) found by an
+///     interpolation. Intended to be held by a caller whose successive queries are
+///     close together (e.g., from one timestep to the next), so that the next search
+///     can begin from the last interval rather than from scratch.
+///
+
+struct InterpolatorCursor {
+    int idx_x = -1; ///< The last interpolation index into x_vec (-1 if none).
+    int idx_y = -1; ///< The last interpolation index into y_vec (-1 if none, 2D only).
+};
+
+
+///
+/// \struct InterpolatorHandle1D
+///
+/// \brief A lightweight handle to a 1D interpolation table, as returned by
+///     Interpolator::addData1D(), Interpolator::borrowData1D(), or
+///     Interpolator::getHandle1D(). Interpolating through a handle involves no map
+///     lookups. A handle remains valid for the lifetime of the Interpolator which issued
+///     it (but is not carried over by copies of it). The referenced table is read only.
+///
+
+struct InterpolatorHandle1D {
+    const InterpolatorStruct1D* interp_struct_1D_ptr = nullptr; ///< A pointer to the referenced 1D interpolation table.
+};
+
+
+///
+/// \struct InterpolatorHandle2D
+///
+/// \brief A lightweight handle to a 2D interpolation table, as returned by
+///     Interpolator::addData2D(), Interpolator::borrowData2D(), or
+///     Interpolator::getHandle2D(). Interpolating through a handle involves no map
+///     lookups. A handle remains valid for the lifetime of the Interpolator which issued
+///     it (but is not carried over by copies of it). The referenced table is read only.
+///
+
+struct InterpolatorHandle2D {
+    const InterpolatorStruct2D* interp_struct_2D_ptr = nullptr; ///< A pointer to the referenced 2D interpolation table.
 };
 
 
@@ -103,21 +188,38 @@ struct InterpolatorStruct2D {
 class Interpolator {
     private:
         //  1. attributes
-        //...
+        std::map<int, std::shared_ptr<const InterpolatorStruct1D>> borrowed_map_1D; ///< A map <int, pointer> of borrowed (shared, read only) 1D interpolation data.
+        std::map<int, std::shared_ptr<const InterpolatorStruct2D>> borrowed_map_2D; ///< A map <int, pointer> of borrowed (shared, read only) 2D interpolation data.
         
         
         //  2. methods
         void __checkDataKey1D(int);
         void __checkDataKey2D(int);
         
-        void __checkBounds1D(int, double);
-        void __checkBounds2D(int, double, double);
+        InterpolatorStruct1D* __getOwnedData1D(int, std::string);
+        InterpolatorStruct2D* __getOwnedData2D(int, std::string);
+        
+        void __checkBounds1D(const InterpolatorStruct1D*, double*);
+        void __checkBounds2D(const InterpolatorStruct2D*, double*, double*);
         
         void __throwReadError(std::string, int);
         
         bool __isNonNumeric(std::string);
         
-        int __getInterpolationIndex(double, std::vector<double>*);
+        bool __isUniformGrid(const std::vector<double>*);
+        
+        void __setGridProperties1D(InterpolatorStruct1D*);
+        void __setGridProperties2D(InterpolatorStruct2D*);
+        
+        double __bilinearKernel(const double*, const double*, double, double);
+        
+        int __getInterpolationIndex(
+            double,
+            const std::vector<double>*,
+            bool = false,
+            double = 0,
+            int* = nullptr
+        );
         
         std::vector<std::string> __splitCommaSeparatedString(
             std::string,
@@ -132,21 +234,66 @@ class Interpolator {
         
     public:
         //  1. attributes
-        std::map<int, InterpolatorStruct1D> interp_map_1D; ///< A map <int, InterpolatorStruct1D> of given 1D interpolation data.
+        std::map<int, InterpolatorStruct1D> interp_map_1D; ///< A map <int, InterpolatorStruct1D> of given (owned) 1D interpolation data. Borrowed data is not held here (see borrowData1D()).
         std::map<int, std::string> path_map_1D; ///< A map <int, string> of the paths (either relative or absolute) to the given 1D interpolation data.
         
-        std::map<int, InterpolatorStruct2D> interp_map_2D; ///< A map <int, InterpolatorStruct2D> of given 2D interpolation data.
+        std::map<int, InterpolatorStruct2D> interp_map_2D; ///< A map <int, InterpolatorStruct2D> of given (owned) 2D interpolation data. Borrowed data is not held here (see borrowData2D()).
         std::map<int, std::string> path_map_2D; ///< A map <int, string> of the paths (either relative or absolute) to the given 2D interpolation data.
         
         
         //  2. methods
         Interpolator(void);
         
-        void addData1D(int, std::string);
-        void addData2D(int, std::string);
+        InterpolatorHandle1D addData1D(int, std::string);
+        InterpolatorHandle1D addData1D(int, InterpolatorStruct1D);
+        InterpolatorHandle2D addData2D(int, std::string);
         
-        double interp1D(int, double);
-        double interp2D(int, double, double);
+        InterpolatorHandle1D borrowData1D(int, std::string);
+        InterpolatorHandle1D borrowData1D(
+            int,
+            std::shared_ptr<const InterpolatorStruct1D>
+        );
+        InterpolatorHandle2D borrowData2D(int, std::string);
+        
+        double resampleData1D(int, int);
+        
+        InterpolatorHandle1D getHandle1D(int);
+        InterpolatorHandle2D getHandle2D(int);
+        
+        void setBoundsPolicy1D(int, InterpolatorBoundsPolicy);
+        void setBoundsPolicy2D(int, InterpolatorBoundsPolicy);
+        
+        double interp1D(int, double, InterpolatorCursor* = nullptr);
+        double interp1D(InterpolatorHandle1D, double, InterpolatorCursor* = nullptr);
+        
+        double interp2D(int, double, double, InterpolatorCursor* = nullptr);
+        double interp2D(
+            InterpolatorHandle2D,
+            double,
+            double,
+            InterpolatorCursor* = nullptr
+        );
+        
+        double interp1DUnchecked(
+            InterpolatorHandle1D,
+            double,
+            InterpolatorCursor* = nullptr
+        );
+        
+        double interp2DUnchecked(
+            InterpolatorHandle2D,
+            double,
+            double,
+            InterpolatorCursor* = nullptr
+        );
+        
+        void interp1DBatch(int, std::vector<double>*, std::vector<double>*);
+        void interp2DBatch(
+            int,
+            std::vector<double>*,
+            std::vector<double>*,
+            std::vector<double>*
+        );
         
         ~Interpolator(void);
         
@@ -48,8 +48,10 @@
 
 //  components
 #include "Controller.h"
+#include "DataCache.h"
 #include "ElectricalLoad.h"
 #include "Resources.h"
+#include "ResultsManifest.h"
 
 //  production
 #include "Production/Combustion/Diesel.h"
@@ -84,6 +86,31 @@ struct ModelInputs {
     
     double firm_dispatch_ratio = 0.1; ///< The ratio [0, 1] of the load in each time step that must be dispatched from firm assets.
     double load_reserve_ratio = 0.1; ///< The ratio [0, 1] of the load in each time step that must be included in the required spinning reserve.
+    
+    bool lazy_resource_loading = false; ///< A boolean which indicates whether resources are only read once bound to an asset (see Resources::lazy_loading).
+    
+    bool fast_kernels = false; ///< A boolean which indicates whether or not the analytic production, degradation, and economics models of every asset added to the Model use FastMath approximations (maximum relative error FAST_MATH_MAX_RELATIVE_ERROR) rather than the standard library. Also enables the (not bit-identical) Solar block production kernel for production series (see Solar::computeProductionSeries()).
+    
+    int stream_window_points = 0; ///< If > 0, then the electrical load and resource time series are streamed in windows of (at most) this many points, so that memory is bounded by the window size rather than by the length of the modelling time series (see Model::run()). Resources are then always lazily registered.
+};
+
+
+class Model;
+
+
+///
+/// \struct ResultsWriteJob
+///
+/// \brief A structure which bundles a snapshot of Model results together with the
+///     write parameters, for use by the background results writer.
+///
+
+struct ResultsWriteJob {
+    Model* snapshot_ptr = nullptr; ///< A pointer to a Model which owns a snapshot of the results to be written.
+    std::string write_path = ""; ///< A path (either relative or absolute) to the directory location where results are to be written.
+    int max_lines = -1; ///< The maximum number of lines of output to write.
+    bool incremental = false; ///< A boolean which indicates whether only changed files are to be (re-)written.
+    std::promise<void> promise; ///< A promise which is fulfilled when the write completes (or fails).
 };
 
 
@@ -98,6 +125,18 @@ struct ModelInputs {
 class Model {
     private:
         //  1. attributes
+        std::thread results_writer_thread; ///< The background (I/O) thread which drains results_writer_queue.
+        std::mutex results_writer_mutex; ///< A mutex guarding the results writer state.
+        std::condition_variable results_writer_cv; ///< A condition variable for signalling changes in the results writer state.
+        std::list<ResultsWriteJob> results_writer_queue; ///< A queue of pending results write jobs.
+        int results_writer_n_pending = 0; ///< The number of write jobs either queued or in progress.
+        bool results_writer_stop = false; ///< A flag which tells the results writer thread to exit (once drained).
+        std::exception_ptr results_writer_exception_ptr = nullptr; ///< The first exception thrown by the results writer since the last flush().
+        
+        bool is_results_snapshot = false; ///< A boolean which indicates whether or not this Model is a results snapshot (see __snapshotResults()), in which case its results are written from the shared ElectricalLoad and Resources below.
+        std::shared_ptr<ElectricalLoad> shared_electrical_load_ptr = nullptr; ///< A read-only copy of the ElectricalLoad, shared by all results snapshots until stale (see __snapshotResults()).
+        std::shared_ptr<Resources> shared_resources_ptr = nullptr; ///< A read-only copy of the Resources, shared by all results snapshots until stale (see __snapshotResults()).
+        
         void __checkInputs(ModelInputs);
         
         void __computeFuelAndEmissions(void);
@@ -105,8 +144,24 @@ class Model {
         void __computeLevellizedCostOfEnergy(void);
         void __computeEconomics(void);
         
-        void __writeSummary(std::string);
-        void __writeTimeSeries(std::string, int = -1);
+        void __writeSummary(std::string, ResultsManifest*);
+        void __writeTimeSeries(std::string, int, ResultsManifest*);
+        
+        void __createAssetDirectories(std::string);
+        void __writeAssetResults(std::string, int, ResultsManifest*);
+        
+        void __runWindow(void);
+        void __accumulateWindow(void);
+        void __resetWindow(void);
+        void __writeWindowResults(std::string);
+        void __runStreaming(void);
+        
+        ElectricalLoad* __getResultsElectricalLoad(void);
+        Resources* __getResultsResources(void);
+        bool __sharedComponentsAreStale(void);
+        Model* __snapshotResults(void);
+        void __resultsWriterLoop(void);
+        void __stopResultsWriter(void);
         
         
         //  2. methods
@@ -138,6 +193,12 @@ class Model {
         std::vector<Renewable*> renewable_ptr_vec;  ///< A vector of pointers to the various Renewable assets in the Model
         std::vector<Storage*> storage_ptr_vec;  ///< A vector of pointers to the various Storage assets in the Model
         
+        std::string stream_sink_path = ""; ///< A path (either relative or absolute) to a directory under which the time series results of each window are written (as window_<k>/) when streaming. If empty, then only accumulated (total) results are kept.
+        
+        bool fast_kernels; ///< A boolean which indicates whether or not assets added to the Model are put in fast kernels mode (see ModelInputs::fast_kernels).
+        
+        int max_pending_writes = 2; ///< The maximum number of asynchronous results writes that may be pending at once (bounds the memory held by result snapshots).
+        
         
         //  2. methods
         Model(void);
@@ -162,7 +223,9 @@ class Model {
         void reset(void);
         void clear(void);
         
-        void writeResults(std::string, int = -1);
+        void writeResults(std::string, int = -1, bool = false);
+        std::shared_future<void> writeResultsAsync(std::string, int = -1, bool = false);
+        void flush(void);
         
         ~Model(void);
         
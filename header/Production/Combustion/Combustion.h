@@ -92,6 +92,7 @@ struct CombustionInputs {
     double cycle_charging_setpoint = 0.85; ///< The cycle charging set point (the load ratio at which to produce when running in cycle charging mode).
     
     std::string path_2_fuel_interp_data = ""; ///< A path (either relative or absolute) to a set of fuel consumption data.
+    int fuel_interp_resample_points = 0; ///< If > 0, then the fuel consumption data is resampled (on construction) onto a uniform grid of this many points, so that lookups require no search (see Interpolator::resampleData1D()).
 };
 
 
@@ -122,17 +123,19 @@ struct Emissions {
 class Combustion : public Production {
     private:
         //  1. attributes
-        //...
+        InterpolatorHandle1D fuel_curve_handle; ///< A handle to the fuel consumption lookup data (see FuelMode::FUEL_MODE_LOOKUP).
+        InterpolatorCursor fuel_curve_cursor; ///< A cursor into the fuel consumption lookup (see FuelMode::FUEL_MODE_LOOKUP), since load ratio varies slowly from one timestep to the next.
         
         
         //  2. methods
         void __checkInputs(CombustionInputs);
         
-        virtual void __writeSummary(std::string) {return;}
+        virtual void __writeSummary(std::string, ResultsManifest*) {return;}
         virtual void __writeTimeSeries(
             std::string,
             std::vector<double>*,
-            int = -1
+            int,
+            ResultsManifest*
         ) {return;}
         
         
@@ -177,6 +180,7 @@ class Combustion : public Production {
         Combustion(void);
         Combustion(int, double, CombustionInputs, std::vector<double>*);
         virtual void handleReplacement(int);
+        virtual void resetWindow(int);
         
         void computeFuelAndEmissions(void);
         void computeEconomics(std::vector<double>*);
@@ -191,7 +195,8 @@ class Combustion : public Production {
             std::string,
             std::vector<double>*,
             int,
-            int = -1
+            int = -1,
+            ResultsManifest* = nullptr
         );
         
         virtual ~Combustion(void);
@@ -109,11 +109,12 @@ class Diesel : public Combustion {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        void __writeSummary(std::string);
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
         
         
@@ -77,6 +77,96 @@ enum HydroInterpKeys {
 };
 
 
+constexpr int HYDRO_GENERATOR_N_POINTS = 12; ///< The number of points in the generator efficiency curve.
+constexpr int HYDRO_TURBINE_N_POINTS = 11; ///< The number of points in the turbine efficiency curves.
+
+/// The power ratios [ ] at which generator efficiency is given.
+constexpr double HYDRO_GENERATOR_POWER_RATIOS[HYDRO_GENERATOR_N_POINTS] = {
+    0,   0.1, 0.2,  0.3, 0.4, 0.5,
+    0.6, 0.7, 0.75, 0.8, 0.9, 1
+};
+
+/// The generator efficiencies [ ] at each of HYDRO_GENERATOR_POWER_RATIOS.
+constexpr double HYDRO_GENERATOR_EFFICIENCIES[HYDRO_GENERATOR_N_POINTS] = {
+    0.000, 0.800, 0.900, 0.913,
+    0.925, 0.943, 0.947, 0.950,
+    0.953, 0.954, 0.956, 0.958
+};
+
+/// The power ratios [ ] at which turbine efficiency is given.
+constexpr double HYDRO_TURBINE_POWER_RATIOS[HYDRO_TURBINE_N_POINTS] = {
+    0,   0.1, 0.2, 0.3, 0.4,
+    0.5, 0.6, 0.7, 0.8, 0.9,
+    1
+};
+
+/// The turbine efficiencies [ ] at each of HYDRO_TURBINE_POWER_RATIOS, by turbine type.
+constexpr double HYDRO_TURBINE_EFFICIENCIES[N_HYDRO_TURBINES][HYDRO_TURBINE_N_POINTS] = {
+    // HYDRO_TURBINE_PELTON
+    {
+        0.000, 0.780, 0.855, 0.875, 0.890,
+        0.900, 0.908, 0.913, 0.918, 0.908,
+        0.880
+    },
+    
+    // HYDRO_TURBINE_FRANCIS
+    {
+        0.000, 0.400, 0.625, 0.745, 0.810,
+        0.845, 0.880, 0.900, 0.910, 0.900,
+        0.850
+    },
+    
+    // HYDRO_TURBINE_KAPLAN
+    {
+        0.000, 0.265, 0.460, 0.550, 0.650,
+        0.740, 0.805, 0.845, 0.900, 0.880,
+        0.850
+    }
+};
+
+
+///
+/// \fn template <int N> constexpr double hydroEfficiencyLookup(
+///         const double (&power_ratio_array)[N],
+///         const double* efficiency_ptr,
+///         double power_ratio
+///     )
+///
+/// \brief Function to linearly interpolate the given (constant) efficiency curve at the
+///     given power ratio. The curve length is a template parameter, so the search is
+///     fully unrollable, and the function may be evaluated at compile time. Gives the
+///     same result as Interpolator::interp1D() on the same data.
+///
+/// \param power_ratio_array The (increasing) power ratios at which efficiency is given.
+///
+/// \param efficiency_ptr A pointer to the N efficiencies at the given power ratios.
+///
+/// \param power_ratio The power ratio at which to interpolate (assumed to be in
+///     the closed interval [0, 1]).
+///
+/// \return The interpolated efficiency.
+///
+
+template <int N>
+constexpr double hydroEfficiencyLookup(
+    const double (&power_ratio_array)[N],
+    const double* efficiency_ptr,
+    double power_ratio
+)
+{
+    int idx = 0;
+    
+    while (idx < N - 2 and power_ratio >= power_ratio_array[idx + 1]) {
+        idx++;
+    }
+    
+    double slope = (efficiency_ptr[idx + 1] - efficiency_ptr[idx]) /
+        (power_ratio_array[idx + 1] - power_ratio_array[idx]);
+    
+    return slope * (power_ratio - power_ratio_array[idx]) + efficiency_ptr[idx];
+}   /* hydroEfficiencyLookup() */
+
+
 ///
 /// \struct HydroInputs
 ///
@@ -100,6 +190,8 @@ struct HydroInputs {
     double init_reservoir_state = 0; ///< The initial state of the reservoir (where state is volume of stored fluid divided by capacity).
     
     HydroTurbineType turbine_type = HydroTurbineType :: HYDRO_TURBINE_PELTON; ///< The type of hydroelectric turbine model to use.
+    
+    int efficiency_interp_resample_points = 0; ///< If > 0, then the turbine and generator efficiency curves are resampled (on construction) onto a uniform grid of this many points, so that lookups require no search (see Interpolator::resampleData1D()). Note that 21 points reproduces the default curves exactly.
 };
 
 
@@ -113,7 +205,15 @@ struct HydroInputs {
 class Hydro : public Noncombustion {
     private:
         //  1. attributes
-        //...
+        InterpolatorHandle1D turbine_efficiency_handle; ///< A handle to the turbine efficiency interpolation data.
+        InterpolatorHandle1D generator_efficiency_handle; ///< A handle to the generator efficiency interpolation data.
+        InterpolatorHandle1D flow_to_power_handle; ///< A handle to the flow to power interpolation data.
+        
+        InterpolatorCursor turbine_efficiency_cursor; ///< A cursor into the turbine efficiency interpolation.
+        InterpolatorCursor generator_efficiency_cursor; ///< A cursor into the generator efficiency interpolation.
+        InterpolatorCursor flow_to_power_cursor; ///< A cursor into the flow to power interpolation.
+        
+        const double* turbine_efficiency_ptr; ///< A pointer to the (constant) turbine efficiency curve for the given turbine type (see HYDRO_TURBINE_EFFICIENCIES).
         
         
         //  2. methods
@@ -121,6 +221,10 @@ class Hydro : public Noncombustion {
         
         void __initInterpolator(void);
         
+        std::string __getFlowToPowerKey(void);
+        InterpolatorStruct1D __buildFlowToPower(void);
+        InterpolatorStruct1D __buildResampledEfficiency(const double*, const double*, int);
+        
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
@@ -137,11 +241,12 @@ class Hydro : public Noncombustion {
         
         void __updateState(int, double, double, double);
         
-        void __writeSummary(std::string);
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
     
     
@@ -149,6 +254,8 @@ class Hydro : public Noncombustion {
         //  1. attributes
         HydroTurbineType turbine_type; ///< The type of hydroelectric turbine model to use.
         
+        int efficiency_interp_resample_points; ///< If > 0, then the turbine and generator efficiency curves are resampled onto a uniform grid of this many points.
+        
         double fluid_density_kgm3; ///< The density [kg/m3] of the hydroelectric working fluid.
         double net_head_m; ///< The net head [m] of the asset.
         
@@ -170,6 +277,7 @@ class Hydro : public Noncombustion {
         Hydro(void);
         Hydro (int, double, HydroInputs, std::vector<double>*);
         void handleReplacement(int);
+        void resetWindow(int);
         
         double requestProductionkW(int, double, double, double);
         double commit(int, double, double, double, double);
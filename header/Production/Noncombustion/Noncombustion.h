@@ -92,11 +92,12 @@ class Noncombustion : public Production {
         void __checkInputs(NoncombustionInputs);
         void __handleStartStop(int, double, double);
         
-        virtual void __writeSummary(std::string) {return;}
+        virtual void __writeSummary(std::string, ResultsManifest*) {return;}
         virtual void __writeTimeSeries(
             std::string,
             std::vector<double>*,
-            int = -1
+            int,
+            ResultsManifest*
         ) {return;}
     
     
@@ -124,7 +125,8 @@ class Noncombustion : public Production {
             std::string,
             std::vector<double>*,
             int,
-            int = -1
+            int = -1,
+            ResultsManifest* = nullptr
         );
         
         virtual ~Noncombustion(void);
@@ -49,7 +49,10 @@
 #include "../std_includes.h"
 #include "../../third_party/fast-cpp-csv-parser/csv.h"
 
+#include "../DataCache.h"
+#include "../FastMath.h"
 #include "../Interpolator.h"
+#include "../ResultsManifest.h"
 
 
 ///
@@ -103,6 +106,7 @@ class Production {
         bool print_flag; ///< A flag which indicates whether or not object construct/destruction should be verbose.
         bool is_running; ///< A boolean which indicates whether or not the asset is running.
         bool is_sunk; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
+        bool fast_kernels; ///< A boolean which indicates whether or not the analytic production and economics models use FastMath approximations rather than the standard library (see ModelInputs::fast_kernels).
         bool normalized_production_series_given; ///< A boolen which indicates whether or not a normalized production time series is given
         
         int n_points; ///< The number of points in the modelling time series.
@@ -147,6 +151,7 @@ class Production {
         Production(void);
         Production(int, double, ProductionInputs, std::vector<double>*);
         virtual void handleReplacement(int);
+        virtual void resetWindow(int);
         
         double computeRealDiscountAnnual(double, double);
         virtual void computeEconomics(std::vector<double>*);
@@ -64,6 +64,23 @@ enum RenewableType {
 };
 
 
+///
+/// \enum RenewableInterpKeys
+///
+/// \brief A simple enum of keys for the Renewable interpolator (see initPowerCurve()).
+///
+
+enum RenewableInterpKeys {
+    POWER_CURVE_INTERP_KEY, ///< The key for the given normalized power curve
+    RESAMPLED_POWER_CURVE_INTERP_KEY, ///< The key for the pre-sampled normalized power curve
+    N_RENEWABLE_INTERP_KEYS ///< A simple hack to get the number of elements in RenewableInterpKeys
+};
+
+
+constexpr int RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS = 4096; ///< The maximum number of points in the uniform grid onto which a given power curve is automatically pre-sampled (see Wind and Tidal, LOOKUP power production models).
+constexpr double RENEWABLE_POWER_CURVE_MAX_RESAMPLE_DEVIATION = 1e-3; ///< The maximum deviation [ ] (in normalized production) of a pre-sampled power curve from the given curve, above which a warning is printed (see Renewable::initPowerCurve()).
+
+
 ///
 /// \struct RenewableInputs
 ///
@@ -94,13 +111,17 @@ class Renewable : public Production {
         void __checkInputs(RenewableInputs);
         void __handleStartStop(int, double, double);
         
-        virtual void __writeSummary(std::string) {return;}
+        int __getPowerCurveResamplePoints(const InterpolatorStruct1D*);
+        std::string __getPowerCurveKey(const InterpolatorStruct1D*);
+        
+        virtual void __writeSummary(std::string, ResultsManifest*) {return;}
         virtual void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
-            int = -1
+            int,
+            ResultsManifest*
         ) {return;}
         
         
@@ -112,6 +133,10 @@ class Renewable : public Production {
         
         double firmness_factor; ///< A factor [0, 1] which defines how firm the production from this asset is.
         
+        InterpolatorHandle1D power_curve_handle; ///< A handle to the (pre-sampled) normalized power curve, if any (see initPowerCurve()).
+        int power_curve_resample_points; ///< The number of points in the uniform grid onto which the power curve was pre-sampled (0 if used as given, or if not applicable).
+        std::string power_curve_key; ///< A key which uniquely identifies the (pre-sampled) power curve (empty if not applicable).
+        
         
         //  2. methods
         Renewable(void);
@@ -120,8 +145,45 @@ class Renewable : public Production {
         
         void computeEconomics(std::vector<double>*);
         
+        void initPowerCurve(std::string, int);
+        
+        virtual std::string getNormalizedResponseKey(void) {return "";}
+        virtual double computeNormalizedProduction(int, double, double) {return 0;}
+        virtual double computeNormalizedProduction(int, double, double, double) {return 0;}
+        virtual double scaleNormalizedProductionkW(double);
+        
+        virtual void computeNormalizedProductionSeries(
+            int,
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
+        virtual void computeNormalizedProductionSeries(
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        );
+        
+        virtual void scaleNormalizedProductionSeries(
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
         virtual double computeProductionkW(int, double, double) {return 0;}
         virtual double computeProductionkW(int, double, double, double) {return 0;}
+        
+        virtual void computeProductionSeries(
+            int,
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
+        virtual void computeProductionSeries(
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        );
+        
         virtual double commit(int, double, double, double);
         
         void writeResults(
@@ -130,7 +192,8 @@ class Renewable : public Production {
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
             int,
-            int = -1
+            int = -1,
+            ResultsManifest* = nullptr
         );
         
         virtual ~Renewable(void);
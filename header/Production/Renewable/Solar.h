@@ -48,6 +48,10 @@
 
 #include "Renewable.h"
 
+#if defined(__AVX__)
+    #include <immintrin.h>
+#endif
+
 
 ///
 /// \enum SolarProductionModel
@@ -83,7 +87,7 @@ struct SolarInputs {
     
     double derating = 0.8; ///< The derating of the solar PV array (i.e., shadowing, soiling, etc.).
     
-    double julian_day = 0; ///< The number of days (including partial days) since 12:00 on 1 Jan 2000.
+    double julian_day = 0; ///< The number of days (including partial days) since 12:00 on 1 Jan 2000, at the start of the modelling time series.
     
     double latitude_deg = 0; ///< The latitude of the solar PV array [deg].
     double longitude_deg = 0; ///< The longitude of the solar PV array [deg].
@@ -91,6 +95,10 @@ struct SolarInputs {
     double panel_azimuth_deg = 0; ///< The azimuth angle of the panels [deg], relative to north.
     double panel_tilt_deg = 0; ///< The tilt angle of the panels [deg], relative to ground.
     
+    std::vector<double> plane_azimuth_deg_vec = {}; ///< The azimuth angles [deg], relative to north, of the panel planes (sub-arrays) of a multi-plane array (e.g., east/west racking, or multiple roofs). If empty (default), then the array is a single plane (see panel_azimuth_deg and panel_tilt_deg).
+    std::vector<double> plane_tilt_deg_vec = {}; ///< The tilt angles [deg], relative to ground, of the panel planes of a multi-plane array. Must be the same size as plane_azimuth_deg_vec.
+    std::vector<double> plane_capacity_fraction_vec = {}; ///< The fractions [0, 1] of the array capacity installed in each panel plane of a multi-plane array (must sum to 1). If empty (default), then capacity is split evenly between planes.
+    
     double albedo_ground_reflectance = 0.5; ///< The albedo (ground reflectance) to be applied in modelling the solar PV array.
     
     SolarPowerProductionModel power_model = SolarPowerProductionModel :: SOLAR_POWER_SIMPLE; ///< The solar power production model to be applied.
@@ -107,7 +115,10 @@ struct SolarInputs {
 class Solar : public Renewable {
     private:
         //  1. attributes
-        //...
+        std::vector<double>* time_vec_hrs_ptr; ///< A pointer to the modelling time series, from which the Julian day at each timestep is derived.
+        double init_time_hrs; ///< The time [hrs] at the start of the modelling time series (i.e., at which the Julian day is julian_day).
+        
+        std::shared_ptr<const SolarEphemerisData> ephemeris_ptr; ///< A pointer to the (shared) site solar ephemeris. Acquired on first use (detailed production model only).
         
         
         //  2. methods
@@ -116,13 +127,13 @@ class Solar : public Renewable {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        double __getMeanLongitudeDeg(void);
-        double __getMeanAnomalyRad(void);
+        double __getMeanLongitudeDeg(double);
+        double __getMeanAnomalyRad(double);
         
         double __getEclipticLongitudeRad(double, double);
-        double __getObliquityOfEclipticRad(void);
+        double __getObliquityOfEclipticRad(double);
         
-        double __getGreenwichMeanSiderialTimeHrs(void);
+        double __getGreenwichMeanSiderialTimeHrs(double);
         double __getLocalMeanSiderialTimeHrs(double);
         
         double __getRightAscensionRad(double, double);
@@ -136,24 +147,34 @@ class Solar : public Renewable {
         double __getDiffuseHorizontalIrradiancekWm2(double);
         double __getDirectNormalIrradiancekWm2(double, double, double);
         
-        double __getAngleOfIncidenceRad(double, double);
+        double __getAngleOfIncidenceRad(int, double, double);
         
         double __getBeamIrradiancekWm2(double, double);
-        double __getDiffuseIrradiancekWm2(double);
-        double __getGroundReflectedIrradiancekWm2(double);
+        double __getDiffuseIrradiancekWm2(int, double);
+        double __getGroundReflectedIrradiancekWm2(int, double);
+        
+        void __computeSolarPosition(double, double*, double*);
+        
+        std::string __getEphemerisKey(void);
+        SolarEphemerisData __buildEphemeris(void);
+        void __getSolarPosition(int, double*, double*);
         
-        double __getPlaneOfArrayIrradiancekWm2(int, double, double);
+        double __getPlaneOfArrayIrradiancekWm2(int, double, double, double, double, double);
         
         double __computeSimpleProductionkW(int, double, double);
         double __computeDetailedProductionkW(int, double, double);
+        void __computeDetailedProductionBlockkW(int, int, int, const double*, double*);
         
-        void __writeSummary(std::string);
+        void __splitProductionByCapacity(int, double);
+        
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
         
         
@@ -161,7 +182,7 @@ class Solar : public Renewable {
         //  1. attributes
         double derating; ///< The derating of the solar PV array (i.e., shadowing, soiling, etc.).
         
-        double julian_day; ///< The number of days (including partial days) since 12:00 on 1 Jan 2000.
+        double julian_day; ///< The number of days (including partial days) since 12:00 on 1 Jan 2000, at the start of the modelling time series (see getJulianDay()).
         
         double latitude_deg; ///< The latitude of the solar PV array [deg].
         double longitude_deg; ///< The longitude of the solar PV array [deg].
@@ -169,12 +190,21 @@ class Solar : public Renewable {
         double latitude_rad; ///< The latitude of the solar PV array [rad].
         double longitude_rad; ///< The longitude of the solar PV array [rad].
         
-        double panel_azimuth_deg; ///< The azimuth angle of the panels [deg], relative to north.
-        double panel_tilt_deg; ///< The tilt angle of the panels [deg], relative to ground.
+        double panel_azimuth_deg; ///< The azimuth angle of the panels [deg], relative to north (of the first plane, for multi-plane arrays).
+        double panel_tilt_deg; ///< The tilt angle of the panels [deg], relative to ground (of the first plane, for multi-plane arrays).
         
         double panel_azimuth_rad; ///< The azimuth angle of the panels [rad], relative to north.
         double panel_tilt_rad; ///< The tilt angle of the panels [rad], relative to ground.
         
+        int n_planes; ///< The number of panel planes (sub-arrays) of the array (1, unless the array is multi-plane).
+        
+        std::vector<double> plane_azimuth_rad_vec; ///< The azimuth angle [rad], relative to north, of each panel plane.
+        std::vector<double> plane_tilt_rad_vec; ///< The tilt angle [rad], relative to ground, of each panel plane.
+        std::vector<double> plane_capacity_kW_vec; ///< The capacity [kW] installed in each panel plane.
+        
+        std::vector<double> plane_total_production_kWh; ///< The total production [kWh] of each panel plane over the modelling period.
+        std::vector<std::vector<double>> plane_production_vec_kW; ///< The production [kW] of each panel plane (row) at each point in the modelling time series (column). Production is the sum over planes. Only allocated for multi-plane arrays (empty otherwise, since the production of a single plane is that of the array).
+        
         double albedo_ground_reflectance; ///< The albedo (ground reflectance) to be applied in modelling the solar PV array.
         
         SolarPowerProductionModel power_model; ///< The solar power production model to be applied.
@@ -184,8 +214,13 @@ class Solar : public Renewable {
         Solar(void);
         Solar(int, double, SolarInputs, std::vector<double>*);
         void handleReplacement(int);
+        void resetWindow(int);
+        
+        double getJulianDay(int);
         
         double computeProductionkW(int, double, double);
+        void computeProductionBlockkW(int, std::vector<double>*, std::vector<double>*);
+        void computeProductionSeries(int, std::vector<double>*, std::vector<double>*);
         double commit(int, double, double, double);
         
         ~Solar(void);
@@ -85,6 +85,9 @@ struct TidalInputs {
     double design_speed_ms = 3; ///< The tidal stream speed [m/s] at which the tidal turbine achieves its rated capacity.
     
     TidalPowerProductionModel power_model = TidalPowerProductionModel :: TIDAL_POWER_CUBIC; ///< The tidal power production model to be applied.
+    
+    std::string path_2_normalized_power_curve = ""; ///< A path (either relative or absolute) to a normalized power curve for the tidal turbine (i.e., tidal stream speed [m/s] against production normalized by capacity [ ]), as required by TidalPowerProductionModel::TIDAL_POWER_LOOKUP. Outside of the given curve (i.e., below cut-in or above cut-out), production is zero.
+    int power_curve_resample_points = 0; ///< The number of points in the uniform tidal stream speed grid onto which the power curve is pre-sampled (on construction), so that lookups require no search (see Interpolator::resampleData1D()). If 0 (default), then a uniformly tabulated curve is used as given, and any other curve is pre-sampled onto the coarsest uniform grid which is at least as fine as its narrowest interval and contains every point of the curve (up to RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS points; see Renewable::initPowerCurve()).
 };
 
 
@@ -107,17 +110,18 @@ class Tidal : public Renewable {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        double __computeCubicProductionkW(int, double, double);
-        double __computeExponentialProductionkW(int, double, double);
-        double __computeLookupProductionkW(int, double, double);
+        double __computeCubicProduction(int, double, double);
+        double __computeExponentialProduction(int, double, double);
+        double __computeLookupProduction(int, double, double);
         
-        void __writeSummary(std::string);
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
         
         
@@ -134,7 +138,18 @@ class Tidal : public Renewable {
         Tidal(int, double, TidalInputs, std::vector<double>*);
         void handleReplacement(int);
         
+        std::string getNormalizedResponseKey(void);
+        double computeNormalizedProduction(int, double, double);
         double computeProductionkW(int, double, double);
+        
+        void computeNormalizedProductionSeries(
+            int,
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
+        void computeProductionSeries(int, std::vector<double>*, std::vector<double>*);
+        
         double commit(int, double, double, double);
         
         ~Tidal(void);
@@ -49,6 +49,9 @@
 #include "Renewable.h"
 
 
+constexpr int WAVE_SEA_STATE_MEMO_MAX_CELLS = 4194304; ///< The maximum number of cells in a sea state memo (see Wave, LOOKUP power production model).
+
+
 ///
 /// \enum WaveProductionModel
 ///
@@ -88,6 +91,10 @@ struct WaveInputs {
     WavePowerProductionModel power_model = WavePowerProductionModel :: WAVE_POWER_PARABOLOID; ///< The wave power production model to be applied.
     
     std::string path_2_normalized_performance_matrix = ""; ///< A path (either relative or absolute) to a normalized performance matrix for the wave energy converter.
+    
+    bool use_sea_state_memo = false; ///< A boolean which indicates whether or not to look up production in a quantized sea state memo, shared by all Wave assets using the same performance matrix (LOOKUP power production model only). Sea states are rounded to the memo resolution, which should be that of the resource data.
+    double memo_resolution_significant_wave_height_m = 0.01; ///< The resolution [m] of significant wave height in the sea state memo.
+    double memo_resolution_energy_period_s = 0.01; ///< The resolution [s] of energy period in the sea state memo.
 };
 
 
@@ -101,7 +108,10 @@ struct WaveInputs {
 class Wave : public Renewable {
     private:
         //  1. attributes
-        //...
+        InterpolatorHandle2D lookup_handle; ///< A handle to the normalized performance matrix (see WavePowerProductionModel::WAVE_POWER_LOOKUP).
+        InterpolatorCursor lookup_cursor; ///< A cursor into the normalized performance matrix (see WavePowerProductionModel::WAVE_POWER_LOOKUP), since sea states vary slowly from one timestep to the next.
+        
+        std::shared_ptr<SeaStateMemoData> sea_state_memo_ptr; ///< A pointer to the (shared) quantized sea state memo, if in use (see WaveInputs::use_sea_state_memo).
         
         
         //  2. methods
@@ -110,17 +120,22 @@ class Wave : public Renewable {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        double __computeGaussianProductionkW(int, double, double, double);
-        double __computeParaboloidProductionkW(int, double, double, double);
-        double __computeLookupProductionkW(int, double, double, double);
+        void __initSeaStateMemo(WaveInputs);
+        std::string __getSeaStateMemoKey(double, double);
+        double __getMemoizedNormalizedProduction(double, double);
+        
+        double __computeGaussianProduction(int, double, double, double);
+        double __computeParaboloidProduction(int, double, double, double);
+        double __computeLookupProduction(int, double, double, double);
         
-        void __writeSummary(std::string);
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
         
         
@@ -132,13 +147,30 @@ class Wave : public Renewable {
         WavePowerProductionModel power_model; ///< The wave power production model to be applied.
         std::string power_model_string; ///< A string describing the active power production model.
         
+        bool use_sea_state_memo; ///< A boolean which indicates whether or not production is looked up in a quantized sea state memo.
+        
         
         //  2. methods
         Wave(void);
         Wave(int, double, WaveInputs, std::vector<double>*);
         void handleReplacement(int);
         
+        std::string getNormalizedResponseKey(void);
+        double computeNormalizedProduction(int, double, double, double);
         double computeProductionkW(int, double, double, double);
+        
+        void computeNormalizedProductionSeries(
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        );
+        
+        void computeProductionSeries(
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        );
+        
         double commit(int, double, double, double);
         
         ~Wave(void);
@@ -84,7 +84,13 @@ struct WindInputs {
     
     double design_speed_ms = 14; ///< The wind speed [m/s] at which the wind turbine achieves its rated capacity.
     
+    int n_turbines = 1; ///< The number of identical wind turbines modelled by this asset (i.e., a wind farm, if > 1). Capacity is that of the whole farm (split evenly between turbines), and the power curve is evaluated once per timestep, regardless of the number of turbines.
+    std::vector<double> turbine_factor_vec = {}; ///< Per-turbine production factors [0, 1] (e.g., to account for wake losses and availability). If empty (default), then every factor is 1. Otherwise, must be of length n_turbines.
+    
     WindPowerProductionModel power_model = WindPowerProductionModel :: WIND_POWER_CUBIC; ///< The wind power production model to be applied.
+    
+    std::string path_2_normalized_power_curve = ""; ///< A path (either relative or absolute) to a normalized power curve for the wind turbine (i.e., wind speed [m/s] against production normalized by capacity [ ]), as required by WindPowerProductionModel::WIND_POWER_LOOKUP. Outside of the given curve (i.e., below cut-in or above cut-out), production is zero.
+    int power_curve_resample_points = 0; ///< The number of points in the uniform wind speed grid onto which the power curve is pre-sampled (on construction), so that lookups require no search (see Interpolator::resampleData1D()). If 0 (default), then a uniformly tabulated curve is used as given, and any other curve is pre-sampled onto the coarsest uniform grid which is at least as fine as its narrowest interval and contains every point of the curve (up to RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS points; see Renewable::initPowerCurve()).
 };
 
 
@@ -107,17 +113,18 @@ class Wind : public Renewable {
         double __getGenericCapitalCost(void);
         double __getGenericOpMaintCost(void);
         
-        double __computeCubicProductionkW(int, double, double);
-        double __computeExponentialProductionkW(int, double, double);
-        double __computeLookupProductionkW(int, double, double);
+        double __computeCubicProduction(int, double, double);
+        double __computeExponentialProduction(int, double, double);
+        double __computeLookupProduction(int, double, double);
         
-        void __writeSummary(std::string);
+        void __writeSummary(std::string, ResultsManifest*);
         void __writeTimeSeries(
             std::string,
             std::vector<double>*,
             std::map<int, std::vector<double>>*,
             std::map<int, std::vector<std::vector<double>>>*,
-            int = -1
+            int,
+            ResultsManifest*
         );
         
         
@@ -125,6 +132,11 @@ class Wind : public Renewable {
         //  1. attributes
         double design_speed_ms; ///< The wind speed [m/s] at which the wind turbine achieves its rated capacity.
         
+        int n_turbines; ///< The number of identical wind turbines modelled by this asset.
+        double turbine_capacity_kW; ///< The rated capacity [kW] of each turbine.
+        std::vector<double> turbine_factor_vec; ///< The production factor [0, 1] of each turbine (e.g., to account for wake losses and availability).
+        double mean_turbine_factor; ///< The mean of the turbine production factors, which scales the production of the farm.
+        
         WindPowerProductionModel power_model; ///< The wind power production model to be applied.
         std::string power_model_string; ///< A string describing the active power production model.
         
@@ -133,7 +145,25 @@ class Wind : public Renewable {
         Wind(int, double, WindInputs, std::vector<double>*);
         void handleReplacement(int);
         
+        std::string getNormalizedResponseKey(void);
+        double computeNormalizedProduction(int, double, double);
+        double scaleNormalizedProductionkW(double);
         double computeProductionkW(int, double, double);
+        
+        void computeNormalizedProductionSeries(
+            int,
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
+        void scaleNormalizedProductionSeries(
+            std::vector<double>*,
+            std::vector<double>*
+        );
+        
+        void computeProductionSeries(int, std::vector<double>*, std::vector<double>*);
+        
+        double getTurbineProductionkW(int, int);
         double commit(int, double, double, double);
         
         ~Wind(void);
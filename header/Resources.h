@@ -58,6 +58,21 @@
 #include "Production/Renewable/Renewable.h"
 
 
+///
+/// \struct ResourceRegistration
+///
+/// \brief A structure which records a registered, but not yet loaded, resource (see
+///     Resources::lazy_loading).
+///
+
+struct ResourceRegistration {
+    bool is_noncombustion = false; ///< A boolean which indicates whether the resource is for a Noncombustion (as opposed to a Renewable) asset.
+    NoncombustionType noncombustion_type = NoncombustionType :: HYDRO; ///< The type of Noncombustion resource (if is_noncombustion).
+    RenewableType renewable_type = RenewableType :: SOLAR; ///< The type of Renewable resource (if not is_noncombustion).
+    std::string path_2_resource_data = ""; ///< A string defining the path (either relative or absolute) to the given resource time series.
+};
+
+
 ///
 /// \class Resources
 ///
@@ -68,7 +83,8 @@
 class Resources {
     private:
         //  1. attributes
-        //...
+        std::map<int, std::shared_ptr<io::CSVReader<2>>> stream_map_1D; ///< A map <int, CSV reader pointer> of the open 1D resource streams (streaming only).
+        std::map<int, std::shared_ptr<io::CSVReader<3>>> stream_map_2D; ///< A map <int, CSV reader pointer> of the open 2D resource streams (streaming only).
         
         
         //  2. methods
@@ -87,9 +103,22 @@ class Resources {
         void __readWaveResource(std::string, int, ElectricalLoad*);
         void __readWindResource(std::string, int, ElectricalLoad*);
         
+        void __registerResource(int, std::string, ResourceRegistration);
+        
+        std::string __getResourceHeader1D(ResourceRegistration);
+        
+        void __readResourceWindow1D(int, ElectricalLoad*);
+        void __readResourceWindow2D(int, ElectricalLoad*);
+        
         
     public:
         //  1. attributes
+        bool is_streaming; ///< A boolean which indicates whether registered resources are being streamed in windows, alongside the electrical load (see openResourceStreams()).
+        bool lazy_loading; ///< A boolean which indicates whether addResource() only registers resources, deferring reading until the resource is bound to an asset (see loadResource1D() and loadResource2D()).
+        
+        std::map<int, ResourceRegistration> registration_map_1D; ///< A map <int, ResourceRegistration> of registered, but not yet loaded, 1D resources.
+        std::map<int, ResourceRegistration> registration_map_2D; ///< A map <int, ResourceRegistration> of registered, but not yet loaded, 2D resources.
+        
         std::map<int, std::vector<double>> resource_map_1D; ///< A map <int, vector<double>> of given 1D renewable resource time series.
         std::map<int, std::string> string_map_1D; ///< A map <int, string> of descriptors for the type of the given 1D renewable resource time series.
         std::map<int, std::string> path_map_1D; ///< A map <int, string> of the paths (either relative or absolute) to given 1D renewable resource time series.
@@ -105,6 +134,17 @@ class Resources {
         void addResource(NoncombustionType, std::string, int, ElectricalLoad*);
         void addResource(RenewableType, std::string, int, ElectricalLoad*);
         
+        void loadResource1D(int, ElectricalLoad*);
+        void loadResource2D(int, ElectricalLoad*);
+        
+        void openResourceStreams(
+            ElectricalLoad*,
+            std::vector<int>* = nullptr,
+            std::vector<int>* = nullptr
+        );
+        void readResourceWindows(ElectricalLoad*);
+        void closeResourceStreams(void);
+        
         void clear(void);
         
         ~Resources(void);
@@ -0,0 +1,104 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+
+///
+/// \file ResultsManifest.h
+///
+/// \brief Header file for the ResultsManifest class.
+///
+
+
+#ifndef RESULTSMANIFEST_H
+#define RESULTSMANIFEST_H
+
+
+// std and third-party
+#include "std_includes.h"
+
+
+///
+/// \class ResultsManifest
+///
+/// \brief A class which tracks a content hash for every results file written under a
+///     given output directory. Files whose contents are unchanged since the last write
+///     (as recorded in the on-disk manifest) are skipped, and files which are no longer
+///     written can be pruned precisely. Intended to support incremental writing of
+///     Model results.
+///
+
+class ResultsManifest {
+    private:
+        //  1. attributes
+        std::mutex manifest_mutex; ///< A mutex guarding current_hash_map and the file counters (writeFile() may be called concurrently).
+        
+        
+        //  2. methods
+        std::string __getRelativePath(std::string);
+        
+        
+    public:
+        //  1. attributes
+        int n_files_written; ///< The number of files written (since construction/clear).
+        int n_files_skipped; ///< The number of files skipped as unchanged (since construction/clear).
+        int n_files_pruned; ///< The number of stale files pruned (since construction/clear).
+        
+        std::string write_path; ///< A path (either relative or absolute) to the root results directory (empty if untracked).
+        
+        std::map<std::string, std::string> previous_hash_map; ///< A map <relative path, content hash> as read from the on-disk manifest.
+        std::map<std::string, std::string> current_hash_map; ///< A map <relative path, content hash> of all files written (or skipped) in the current pass.
+        
+        
+        //  2. methods
+        ResultsManifest(void);
+        ResultsManifest(std::string);
+        
+        std::string computeHash(const std::string&);
+        
+        bool writeFile(std::string, const std::string&);
+        void prune(void);
+        void writeManifest(void);
+        
+        void clear(void);
+        
+        ~ResultsManifest(void);
+        
+};  /* ResultsManifest */
+
+
+#endif  /* RESULTSMANIFEST_H */
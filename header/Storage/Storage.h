@@ -49,7 +49,10 @@
 #include "../std_includes.h"
 #include "../../third_party/fast-cpp-csv-parser/csv.h"
 
+#include "../DataCache.h"
+#include "../FastMath.h"
 #include "../Interpolator.h"
+#include "../ResultsManifest.h"
 
 
 ///
@@ -101,8 +104,13 @@ class Storage {
         
         double __computeRealDiscountAnnual(double, double);
         
-        virtual void __writeSummary(std::string) {return;}
-        virtual void __writeTimeSeries(std::string, std::vector<double>*, int = -1) {return;}
+        virtual void __writeSummary(std::string, ResultsManifest*) {return;}
+        virtual void __writeTimeSeries(
+            std::string,
+            std::vector<double>*,
+            int,
+            ResultsManifest*
+        ) {return;}
         
         
     public:
@@ -114,6 +122,7 @@ class Storage {
         bool print_flag; ///< A flag which indicates whether or not object construct/destruction should be verbose.
         bool is_depleted; ///< A boolean which indicates whether or not the asset is currently considered depleted.
         bool is_sunk; ///< A boolean which indicates whether or not the asset should be considered a sunk cost (i.e., capital cost incurred at the start of the model, or no).
+        bool fast_kernels; ///< A boolean which indicates whether or not the degradation and economics models use FastMath approximations rather than the standard library (see ModelInputs::fast_kernels).
         
         int n_points; ///< The number of points in the modelling time series.
         int n_replacements; ///< The number of times the asset has been replaced.
@@ -150,6 +159,7 @@ class Storage {
         Storage(void);
         Storage(int, double, StorageInputs);
         virtual void handleReplacement(int);
+        virtual void resetWindow(int);
         
         void computeEconomics(std::vector<double>*);
         
@@ -159,7 +169,13 @@ class Storage {
         virtual void commitCharge(int, double, double) {return;}
         virtual double commitDischarge(int, double, double, double) {return 0;}
         
-        void writeResults(std::string, std::vector<double>*, int, int = -1);
+        void writeResults(
+            std::string,
+            std::vector<double>*,
+            int,
+            int = -1,
+            ResultsManifest* = nullptr
+        );
         
         virtual ~Storage(void);
         
@@ -56,10 +56,13 @@
 PYBIND11_MODULE(PGMcpp, m) {
 
     #include "snippets/PYBIND11_Controller.cpp"
+    #include "snippets/PYBIND11_DataCache.cpp"
     #include "snippets/PYBIND11_ElectricalLoad.cpp"
+    #include "snippets/PYBIND11_FastMath.cpp"
     #include "snippets/PYBIND11_Interpolator.cpp"
     #include "snippets/PYBIND11_Model.cpp"
     #include "snippets/PYBIND11_Resources.cpp"
+    #include "snippets/PYBIND11_ResultsManifest.cpp"
     
     #include "snippets/Production/PYBIND11_Production.cpp"
     
@@ -73,6 +73,14 @@ pybind11::class_<Controller>(m, "Controller")
     
     .def(pybind11::init<>())
     .def("setControlMode", &Controller::setControlMode)
-    .def("init", &Controller::init)
+    .def(
+        "init",
+        &Controller::init,
+        pybind11::arg("electrical_load_ptr"),
+        pybind11::arg("renewable_ptr_vec_ptr"),
+        pybind11::arg("resources_ptr"),
+        pybind11::arg("combustion_ptr_vec_ptr"),
+        pybind11::arg("noncombustion_ptr_vec_ptr") = nullptr
+    )
     .def("applyDispatchControl", &Controller::applyDispatchControl)
     .def("clear", &Controller::clear);
@@ -49,7 +49,11 @@
 
 
 pybind11::class_<ElectricalLoad>(m, "ElectricalLoad")
+    .def_readwrite("is_streaming", &ElectricalLoad::is_streaming)
     .def_readwrite("n_points", &ElectricalLoad::n_points)
+    .def_readwrite("n_points_total", &ElectricalLoad::n_points_total)
+    .def_readwrite("window_points", &ElectricalLoad::window_points)
+    .def_readwrite("window_start", &ElectricalLoad::window_start)
     .def_readwrite("n_years", &ElectricalLoad::n_years)
     .def_readwrite("min_load_kW", &ElectricalLoad::min_load_kW)
     .def_readwrite("mean_load_kW", &ElectricalLoad::mean_load_kW)
@@ -62,4 +66,7 @@ pybind11::class_<ElectricalLoad>(m, "ElectricalLoad")
     .def(pybind11::init<>())
     .def(pybind11::init<std::string>())
     .def("readLoadData", &ElectricalLoad::readLoadData)
+    .def("openLoadStream", &ElectricalLoad::openLoadStream)
+    .def("rewindLoadStream", &ElectricalLoad::rewindLoadStream)
+    .def("readLoadWindow", &ElectricalLoad::readLoadWindow)
     .def("clear", &ElectricalLoad::clear);
@@ -48,12 +48,34 @@
 ///
 
 
+pybind11::enum_<InterpolatorBoundsPolicy>(m, "InterpolatorBoundsPolicy")
+    .value("INTERP_BOUNDS_THROW", InterpolatorBoundsPolicy::INTERP_BOUNDS_THROW)
+    .value("INTERP_BOUNDS_CLAMP", InterpolatorBoundsPolicy::INTERP_BOUNDS_CLAMP)
+    .value(
+        "INTERP_BOUNDS_EXTRAPOLATE",
+        InterpolatorBoundsPolicy::INTERP_BOUNDS_EXTRAPOLATE
+    )
+    .value(
+        "N_INTERP_BOUNDS_POLICIES",
+        InterpolatorBoundsPolicy::N_INTERP_BOUNDS_POLICIES
+    );
+
+
 pybind11::class_<InterpolatorStruct1D>(m, "InterpolatorStruct1D")
     .def_readwrite("n_points", &InterpolatorStruct1D::n_points)
     .def_readwrite("x_vec", &InterpolatorStruct1D::x_vec)
     .def_readwrite("min_x", &InterpolatorStruct1D::min_x)
     .def_readwrite("max_x", &InterpolatorStruct1D::max_x)
+    .def_readwrite("is_uniform_x", &InterpolatorStruct1D::is_uniform_x)
+    .def_readwrite("inv_dx", &InterpolatorStruct1D::inv_dx)
     .def_readwrite("y_vec", &InterpolatorStruct1D::y_vec)
+    .def_readwrite("slope_vec", &InterpolatorStruct1D::slope_vec)
+    .def_readwrite("bounds_policy", &InterpolatorStruct1D::bounds_policy)
+    .def_readwrite("is_resampled", &InterpolatorStruct1D::is_resampled)
+    .def_readwrite(
+        "max_resample_deviation",
+        &InterpolatorStruct1D::max_resample_deviation
+    )
     
     .def(pybind11::init());
 
@@ -64,14 +86,36 @@ pybind11::class_<InterpolatorStruct2D>(m, "InterpolatorStruct2D")
     .def_readwrite("x_vec", &InterpolatorStruct2D::x_vec)
     .def_readwrite("min_x", &InterpolatorStruct2D::min_x)
     .def_readwrite("max_x", &InterpolatorStruct2D::max_x)
+    .def_readwrite("is_uniform_x", &InterpolatorStruct2D::is_uniform_x)
+    .def_readwrite("inv_dx", &InterpolatorStruct2D::inv_dx)
     .def_readwrite("y_vec", &InterpolatorStruct2D::y_vec)
     .def_readwrite("min_y", &InterpolatorStruct2D::min_y)
     .def_readwrite("max_y", &InterpolatorStruct2D::max_y)
-    .def_readwrite("z_matrix", &InterpolatorStruct2D::z_matrix)
+    .def_readwrite("is_uniform_y", &InterpolatorStruct2D::is_uniform_y)
+    .def_readwrite("inv_dy", &InterpolatorStruct2D::inv_dy)
+    .def_readwrite("inv_dx_vec", &InterpolatorStruct2D::inv_dx_vec)
+    .def_readwrite("inv_dy_vec", &InterpolatorStruct2D::inv_dy_vec)
+    .def_readwrite("bounds_policy", &InterpolatorStruct2D::bounds_policy)
+    .def_readwrite("z_vec", &InterpolatorStruct2D::z_vec)
+    
+    .def(pybind11::init());
+
+
+pybind11::class_<InterpolatorCursor>(m, "InterpolatorCursor")
+    .def_readwrite("idx_x", &InterpolatorCursor::idx_x)
+    .def_readwrite("idx_y", &InterpolatorCursor::idx_y)
     
     .def(pybind11::init());
 
 
+pybind11::class_<InterpolatorHandle1D>(m, "InterpolatorHandle1D")
+    .def(pybind11::init());
+
+
+pybind11::class_<InterpolatorHandle2D>(m, "InterpolatorHandle2D")
+    .def(pybind11::init());
+
+
 pybind11::class_<Interpolator>(m, "Interpolator")
     .def_readwrite("interp_map_1D", &Interpolator::interp_map_1D)
     .def_readwrite("path_map_1D", &Interpolator::path_map_1D)
@@ -79,7 +123,77 @@ pybind11::class_<Interpolator>(m, "Interpolator")
     .def_readwrite("path_map_2D", &Interpolator::path_map_2D)
     
     .def(pybind11::init<>())
-    .def("addData1D", &Interpolator::addData1D)
+    .def(
+        "addData1D",
+        pybind11::overload_cast<int, std::string>(&Interpolator::addData1D)
+    )
+    .def(
+        "addData1D",
+        pybind11::overload_cast<int, InterpolatorStruct1D>(&Interpolator::addData1D)
+    )
     .def("addData2D", &Interpolator::addData2D)
-    .def("interp1D", &Interpolator::interp1D)
-    .def("interp2D", &Interpolator::interp2D);
+    .def(
+        "borrowData1D",
+        pybind11::overload_cast<int, std::string>(&Interpolator::borrowData1D)
+    )
+    .def("borrowData2D", &Interpolator::borrowData2D)
+    .def("resampleData1D", &Interpolator::resampleData1D)
+    .def("getHandle1D", &Interpolator::getHandle1D)
+    .def("getHandle2D", &Interpolator::getHandle2D)
+    .def("setBoundsPolicy1D", &Interpolator::setBoundsPolicy1D)
+    .def("setBoundsPolicy2D", &Interpolator::setBoundsPolicy2D)
+    .def(
+        "interp1D",
+        pybind11::overload_cast<int, double, InterpolatorCursor*>(
+            &Interpolator::interp1D
+        ),
+        pybind11::arg("data_key"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def(
+        "interp1D",
+        pybind11::overload_cast<InterpolatorHandle1D, double, InterpolatorCursor*>(
+            &Interpolator::interp1D
+        ),
+        pybind11::arg("handle"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def(
+        "interp2D",
+        pybind11::overload_cast<int, double, double, InterpolatorCursor*>(
+            &Interpolator::interp2D
+        ),
+        pybind11::arg("data_key"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("interp_y"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def(
+        "interp2D",
+        pybind11::overload_cast<InterpolatorHandle2D, double, double, InterpolatorCursor*>(
+            &Interpolator::interp2D
+        ),
+        pybind11::arg("handle"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("interp_y"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def(
+        "interp1DUnchecked",
+        &Interpolator::interp1DUnchecked,
+        pybind11::arg("handle"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def(
+        "interp2DUnchecked",
+        &Interpolator::interp2DUnchecked,
+        pybind11::arg("handle"),
+        pybind11::arg("interp_x"),
+        pybind11::arg("interp_y"),
+        pybind11::arg("cursor_ptr") = nullptr
+    )
+    .def("interp1DBatch", &Interpolator::interp1DBatch)
+    .def("interp2DBatch", &Interpolator::interp2DBatch);
@@ -56,6 +56,15 @@ pybind11::class_<ModelInputs>(m, "ModelInputs")
     .def_readwrite("control_mode", &ModelInputs::control_mode)
     .def_readwrite("firm_dispatch_ratio", &ModelInputs::firm_dispatch_ratio)
     .def_readwrite("load_reserve_ratio", &ModelInputs::load_reserve_ratio)
+    .def_readwrite(
+        "lazy_resource_loading",
+        &ModelInputs::lazy_resource_loading
+    )
+    .def_readwrite("fast_kernels", &ModelInputs::fast_kernels)
+    .def_readwrite(
+        "stream_window_points",
+        &ModelInputs::stream_window_points
+    )
     
     .def(pybind11::init());
 
@@ -87,6 +96,9 @@ pybind11::class_<Model>(m, "Model")
     .def_readwrite("noncombustion_ptr_vec", &Model::noncombustion_ptr_vec)
     .def_readwrite("renewable_ptr_vec", &Model::renewable_ptr_vec)
     .def_readwrite("storage_ptr_vec", &Model::storage_ptr_vec)
+    .def_readwrite("stream_sink_path", &Model::stream_sink_path)
+    .def_readwrite("fast_kernels", &Model::fast_kernels)
+    .def_readwrite("max_pending_writes", &Model::max_pending_writes)
     
     .def(pybind11::init<>())
     .def(pybind11::init<ModelInputs>())
@@ -112,5 +124,16 @@ pybind11::class_<Model>(m, "Model")
         "writeResults",
         &Model::writeResults,
         pybind11::arg("write_path"),
-        pybind11::arg("max_lines") = -1
-    );
+        pybind11::arg("max_lines") = -1,
+        pybind11::arg("incremental") = false
+    )
+    .def(
+        "writeResultsAsync",
+        [](Model& self, std::string write_path, int max_lines, bool incremental) {
+            self.writeResultsAsync(write_path, max_lines, incremental);
+        },
+        pybind11::arg("write_path"),
+        pybind11::arg("max_lines") = -1,
+        pybind11::arg("incremental") = false
+    )
+    .def("flush", &Model::flush);
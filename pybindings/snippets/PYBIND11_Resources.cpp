@@ -48,7 +48,23 @@
 ///
 
 
+pybind11::class_<ResourceRegistration>(m, "ResourceRegistration")
+    .def_readwrite("is_noncombustion", &ResourceRegistration::is_noncombustion)
+    .def_readwrite("noncombustion_type", &ResourceRegistration::noncombustion_type)
+    .def_readwrite("renewable_type", &ResourceRegistration::renewable_type)
+    .def_readwrite(
+        "path_2_resource_data",
+        &ResourceRegistration::path_2_resource_data
+    )
+    
+    .def(pybind11::init());
+
+
 pybind11::class_<Resources>(m, "Resources")
+    .def_readwrite("lazy_loading", &Resources::lazy_loading)
+    .def_readwrite("is_streaming", &Resources::is_streaming)
+    .def_readwrite("registration_map_1D", &Resources::registration_map_1D)
+    .def_readwrite("registration_map_2D", &Resources::registration_map_2D)
     .def_readwrite("resource_map_1D", &Resources::resource_map_1D)
     .def_readwrite("string_map_1D", &Resources::string_map_1D)
     .def_readwrite("path_map_1D", &Resources::path_map_1D)
@@ -65,4 +81,15 @@ pybind11::class_<Resources>(m, "Resources")
         "addResource",
         pybind11::overload_cast<RenewableType, std::string, int, ElectricalLoad*>(&Resources::addResource)
     )
+    .def("loadResource1D", &Resources::loadResource1D)
+    .def("loadResource2D", &Resources::loadResource2D)
+    .def(
+        "openResourceStreams",
+        &Resources::openResourceStreams,
+        pybind11::arg("electrical_load_ptr"),
+        pybind11::arg("resource_keys_1D_ptr") = nullptr,
+        pybind11::arg("resource_keys_2D_ptr") = nullptr
+    )
+    .def("readResourceWindows", &Resources::readResourceWindows)
+    .def("closeResourceStreams", &Resources::closeResourceStreams)
     .def("clear", &Resources::clear);
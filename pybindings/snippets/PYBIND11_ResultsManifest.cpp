@@ -0,0 +1,65 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file PYBIND11_ResultsManifest.cpp
+///
+/// \brief Bindings file for the ResultsManifest class. Intended to be #include'd in
+///     PYBIND11_PGM.cpp
+///
+/// Ref: \cite pybind11\n
+///
+/// A file which instructs pybind11 how to build Python bindings for the ResultsManifest
+/// class. Only public attributes/methods are bound!
+///
+
+
+pybind11::class_<ResultsManifest>(m, "ResultsManifest")
+    .def_readwrite("n_files_written", &ResultsManifest::n_files_written)
+    .def_readwrite("n_files_skipped", &ResultsManifest::n_files_skipped)
+    .def_readwrite("n_files_pruned", &ResultsManifest::n_files_pruned)
+    .def_readwrite("write_path", &ResultsManifest::write_path)
+    .def_readwrite("previous_hash_map", &ResultsManifest::previous_hash_map)
+    .def_readwrite("current_hash_map", &ResultsManifest::current_hash_map)
+    
+    .def(pybind11::init<>())
+    .def(pybind11::init<std::string>())
+    .def("computeHash", &ResultsManifest::computeHash)
+    .def("writeFile", &ResultsManifest::writeFile)
+    .def("prune", &ResultsManifest::prune)
+    .def("writeManifest", &ResultsManifest::writeManifest)
+    .def("clear", &ResultsManifest::clear);
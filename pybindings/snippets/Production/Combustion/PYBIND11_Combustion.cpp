@@ -75,6 +75,10 @@ pybind11::class_<CombustionInputs>(m, "CombustionInputs")
         "path_2_fuel_interp_data",
         &CombustionInputs::path_2_fuel_interp_data
     )
+    .def_readwrite(
+        "fuel_interp_resample_points",
+        &CombustionInputs::fuel_interp_resample_points
+    )
     
     .def(pybind11::init());
 
@@ -150,6 +154,7 @@ pybind11::class_<Combustion, Production>(m, "Combustion")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, CombustionInputs, std::vector<double>*>())
     .def("handleReplacement", &Combustion::handleReplacement)
+    .def("resetWindow", &Combustion::resetWindow)
     .def("computeFuelAndEmissions", &Combustion::computeFuelAndEmissions)
     .def("computeEconomics", &Combustion::computeEconomics)
     .def("requestProductionkW", &Combustion::requestProductionkW)
@@ -68,12 +68,20 @@ pybind11::class_<HydroInputs>(m, "HydroInputs")
     .def_readwrite("reservoir_capacity_m3", &HydroInputs::reservoir_capacity_m3)
     .def_readwrite("init_reservoir_state", &HydroInputs::init_reservoir_state)
     .def_readwrite("turbine_type", &HydroInputs::turbine_type)
+    .def_readwrite(
+        "efficiency_interp_resample_points",
+        &HydroInputs::efficiency_interp_resample_points
+    )
     
     .def(pybind11::init());
 
 
 pybind11::class_<Hydro, Noncombustion>(m, "Hydro")
     .def_readwrite("turbine_type", &Hydro::turbine_type)
+    .def_readwrite(
+        "efficiency_interp_resample_points",
+        &Hydro::efficiency_interp_resample_points
+    )
     .def_readwrite("fluid_density_kgm3", &Hydro::fluid_density_kgm3)
     .def_readwrite("net_head_m", &Hydro::net_head_m)
     .def_readwrite("reservoir_capacity_m3", &Hydro::reservoir_capacity_m3)
@@ -93,5 +101,6 @@ pybind11::class_<Hydro, Noncombustion>(m, "Hydro")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, HydroInputs, std::vector<double>*>())
     .def("handleReplacement", &Hydro::handleReplacement)
+    .def("resetWindow", &Hydro::resetWindow)
     .def("requestProductionkW", &Hydro::requestProductionkW)
     .def("commit", &Hydro::commit);
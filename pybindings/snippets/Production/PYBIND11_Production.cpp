@@ -68,6 +68,7 @@ pybind11::class_<Production>(m, "Production")
     .def_readwrite("print_flag", &Production::print_flag)
     .def_readwrite("is_running", &Production::is_running)
     .def_readwrite("is_sunk", &Production::is_sunk)
+    .def_readwrite("fast_kernels", &Production::fast_kernels)
     .def_readwrite(
         "normalized_production_series_given",
         &Production::normalized_production_series_given
@@ -115,6 +116,7 @@ pybind11::class_<Production>(m, "Production")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, ProductionInputs, std::vector<double>*>())
     .def("handleReplacement", &Production::handleReplacement)
+    .def("resetWindow", &Production::resetWindow)
     .def("computeRealDiscountAnnual", &Production::computeRealDiscountAnnual)
     .def("computeEconomics", &Production::computeEconomics)
     .def("getProductionkW", &Production::getProductionkW)
@@ -56,6 +56,15 @@ pybind11::enum_<RenewableType>(m, "RenewableType")
     .value("N_RENEWABLE_TYPES", RenewableType::N_RENEWABLE_TYPES);
 
 
+pybind11::enum_<RenewableInterpKeys>(m, "RenewableInterpKeys")
+    .value("POWER_CURVE_INTERP_KEY", RenewableInterpKeys::POWER_CURVE_INTERP_KEY)
+    .value(
+        "RESAMPLED_POWER_CURVE_INTERP_KEY",
+        RenewableInterpKeys::RESAMPLED_POWER_CURVE_INTERP_KEY
+    )
+    .value("N_RENEWABLE_INTERP_KEYS", RenewableInterpKeys::N_RENEWABLE_INTERP_KEYS);
+
+
 pybind11::class_<RenewableInputs>(m, "RenewableInputs")
     .def_readwrite("production_inputs", &RenewableInputs::production_inputs)
     
@@ -66,11 +75,47 @@ pybind11::class_<Renewable, Production>(m, "Renewable")
     .def_readwrite("type", &Renewable::type)
     .def_readwrite("resource_key", &Renewable::resource_key)
     .def_readwrite("firmness_factor", &Renewable::firmness_factor)
+    .def_readwrite("power_curve_handle", &Renewable::power_curve_handle)
+    .def_readwrite(
+        "power_curve_resample_points",
+        &Renewable::power_curve_resample_points
+    )
+    .def_readwrite("power_curve_key", &Renewable::power_curve_key)
       
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, RenewableInputs, std::vector<double>*>())
     .def("handleReplacement", &Renewable::handleReplacement)
     .def("computeEconomics", &Renewable::computeEconomics)
+    .def("initPowerCurve", &Renewable::initPowerCurve)
+    .def("getNormalizedResponseKey", &Renewable::getNormalizedResponseKey)
+    .def(
+        "computeNormalizedProduction",
+        pybind11::overload_cast<int, double, double>(
+            &Renewable::computeNormalizedProduction
+        )
+    )
+    .def(
+        "computeNormalizedProduction",
+        pybind11::overload_cast<int, double, double, double>(
+            &Renewable::computeNormalizedProduction
+        )
+    )
+    .def("scaleNormalizedProductionkW", &Renewable::scaleNormalizedProductionkW)
+    .def(
+        "computeNormalizedProductionSeries",
+        pybind11::overload_cast<int, std::vector<double>*, std::vector<double>*>(
+            &Renewable::computeNormalizedProductionSeries
+        )
+    )
+    .def(
+        "computeNormalizedProductionSeries",
+        pybind11::overload_cast<
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        >(&Renewable::computeNormalizedProductionSeries)
+    )
+    .def("scaleNormalizedProductionSeries", &Renewable::scaleNormalizedProductionSeries)
     .def(
         "computeProductionkW",
         pybind11::overload_cast<int, double, double>(&Renewable::computeProductionkW)
@@ -79,5 +124,19 @@ pybind11::class_<Renewable, Production>(m, "Renewable")
         "computeProductionkW",
         pybind11::overload_cast<int, double, double, double>(&Renewable::computeProductionkW)
     )
+    .def(
+        "computeProductionSeries",
+        pybind11::overload_cast<int, std::vector<double>*, std::vector<double>*>(
+            &Renewable::computeProductionSeries
+        )
+    )
+    .def(
+        "computeProductionSeries",
+        pybind11::overload_cast<
+            int,
+            std::vector<std::vector<double>>*,
+            std::vector<double>*
+        >(&Renewable::computeProductionSeries)
+    )
     .def("commit", &Renewable::commit)
     .def("writeResults", &Renewable::writeResults);
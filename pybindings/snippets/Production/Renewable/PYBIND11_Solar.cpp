@@ -72,6 +72,12 @@ pybind11::class_<SolarInputs>(m, "SolarInputs")
     .def_readwrite("longitude_deg", &SolarInputs::longitude_deg)
     .def_readwrite("panel_azimuth_deg", &SolarInputs::panel_azimuth_deg)
     .def_readwrite("panel_tilt_deg", &SolarInputs::panel_tilt_deg)
+    .def_readwrite("plane_azimuth_deg_vec", &SolarInputs::plane_azimuth_deg_vec)
+    .def_readwrite("plane_tilt_deg_vec", &SolarInputs::plane_tilt_deg_vec)
+    .def_readwrite(
+        "plane_capacity_fraction_vec",
+        &SolarInputs::plane_capacity_fraction_vec
+    )
     .def_readwrite("albedo_ground_reflectance", &SolarInputs::albedo_ground_reflectance)
     .def_readwrite("power_model", &SolarInputs::power_model)
     
@@ -82,6 +88,10 @@ pybind11::class_<Solar, Renewable>(m, "Solar")
     .def_readwrite("derating", &Solar::derating)
     .def_readwrite("power_model", &Solar::power_model)
     .def_readwrite("power_model_string", &Solar::power_model_string)
+    .def_readwrite("n_planes", &Solar::n_planes)
+    .def_readwrite("plane_capacity_kW_vec", &Solar::plane_capacity_kW_vec)
+    .def_readwrite("plane_total_production_kWh", &Solar::plane_total_production_kWh)
+    .def_readwrite("plane_production_vec_kW", &Solar::plane_production_vec_kW)
     
     .def_readwrite("type_str", &Production::type_str)
     .def_readwrite("capacity_kW", &Production::capacity_kW)
@@ -90,5 +100,9 @@ pybind11::class_<Solar, Renewable>(m, "Solar")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, SolarInputs, std::vector<double>*>())
     .def("handleReplacement", &Solar::handleReplacement)
+    .def("resetWindow", &Solar::resetWindow)
+    .def("getJulianDay", &Solar::getJulianDay)
     .def("computeProductionkW", &Solar::computeProductionkW)
+    .def("computeProductionBlockkW", &Solar::computeProductionBlockkW)
+    .def("computeProductionSeries", &Solar::computeProductionSeries)
     .def("commit", &Solar::commit);
@@ -72,6 +72,14 @@ pybind11::class_<TidalInputs>(m, "TidalInputs")
     )
     .def_readwrite("design_speed_ms", &TidalInputs::design_speed_ms)
     .def_readwrite("power_model", &TidalInputs::power_model)
+    .def_readwrite(
+        "path_2_normalized_power_curve",
+        &TidalInputs::path_2_normalized_power_curve
+    )
+    .def_readwrite(
+        "power_curve_resample_points",
+        &TidalInputs::power_curve_resample_points
+    )
     
     .def(pybind11::init());
 
@@ -88,5 +96,9 @@ pybind11::class_<Tidal, Renewable>(m, "Tidal")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, TidalInputs, std::vector<double>*>())
     .def("handleReplacement", &Tidal::handleReplacement)
+    .def("getNormalizedResponseKey", &Tidal::getNormalizedResponseKey)
+    .def("computeNormalizedProduction", &Tidal::computeNormalizedProduction)
     .def("computeProductionkW", &Tidal::computeProductionkW)
+    .def("computeNormalizedProductionSeries", &Tidal::computeNormalizedProductionSeries)
+    .def("computeProductionSeries", &Tidal::computeProductionSeries)
     .def("commit", &Tidal::commit);
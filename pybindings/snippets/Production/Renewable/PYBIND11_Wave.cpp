@@ -77,6 +77,15 @@ pybind11::class_<WaveInputs>(m, "WaveInputs")
         "path_2_normalized_performance_matrix",
         &WaveInputs::path_2_normalized_performance_matrix
     )
+    .def_readwrite("use_sea_state_memo", &WaveInputs::use_sea_state_memo)
+    .def_readwrite(
+        "memo_resolution_significant_wave_height_m",
+        &WaveInputs::memo_resolution_significant_wave_height_m
+    )
+    .def_readwrite(
+        "memo_resolution_energy_period_s",
+        &WaveInputs::memo_resolution_energy_period_s
+    )
     
     .def(pybind11::init());
 
@@ -89,6 +98,7 @@ pybind11::class_<Wave, Renewable>(m, "Wave")
     .def_readwrite("design_energy_period_s", &Wave::design_energy_period_s)
     .def_readwrite("power_model", &Wave::power_model)
     .def_readwrite("power_model_string", &Wave::power_model_string)
+    .def_readwrite("use_sea_state_memo", &Wave::use_sea_state_memo)
     
     .def_readwrite("type_str", &Production::type_str)
     .def_readwrite("capacity_kW", &Production::capacity_kW)
@@ -97,5 +107,9 @@ pybind11::class_<Wave, Renewable>(m, "Wave")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, WaveInputs, std::vector<double>*>())
     .def("handleReplacement", &Wave::handleReplacement)
+    .def("getNormalizedResponseKey", &Wave::getNormalizedResponseKey)
+    .def("computeNormalizedProduction", &Wave::computeNormalizedProduction)
     .def("computeProductionkW", &Wave::computeProductionkW)
+    .def("computeNormalizedProductionSeries", &Wave::computeNormalizedProductionSeries)
+    .def("computeProductionSeries", &Wave::computeProductionSeries)
     .def("commit", &Wave::commit);
@@ -68,13 +68,27 @@ pybind11::class_<WindInputs>(m, "WindInputs")
         &WindInputs::operation_maintenance_cost_kWh
     )
     .def_readwrite("design_speed_ms", &WindInputs::design_speed_ms)
+    .def_readwrite("n_turbines", &WindInputs::n_turbines)
+    .def_readwrite("turbine_factor_vec", &WindInputs::turbine_factor_vec)
     .def_readwrite("power_model", &WindInputs::power_model)
+    .def_readwrite(
+        "path_2_normalized_power_curve",
+        &WindInputs::path_2_normalized_power_curve
+    )
+    .def_readwrite(
+        "power_curve_resample_points",
+        &WindInputs::power_curve_resample_points
+    )
     
     .def(pybind11::init());
 
 
 pybind11::class_<Wind, Renewable>(m, "Wind")
     .def_readwrite("design_speed_ms", &Wind::design_speed_ms)
+    .def_readwrite("n_turbines", &Wind::n_turbines)
+    .def_readwrite("turbine_capacity_kW", &Wind::turbine_capacity_kW)
+    .def_readwrite("turbine_factor_vec", &Wind::turbine_factor_vec)
+    .def_readwrite("mean_turbine_factor", &Wind::mean_turbine_factor)
     .def_readwrite("power_model", &Wind::power_model)
     .def_readwrite("power_model_string", &Wind::power_model_string)
     
@@ -85,5 +99,12 @@ pybind11::class_<Wind, Renewable>(m, "Wind")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, WindInputs, std::vector<double>*>())
     .def("handleReplacement", &Wind::handleReplacement)
+    .def("getNormalizedResponseKey", &Wind::getNormalizedResponseKey)
+    .def("computeNormalizedProduction", &Wind::computeNormalizedProduction)
+    .def("scaleNormalizedProductionkW", &Wind::scaleNormalizedProductionkW)
     .def("computeProductionkW", &Wind::computeProductionkW)
+    .def("computeNormalizedProductionSeries", &Wind::computeNormalizedProductionSeries)
+    .def("scaleNormalizedProductionSeries", &Wind::scaleNormalizedProductionSeries)
+    .def("computeProductionSeries", &Wind::computeProductionSeries)
+    .def("getTurbineProductionkW", &Wind::getTurbineProductionkW)
     .def("commit", &Wind::commit);
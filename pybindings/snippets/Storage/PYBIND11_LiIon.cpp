@@ -72,6 +72,11 @@ pybind11::class_<LiIonInputs>(m, "LiIonInputs")
     .def_readwrite("degradation_s_cal", &LiIonInputs::degradation_s_cal)
     .def_readwrite("gas_constant_JmolK", &LiIonInputs::gas_constant_JmolK)
     .def_readwrite("gas_constant_JmolK", &LiIonInputs::gas_constant_JmolK)
+    .def_readwrite("fast_degradation", &LiIonInputs::fast_degradation)
+    .def_readwrite(
+        "degradation_eval_interval_hrs",
+        &LiIonInputs::degradation_eval_interval_hrs
+    )
     
     .def(pybind11::init());
 
@@ -91,6 +96,11 @@ pybind11::class_<LiIon, Storage>(m, "LiIon")
     .def_readwrite("degradation_s_cal", &LiIon::degradation_s_cal)
     .def_readwrite("gas_constant_JmolK", &LiIon::gas_constant_JmolK)
     .def_readwrite("temperature_K", &LiIon::temperature_K)
+    .def_readwrite("fast_degradation", &LiIon::fast_degradation)
+    .def_readwrite(
+        "degradation_eval_interval_hrs",
+        &LiIon::degradation_eval_interval_hrs
+    )
     .def_readwrite("init_SOC", &LiIon::init_SOC)
     .def_readwrite("min_SOC", &LiIon::min_SOC)
     .def_readwrite("hysteresis_SOC", &LiIon::hysteresis_SOC)
@@ -107,6 +117,7 @@ pybind11::class_<LiIon, Storage>(m, "LiIon")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, LiIonInputs>())
     .def("handleReplacement", &LiIon::handleReplacement)
+    .def("resetWindow", &LiIon::resetWindow)
     .def("getAvailablekW", &LiIon::getAvailablekW)
     .def("getAcceptablekW", &LiIon::getAcceptablekW)
     .def("commitCharge", &LiIon::commitCharge)
@@ -70,6 +70,7 @@ pybind11::class_<Storage>(m, "Storage")
     .def_readwrite("print_flag", &Storage::print_flag)
     .def_readwrite("is_depleted", &Storage::is_depleted)
     .def_readwrite("is_sunk", &Storage::is_sunk)
+    .def_readwrite("fast_kernels", &Storage::fast_kernels)
     .def_readwrite("n_points", &Storage::n_points)
     .def_readwrite("n_replacements", &Storage::n_replacements)
     .def_readwrite("n_years", &Storage::n_years)
@@ -104,6 +105,7 @@ pybind11::class_<Storage>(m, "Storage")
     .def(pybind11::init<>())
     .def(pybind11::init<int, double, StorageInputs>())
     .def("handleReplacement", &Storage::handleReplacement)
+    .def("resetWindow", &Storage::resetWindow)
     .def("computeEconomics", &Storage::computeEconomics)
     .def("getAvailablekW", &Storage::getAvailablekW)
     .def("getAcceptablekW", &Storage::getAcceptablekW)
@@ -51,6 +51,64 @@
 
 // ======== PRIVATE ================================================================= //
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __loadBoundResources(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+///         Resources* resources_ptr
+///     )
+///
+/// \brief Helper method to load every (lazily registered) resource which is actually
+///     bound to an asset (see getBoundResourceKeys()). Resources which are registered
+///     but not bound to any asset are never read.
+///
+/// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
+///
+/// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
+///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model (may be null).
+///
+/// \param resources_ptr A pointer to the Resources component of the Model.
+///
+
+void Controller :: __loadBoundResources(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<Renewable*>* renewable_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+    Resources* resources_ptr
+)
+{
+    //  1. get bound resource keys
+    std::vector<int> resource_keys_1D;
+    std::vector<int> resource_keys_2D;
+    
+    this->getBoundResourceKeys(
+        renewable_ptr_vec_ptr,
+        noncombustion_ptr_vec_ptr,
+        &resource_keys_1D,
+        &resource_keys_2D
+    );
+    
+    //  2. load bound resources
+    for (size_t i = 0; i < resource_keys_1D.size(); i++) {
+        resources_ptr->loadResource1D(resource_keys_1D[i], electrical_load_ptr);
+    }
+    
+    for (size_t i = 0; i < resource_keys_2D.size(); i++) {
+        resources_ptr->loadResource2D(resource_keys_2D[i], electrical_load_ptr);
+    }
+    
+    return;
+}   /* __loadBoundResources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -67,6 +125,13 @@
 /// negative net load indicates a surplus of Renewable production, and a positive
 /// net load indicates a deficit of Renewable production.
 ///
+/// Production is computed series by series (see Renewable::computeProductionSeries()),
+/// so that there is one call per asset per run, rather than one per asset per point in
+/// time. Assets which share a normalized response (see
+/// Renewable::getNormalizedResponseKey()), e.g. candidates which differ only in
+/// capacity, share one normalized production series, which is then scaled by each
+/// asset. This gives the same production as evaluating every asset on its own.
+///
 /// \param electrical_load_ptr A pointer to the ElectricalLoad component of the Model.
 ///
 /// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
@@ -80,34 +145,75 @@ void Controller :: __computeRenewableProduction(
     Resources* resources_ptr
 )
 {
-    double dt_hrs = 0;
-    double load_kW = 0;
-    double net_load_kW = 0;
-    double production_kW = 0;
+    int n_points = electrical_load_ptr->n_points;
+    int n_assets = renewable_ptr_vec_ptr->size();
     
     Renewable* renewable_ptr;
     
-    for (int timestep = 0; timestep < electrical_load_ptr->n_points; timestep++) {
-        dt_hrs = electrical_load_ptr->dt_vec_hrs[timestep];
-        load_kW = electrical_load_ptr->load_vec_kW[timestep];
-        net_load_kW = load_kW;
+    //  1. group assets by normalized response (each asset records the index of the
+    //     first asset sharing its response, or -1 if its production is not shareable)
+    std::vector<int> response_leader_vec(n_assets, -1);
+    std::map<std::string, int> response_leader_map;
+    
+    for (int asset = 0; asset < n_assets; asset++) {
+        std::string response_key =
+            renewable_ptr_vec_ptr->at(asset)->getNormalizedResponseKey();
         
-        for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
-            renewable_ptr = renewable_ptr_vec_ptr->at(asset);
-            
-            production_kW = this->__getRenewableProduction(
-                timestep,
-                dt_hrs,
+        if (response_key.empty()) {
+            continue;
+        }
+        
+        if (response_leader_map.count(response_key) == 0) {
+            response_leader_map[response_key] = asset;
+        }
+        
+        response_leader_vec[asset] = response_leader_map[response_key];
+    }
+    
+    //  2. init net load
+    for (int timestep = 0; timestep < n_points; timestep++) {
+        this->net_load_vec_kW[timestep] = electrical_load_ptr->load_vec_kW[timestep];
+    }
+    
+    //  3. compute and record production (series by series), net load
+    std::vector<double> production_vec_kW;
+    std::map<int, std::vector<double>> normalized_production_map;
+    
+    for (int asset = 0; asset < n_assets; asset++) {
+        renewable_ptr = renewable_ptr_vec_ptr->at(asset);
+        
+        int leader = response_leader_vec[asset];
+        
+        if (leader < 0) {
+            this->__getRenewableProductionSeries(
+                n_points,
                 renewable_ptr,
-                resources_ptr
+                resources_ptr,
+                &production_vec_kW
             );
-            
-            renewable_ptr->production_vec_kW[timestep] = production_kW;
+        }
         
-            net_load_kW -= production_kW;
+        else {
+            if (leader == asset) {
+                this->__getRenewableNormalizedProductionSeries(
+                    n_points,
+                    renewable_ptr,
+                    resources_ptr,
+                    &(normalized_production_map[asset])
+                );
+            }
+            
+            renewable_ptr->scaleNormalizedProductionSeries(
+                &(normalized_production_map[leader]),
+                &production_vec_kW
+            );
         }
         
-        this->net_load_vec_kW[timestep] = net_load_kW;
+        for (int timestep = 0; timestep < n_points; timestep++) {
+            renewable_ptr->production_vec_kW[timestep] = production_vec_kW[timestep];
+            
+            this->net_load_vec_kW[timestep] -= production_vec_kW[timestep];
+        }
     }
     
     return;
@@ -237,115 +343,166 @@ void Controller :: __constructCombustionMap(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Controller :: __getRenewableProduction(
-///         int timestep,
-///         double dt_hrs,
+/// \fn void Controller :: __getRenewableProductionSeries(
+///         int n_points,
 ///         Renewable* renewable_ptr,
-///         Resources* resources_ptr
+///         Resources* resources_ptr,
+///         std::vector<double>* production_vec_kW_ptr
 ///     )
 ///
-/// \brief Helper method to compute the production from the given Renewable asset at
-///     the given point in time.
-///
-/// \param timestep The current time step of the Model run.
+/// \brief Helper method to compute the production series of the given Renewable asset
+///     over the modelling time series.
 ///
-/// \param dt_hrs The interval of time [hrs] associated with the action.
+/// \param n_points The number of points in the modelling time series.
 ///
 /// \param renewable_ptr A pointer to the Renewable asset.
 ///
 /// \param resources_ptr A pointer to the Resources component of the Model.
 ///
-/// \return The production [kW] of the Renewable asset.
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     series of the Renewable asset is written.
 ///
 
-double Controller :: __getRenewableProduction(
-    int timestep,
-    double dt_hrs,
+void Controller :: __getRenewableProductionSeries(
+    int n_points,
     Renewable* renewable_ptr,
-    Resources* resources_ptr
+    Resources* resources_ptr,
+    std::vector<double>* production_vec_kW_ptr
 )
 {
-    double production_kW = 0;
-    
     switch (renewable_ptr->type) {
-        case (RenewableType :: SOLAR): {
-            double resource_value = 0;
-            
-            if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
+        case (RenewableType :: WAVE): {
+            //  a given production time series override needs no resource
+            if (renewable_ptr->normalized_production_series_given) {
+                std::vector<std::vector<double>> null_resource_vec(n_points, {0, 0});
+                
+                renewable_ptr->computeProductionSeries(
+                    0,
+                    &null_resource_vec,
+                    production_vec_kW_ptr
+                );
             }
             
-            production_kW = renewable_ptr->computeProductionkW(
-                timestep,
-                dt_hrs,
-                resource_value
-            );
+            else {
+                renewable_ptr->computeProductionSeries(
+                    0,
+                    &(resources_ptr->resource_map_2D[renewable_ptr->resource_key]),
+                    production_vec_kW_ptr
+                );
+            }
             
             break;
         }
         
-        case (RenewableType :: TIDAL): {
-            double resource_value = 0;
-            
-            if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
+        case (RenewableType :: SOLAR):
+        case (RenewableType :: TIDAL):
+        case (RenewableType :: WIND): {
+            //  a given production time series override needs no resource
+            if (renewable_ptr->normalized_production_series_given) {
+                std::vector<double> null_resource_vec(n_points, 0);
+                
+                renewable_ptr->computeProductionSeries(
+                    0,
+                    &null_resource_vec,
+                    production_vec_kW_ptr
+                );
             }
             
-            production_kW = renewable_ptr->computeProductionkW(
-                timestep,
-                dt_hrs,
-                resource_value
-            );
+            else {
+                renewable_ptr->computeProductionSeries(
+                    0,
+                    &(resources_ptr->resource_map_1D[renewable_ptr->resource_key]),
+                    production_vec_kW_ptr
+                );
+            }
             
             break;
         }
         
-        case (RenewableType :: WAVE): {
-            double significant_wave_height_m = 0;
-            double energy_period_s = 0;
+        default: {
+            std::string error_str = "ERROR:  ";
+            error_str += "Controller::__getRenewableProductionSeries():  ";
+            error_str += "renewable type ";
+            error_str += std::to_string(renewable_ptr->type);
+            error_str += " not recognized";
             
-            if (not renewable_ptr->normalized_production_series_given) {
-                significant_wave_height_m =
-                    resources_ptr->resource_map_2D[renewable_ptr->resource_key][timestep][0];
-                
-                energy_period_s =
-                    resources_ptr->resource_map_2D[renewable_ptr->resource_key][timestep][1];
-            }
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::runtime_error(error_str);
             
-            production_kW = renewable_ptr->computeProductionkW(
-                timestep,
-                dt_hrs,
-                significant_wave_height_m,
-                energy_period_s
+            break;
+        }
+    }
+    
+    return;
+}   /* __getRenewableProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: __getRenewableNormalizedProductionSeries(
+///         int n_points,
+///         Renewable* renewable_ptr,
+///         Resources* resources_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Helper method to compute the normalized production series (i.e., production
+///     per unit of capacity) of the given Renewable asset over the modelling time
+///     series. Only applies to assets with a non-empty normalized response key (see
+///     Renewable::getNormalizedResponseKey()).
+///
+/// \param n_points The number of points in the modelling time series.
+///
+/// \param renewable_ptr A pointer to the Renewable asset.
+///
+/// \param resources_ptr A pointer to the Resources component of the Model.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production series of the Renewable asset is written.
+///
+
+void Controller :: __getRenewableNormalizedProductionSeries(
+    int n_points,
+    Renewable* renewable_ptr,
+    Resources* resources_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    switch (renewable_ptr->type) {
+        case (RenewableType :: WAVE): {
+            renewable_ptr->computeNormalizedProductionSeries(
+                0,
+                &(resources_ptr->resource_map_2D[renewable_ptr->resource_key]),
+                normalized_production_vec_ptr
             );
             
             break;
         }
         
+        case (RenewableType :: TIDAL):
         case (RenewableType :: WIND): {
-            double resource_value = 0;
-            
-            if (not renewable_ptr->normalized_production_series_given) {
-                resource_value =
-                    resources_ptr->resource_map_1D[renewable_ptr->resource_key][timestep];
-            }
-            
-            production_kW = renewable_ptr->computeProductionkW(
-                timestep,
-                dt_hrs,
-                resource_value
+            renewable_ptr->computeNormalizedProductionSeries(
+                0,
+                &(resources_ptr->resource_map_1D[renewable_ptr->resource_key]),
+                normalized_production_vec_ptr
             );
             
             break;
         }
         
         default: {
-            std::string error_str = "ERROR:  Controller::__getRenewableProduction():  ";
+            std::string error_str = "ERROR:  ";
+            error_str += "Controller::__getRenewableNormalizedProductionSeries():  ";
             error_str += "renewable type ";
             error_str += std::to_string(renewable_ptr->type);
-            error_str += " not recognized";
+            error_str += " has no shareable normalized response";
             
             #ifdef _WIN32
                 std::cout << error_str << std::endl;
@@ -357,8 +514,8 @@ double Controller :: __getRenewableProduction(
         }
     }
     
-    return production_kW;
-}   /* __getRenewableProduction() */
+    return;
+}   /* __getRenewableNormalizedProductionSeries() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -1579,6 +1736,96 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Controller :: getBoundResourceKeys(
+///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+///         std::vector<int>* resource_keys_1D_ptr,
+///         std::vector<int>* resource_keys_2D_ptr
+///     )
+///
+/// \brief Method to get the keys of every resource which is actually bound to an asset
+///     (i.e., of every asset not given a normalized production series). These are the
+///     resources which are loaded by init() (or, if streaming, which are streamed; see
+///     Resources::openResourceStreams()).
+///
+/// \param renewable_ptr_vec_ptr A pointer to the Renewable pointer vector of the Model.
+///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model (may be null).
+///
+/// \param resource_keys_1D_ptr A pointer to the vector to which bound 1D resource keys
+///     are written (without repetition).
+///
+/// \param resource_keys_2D_ptr A pointer to the vector to which bound 2D resource keys
+///     are written (without repetition).
+///
+
+void Controller :: getBoundResourceKeys(
+    std::vector<Renewable*>* renewable_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr,
+    std::vector<int>* resource_keys_1D_ptr,
+    std::vector<int>* resource_keys_2D_ptr
+)
+{
+    resource_keys_1D_ptr->clear();
+    resource_keys_2D_ptr->clear();
+    
+    //  1. Renewable assets
+    for (size_t asset = 0; asset < renewable_ptr_vec_ptr->size(); asset++) {
+        Renewable* renewable_ptr = renewable_ptr_vec_ptr->at(asset);
+        
+        if (renewable_ptr->normalized_production_series_given) {
+            continue;
+        }
+        
+        std::vector<int>* resource_keys_ptr = resource_keys_1D_ptr;
+        
+        if (renewable_ptr->type == RenewableType :: WAVE) {
+            resource_keys_ptr = resource_keys_2D_ptr;
+        }
+        
+        if (
+            std::find(
+                resource_keys_ptr->begin(),
+                resource_keys_ptr->end(),
+                renewable_ptr->resource_key
+            ) == resource_keys_ptr->end()
+        ) {
+            resource_keys_ptr->push_back(renewable_ptr->resource_key);
+        }
+    }
+    
+    //  2. Noncombustion assets
+    if (noncombustion_ptr_vec_ptr != nullptr) {
+        for (size_t asset = 0; asset < noncombustion_ptr_vec_ptr->size(); asset++) {
+            Noncombustion* noncombustion_ptr = noncombustion_ptr_vec_ptr->at(asset);
+            
+            if (noncombustion_ptr->normalized_production_series_given) {
+                continue;
+            }
+            
+            if (
+                std::find(
+                    resource_keys_1D_ptr->begin(),
+                    resource_keys_1D_ptr->end(),
+                    noncombustion_ptr->resource_key
+                ) == resource_keys_1D_ptr->end()
+            ) {
+                resource_keys_1D_ptr->push_back(noncombustion_ptr->resource_key);
+            }
+        }
+    }
+    
+    return;
+}   /* getBoundResourceKeys() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1586,7 +1833,8 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 ///         ElectricalLoad* electrical_load_ptr,
 ///         std::vector<Renewable*>* renewable_ptr_vec_ptr,
 ///         Resources* resources_ptr,
-///         std::vector<Combustion*>* combustion_ptr_vec_ptr
+///         std::vector<Combustion*>* combustion_ptr_vec_ptr,
+///         std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 ///     )
 ///
 /// \brief Method to initialize the Controller component of the Model.
@@ -1599,12 +1847,16 @@ void Controller :: setLoadReserveRatio(double load_reserve_ratio)
 ///
 /// \param combustion_ptr_vec_ptr A pointer to the Combustion pointer vector of the Model.
 ///
+/// \param noncombustion_ptr_vec_ptr A pointer to the Noncombustion pointer vector of
+///     the Model (may be null, in which case no Noncombustion resources are loaded).
+///
 
 void Controller :: init(
     ElectricalLoad* electrical_load_ptr,
     std::vector<Renewable*>* renewable_ptr_vec_ptr,
     Resources* resources_ptr,
-    std::vector<Combustion*>* combustion_ptr_vec_ptr
+    std::vector<Combustion*>* combustion_ptr_vec_ptr,
+    std::vector<Noncombustion*>* noncombustion_ptr_vec_ptr
 )
 {
     //  1. init vector attributes
@@ -1613,14 +1865,22 @@ void Controller :: init(
     this->missed_firm_dispatch_vec_kW.resize(electrical_load_ptr->n_points, 0);
     this->missed_spinning_reserve_vec_kW.resize(electrical_load_ptr->n_points, 0);
     
-    //  2. compute Renewable production
+    //  2. load (lazily registered) resources bound to assets
+    this->__loadBoundResources(
+        electrical_load_ptr,
+        renewable_ptr_vec_ptr,
+        noncombustion_ptr_vec_ptr,
+        resources_ptr
+    );
+    
+    //  3. compute Renewable production
     this->__computeRenewableProduction(
         electrical_load_ptr,
         renewable_ptr_vec_ptr,
         resources_ptr
     );
     
-    //  3. construct Combustion table
+    //  4. construct Combustion table
     this->__constructCombustionMap(combustion_ptr_vec_ptr);
     
     return;
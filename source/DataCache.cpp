@@ -0,0 +1,782 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file DataCache.cpp
+///
+/// \brief Implementation file for the DataCache class.
+///
+/// A process-wide, path-keyed cache of parsed normalized production series and
+/// interpolation tables, invalidated by file last write time (and size).
+///
+
+
+#include "../header/DataCache.h"
+
+
+std::mutex DataCache :: cache_mutex;
+
+std::map<std::string, DataCacheStamp> DataCache :: stamp_map;
+
+std::map<std::string, std::shared_ptr<const NormalizedSeriesData>>
+    DataCache :: normalized_series_map;
+std::map<std::string, std::shared_ptr<const InterpolatorStruct1D>>
+    DataCache :: interp_map_1D;
+std::map<std::string, std::shared_ptr<const InterpolatorStruct2D>>
+    DataCache :: interp_map_2D;
+std::map<std::string, std::shared_ptr<const SolarEphemerisData>>
+    DataCache :: solar_ephemeris_map;
+std::map<std::string, std::shared_ptr<SeaStateMemoData>>
+    DataCache :: sea_state_memo_map;
+
+bool DataCache :: enabled = true;
+
+int DataCache :: n_disk_reads = 0;
+int DataCache :: n_cache_hits = 0;
+int DataCache :: n_derived_builds = 0;
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string DataCache :: __getKey(std::string data_kind, std::string path_2_data)
+///
+/// \brief Helper method to construct a cache key from the kind of data and the
+///     (normalized, absolute) path to it. The kind is included so that the same file
+///     may be cached as different kinds of data without collision.
+///
+/// \param data_kind A string identifying the kind of data being cached.
+///
+/// \param path_2_data The path (either relative or absolute) to the data.
+///
+/// \return The cache key.
+///
+
+std::string DataCache :: __getKey(std::string data_kind, std::string path_2_data)
+{
+    std::error_code error_code;
+    std::filesystem::path abs_path = std::filesystem::absolute(path_2_data, error_code);
+    
+    if (error_code) {
+        return data_kind + "::" + path_2_data;
+    }
+    
+    return data_kind + "::" + abs_path.lexically_normal().string();
+}   /* __getKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool DataCache :: __getStamp(std::string path_2_data, DataCacheStamp* stamp_ptr)
+///
+/// \brief Helper method to get the current on-disk state of the given file.
+///
+/// \param path_2_data The path (either relative or absolute) to the data.
+///
+/// \param stamp_ptr A pointer to the DataCacheStamp to be written to.
+///
+/// \return A boolean which indicates whether the file was found (if not, the request
+///     bypasses the cache, so that the reader can raise its usual error).
+///
+
+bool DataCache :: __getStamp(std::string path_2_data, DataCacheStamp* stamp_ptr)
+{
+    std::error_code error_code;
+    
+    if (not std::filesystem::is_regular_file(path_2_data, error_code)) {
+        return false;
+    }
+    
+    stamp_ptr->last_write_time =
+        std::filesystem::last_write_time(path_2_data, error_code);
+    
+    if (error_code) {
+        return false;
+    }
+    
+    stamp_ptr->file_size = std::filesystem::file_size(path_2_data, error_code);
+    
+    if (error_code) {
+        return false;
+    }
+    
+    return true;
+}   /* __getStamp() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool DataCache :: __isCurrent(std::string key, const DataCacheStamp& stamp)
+///
+/// \brief Helper method to check whether the cached entry under the given key was read
+///     from a file in the given on-disk state. Assumes cache_mutex is held.
+///
+/// \param key The cache key.
+///
+/// \param stamp The current on-disk state of the file.
+///
+/// \return A boolean which indicates whether the cached entry is current.
+///
+
+bool DataCache :: __isCurrent(std::string key, const DataCacheStamp& stamp)
+{
+    std::map<std::string, DataCacheStamp>::iterator iter = DataCache::stamp_map.find(key);
+    
+    if (iter == DataCache::stamp_map.end()) {
+        return false;
+    }
+    
+    return (
+        iter->second.last_write_time == stamp.last_write_time and
+        iter->second.file_size == stamp.file_size
+    );
+}   /* __isCurrent() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const NormalizedSeriesData> DataCache :: getNormalizedSeries(
+///         std::string path_2_data,
+///         std::function<NormalizedSeriesData(void)> read_function
+///     )
+///
+/// \brief Method to get the normalized production series at the given path, either
+///     from the cache (if current) or by calling the given read function.
+///
+/// \param path_2_data The path (either relative or absolute) to the data.
+///
+/// \param read_function A function which reads and parses the data from disk.
+///
+/// \return A reference counted pointer to the (shared, read only) parsed data.
+///
+
+std::shared_ptr<const NormalizedSeriesData> DataCache :: getNormalizedSeries(
+    std::string path_2_data,
+    std::function<NormalizedSeriesData(void)> read_function
+)
+{
+    //  1. get key and current on-disk state
+    std::string key = DataCache::__getKey("normalized_series", path_2_data);
+    
+    DataCacheStamp stamp;
+    bool stamp_found = DataCache::__getStamp(path_2_data, &stamp);
+    
+    //  2. serve from cache (if enabled, cached, and current)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (
+            DataCache::enabled and
+            stamp_found and
+            DataCache::normalized_series_map.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            DataCache::n_cache_hits++;
+            return DataCache::normalized_series_map[key];
+        }
+    }
+    
+    //  3. otherwise, read from disk (outside of the lock, so that reads of distinct
+    //     data are not serialized)
+    std::shared_ptr<const NormalizedSeriesData> data_ptr =
+        std::make_shared<const NormalizedSeriesData>(read_function());
+    
+    //  4. store (if enabled and file found), deferring to any current entry stored by
+    //     another thread in the meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_disk_reads++;
+    
+    if (DataCache::enabled and stamp_found) {
+        if (
+            DataCache::normalized_series_map.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            return DataCache::normalized_series_map[key];
+        }
+        
+        DataCache::normalized_series_map[key] = data_ptr;
+        DataCache::stamp_map[key] = stamp;
+    }
+    
+    return data_ptr;
+}   /* getNormalizedSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct1D> DataCache :: getInterpolatorData1D(
+///         std::string path_2_data,
+///         std::function<InterpolatorStruct1D(void)> read_function
+///     )
+///
+/// \brief Method to get the 1D interpolation table at the given path, either from the
+///     cache (if current) or by calling the given read function.
+///
+/// \param path_2_data The path (either relative or absolute) to the data.
+///
+/// \param read_function A function which reads and parses the data from disk.
+///
+/// \return A reference counted pointer to the (shared, read only) parsed data.
+///
+
+std::shared_ptr<const InterpolatorStruct1D> DataCache :: getInterpolatorData1D(
+    std::string path_2_data,
+    std::function<InterpolatorStruct1D(void)> read_function
+)
+{
+    //  1. get key and current on-disk state
+    std::string key = DataCache::__getKey("interp_1D", path_2_data);
+    
+    DataCacheStamp stamp;
+    bool stamp_found = DataCache::__getStamp(path_2_data, &stamp);
+    
+    //  2. serve from cache (if enabled, cached, and current)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (
+            DataCache::enabled and
+            stamp_found and
+            DataCache::interp_map_1D.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            DataCache::n_cache_hits++;
+            return DataCache::interp_map_1D[key];
+        }
+    }
+    
+    //  3. otherwise, read from disk (outside of the lock, so that reads of distinct
+    //     data are not serialized)
+    std::shared_ptr<const InterpolatorStruct1D> data_ptr =
+        std::make_shared<const InterpolatorStruct1D>(read_function());
+    
+    //  4. store (if enabled and file found), deferring to any current entry stored by
+    //     another thread in the meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_disk_reads++;
+    
+    if (DataCache::enabled and stamp_found) {
+        if (
+            DataCache::interp_map_1D.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            return DataCache::interp_map_1D[key];
+        }
+        
+        DataCache::interp_map_1D[key] = data_ptr;
+        DataCache::stamp_map[key] = stamp;
+    }
+    
+    return data_ptr;
+}   /* getInterpolatorData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct2D> DataCache :: getInterpolatorData2D(
+///         std::string path_2_data,
+///         std::function<InterpolatorStruct2D(void)> read_function
+///     )
+///
+/// \brief Method to get the 2D interpolation table at the given path, either from the
+///     cache (if current) or by calling the given read function.
+///
+/// \param path_2_data The path (either relative or absolute) to the data.
+///
+/// \param read_function A function which reads and parses the data from disk.
+///
+/// \return A reference counted pointer to the (shared, read only) parsed data.
+///
+
+std::shared_ptr<const InterpolatorStruct2D> DataCache :: getInterpolatorData2D(
+    std::string path_2_data,
+    std::function<InterpolatorStruct2D(void)> read_function
+)
+{
+    //  1. get key and current on-disk state
+    std::string key = DataCache::__getKey("interp_2D", path_2_data);
+    
+    DataCacheStamp stamp;
+    bool stamp_found = DataCache::__getStamp(path_2_data, &stamp);
+    
+    //  2. serve from cache (if enabled, cached, and current)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (
+            DataCache::enabled and
+            stamp_found and
+            DataCache::interp_map_2D.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            DataCache::n_cache_hits++;
+            return DataCache::interp_map_2D[key];
+        }
+    }
+    
+    //  3. otherwise, read from disk (outside of the lock, so that reads of distinct
+    //     data are not serialized)
+    std::shared_ptr<const InterpolatorStruct2D> data_ptr =
+        std::make_shared<const InterpolatorStruct2D>(read_function());
+    
+    //  4. store (if enabled and file found), deferring to any current entry stored by
+    //     another thread in the meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_disk_reads++;
+    
+    if (DataCache::enabled and stamp_found) {
+        if (
+            DataCache::interp_map_2D.count(key) > 0 and
+            DataCache::__isCurrent(key, stamp)
+        ) {
+            return DataCache::interp_map_2D[key];
+        }
+        
+        DataCache::interp_map_2D[key] = data_ptr;
+        DataCache::stamp_map[key] = stamp;
+    }
+    
+    return data_ptr;
+}   /* getInterpolatorData2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const InterpolatorStruct1D> DataCache :: getDerivedData1D(
+///         std::string derived_key,
+///         std::function<InterpolatorStruct1D(void)> build_function
+///     )
+///
+/// \brief Method to get the derived 1D interpolation table associated with the given
+///     key, either from the cache or by calling the given build function. Unlike file
+///     backed entries, derived entries are never stale; the key must encode every
+///     parameter that the built data depends on.
+///
+/// \param derived_key A key which uniquely identifies the derived data.
+///
+/// \param build_function A function which builds the data.
+///
+/// \return A reference counted pointer to the (shared, read only) built data.
+///
+
+std::shared_ptr<const InterpolatorStruct1D> DataCache :: getDerivedData1D(
+    std::string derived_key,
+    std::function<InterpolatorStruct1D(void)> build_function
+)
+{
+    //  1. get key
+    std::string key = "derived_1D::" + derived_key;
+    
+    //  2. serve from cache (if enabled and cached)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (DataCache::enabled and DataCache::interp_map_1D.count(key) > 0) {
+            DataCache::n_cache_hits++;
+            return DataCache::interp_map_1D[key];
+        }
+    }
+    
+    //  3. otherwise, build (outside of the lock, so that builds of distinct data are
+    //     not serialized, and so that the build function may itself use the cache)
+    std::shared_ptr<const InterpolatorStruct1D> data_ptr =
+        std::make_shared<const InterpolatorStruct1D>(build_function());
+    
+    //  4. store (if enabled), deferring to any entry stored by another thread in the
+    //     meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_derived_builds++;
+    
+    if (DataCache::enabled) {
+        if (DataCache::interp_map_1D.count(key) > 0) {
+            return DataCache::interp_map_1D[key];
+        }
+        
+        DataCache::interp_map_1D[key] = data_ptr;
+    }
+    
+    return data_ptr;
+}   /* getDerivedData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<const SolarEphemerisData> DataCache :: getSolarEphemeris(
+///         std::string site_key,
+///         const std::vector<double>* time_vec_hrs_ptr,
+///         std::function<SolarEphemerisData(void)> build_function
+///     )
+///
+/// \brief Method to get the solar ephemeris of the given site over the given time
+///     series, either from the cache or by calling the given build function. One
+///     ephemeris is held per site; a cached ephemeris is served only if its time series
+///     is exactly the one given, and is otherwise replaced (so that, e.g., streaming
+///     windows do not accumulate in the cache).
+///
+/// \param site_key A key which uniquely identifies the site (but not the time series).
+///
+/// \param time_vec_hrs_ptr A pointer to the time series over which the ephemeris is
+///     required.
+///
+/// \param build_function A function which builds the ephemeris over the given time
+///     series.
+///
+/// \return A reference counted pointer to the (shared, read only) built ephemeris.
+///
+
+std::shared_ptr<const SolarEphemerisData> DataCache :: getSolarEphemeris(
+    std::string site_key,
+    const std::vector<double>* time_vec_hrs_ptr,
+    std::function<SolarEphemerisData(void)> build_function
+)
+{
+    //  1. get key
+    std::string key = "solar_ephemeris::" + site_key;
+    
+    //  2. serve from cache (if enabled, cached, and over the given time series)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (
+            DataCache::enabled and
+            DataCache::solar_ephemeris_map.count(key) > 0 and
+            DataCache::solar_ephemeris_map[key]->time_vec_hrs == *time_vec_hrs_ptr
+        ) {
+            DataCache::n_cache_hits++;
+            return DataCache::solar_ephemeris_map[key];
+        }
+    }
+    
+    //  3. otherwise, build (outside of the lock, so that builds of distinct data are
+    //     not serialized, and so that the build function may itself use the cache)
+    std::shared_ptr<const SolarEphemerisData> data_ptr =
+        std::make_shared<const SolarEphemerisData>(build_function());
+    
+    //  4. store (if enabled), replacing any stale entry, but deferring to any current
+    //     entry stored by another thread in the meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_derived_builds++;
+    
+    if (DataCache::enabled) {
+        if (
+            DataCache::solar_ephemeris_map.count(key) > 0 and
+            DataCache::solar_ephemeris_map[key]->time_vec_hrs == *time_vec_hrs_ptr
+        ) {
+            return DataCache::solar_ephemeris_map[key];
+        }
+        
+        DataCache::solar_ephemeris_map[key] = data_ptr;
+    }
+    
+    return data_ptr;
+}   /* getSolarEphemeris() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_ptr<SeaStateMemoData> DataCache :: getSeaStateMemo(
+///         std::string derived_key,
+///         std::function<SeaStateMemoData(void)> build_function
+///     )
+///
+/// \brief Method to get the sea state memo associated with the given key, either from
+///     the cache or by calling the given build function. As with getDerivedData1D(),
+///     entries are never stale; the key must encode the performance matrix and the
+///     resolution of the memo. Note that the memo is handed out writeable, since it is
+///     filled lazily by the assets which share it.
+///
+/// \param derived_key A key which uniquely identifies the memo.
+///
+/// \param build_function A function which builds the (unfilled) memo.
+///
+/// \return A reference counted pointer to the (shared) memo.
+///
+
+std::shared_ptr<SeaStateMemoData> DataCache :: getSeaStateMemo(
+    std::string derived_key,
+    std::function<SeaStateMemoData(void)> build_function
+)
+{
+    //  1. get key
+    std::string key = "sea_state_memo::" + derived_key;
+    
+    //  2. serve from cache (if enabled and cached)
+    {
+        std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+        
+        if (DataCache::enabled and DataCache::sea_state_memo_map.count(key) > 0) {
+            DataCache::n_cache_hits++;
+            return DataCache::sea_state_memo_map[key];
+        }
+    }
+    
+    //  3. otherwise, build (outside of the lock, so that builds of distinct data are
+    //     not serialized, and so that the build function may itself use the cache)
+    std::shared_ptr<SeaStateMemoData> data_ptr =
+        std::make_shared<SeaStateMemoData>(build_function());
+    
+    //  4. store (if enabled), deferring to any entry stored by another thread in the
+    //     meantime
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::n_derived_builds++;
+    
+    if (DataCache::enabled) {
+        if (DataCache::sea_state_memo_map.count(key) > 0) {
+            return DataCache::sea_state_memo_map[key];
+        }
+        
+        DataCache::sea_state_memo_map[key] = data_ptr;
+    }
+    
+    return data_ptr;
+}   /* getSeaStateMemo() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int DataCache :: getNumEntries(void)
+///
+/// \brief Method to get the number of entries currently held in the cache.
+///
+/// \return The number of entries currently held in the cache.
+///
+
+int DataCache :: getNumEntries(void)
+{
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    return (
+        DataCache::normalized_series_map.size() +
+        DataCache::interp_map_1D.size() +
+        DataCache::interp_map_2D.size() +
+        DataCache::solar_ephemeris_map.size() +
+        DataCache::sea_state_memo_map.size()
+    );
+}   /* getNumEntries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void DataCache :: prune(void)
+///
+/// \brief Method to release every entry which is no longer borrowed outside of the
+///     cache (i.e., whose reference count is one). Entries which are copied out by
+///     their users (normalized production series, and tables added by way of
+///     Interpolator::addData1D() or Interpolator::addData2D()) are never held, and so
+///     are always released; borrowed entries (see Interpolator::borrowData1D() and
+///     Interpolator::borrowData2D(), solar ephemerides, and sea state memos) are kept
+///     for as long as they are held.
+///
+
+void DataCache :: prune(void)
+{
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    //  1. prune normalized series
+    for (
+        std::map<std::string, std::shared_ptr<const NormalizedSeriesData>>::iterator iter =
+            DataCache::normalized_series_map.begin();
+        iter != DataCache::normalized_series_map.end();
+        /* iterator advanced in loop body */
+    ) {
+        if (iter->second.use_count() <= 1) {
+            DataCache::stamp_map.erase(iter->first);
+            iter = DataCache::normalized_series_map.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    //  2. prune 1D interpolation tables
+    for (
+        std::map<std::string, std::shared_ptr<const InterpolatorStruct1D>>::iterator iter =
+            DataCache::interp_map_1D.begin();
+        iter != DataCache::interp_map_1D.end();
+        /* iterator advanced in loop body */
+    ) {
+        if (iter->second.use_count() <= 1) {
+            DataCache::stamp_map.erase(iter->first);
+            iter = DataCache::interp_map_1D.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    //  3. prune 2D interpolation tables
+    for (
+        std::map<std::string, std::shared_ptr<const InterpolatorStruct2D>>::iterator iter =
+            DataCache::interp_map_2D.begin();
+        iter != DataCache::interp_map_2D.end();
+        /* iterator advanced in loop body */
+    ) {
+        if (iter->second.use_count() <= 1) {
+            DataCache::stamp_map.erase(iter->first);
+            iter = DataCache::interp_map_2D.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    //  4. prune solar ephemerides
+    for (
+        std::map<std::string, std::shared_ptr<const SolarEphemerisData>>::iterator iter =
+            DataCache::solar_ephemeris_map.begin();
+        iter != DataCache::solar_ephemeris_map.end();
+        /* iterator advanced in loop body */
+    ) {
+        if (iter->second.use_count() <= 1) {
+            iter = DataCache::solar_ephemeris_map.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    //  5. prune sea state memos
+    for (
+        std::map<std::string, std::shared_ptr<SeaStateMemoData>>::iterator iter =
+            DataCache::sea_state_memo_map.begin();
+        iter != DataCache::sea_state_memo_map.end();
+        /* iterator advanced in loop body */
+    ) {
+        if (iter->second.use_count() <= 1) {
+            iter = DataCache::sea_state_memo_map.erase(iter);
+        }
+        
+        else {
+            iter++;
+        }
+    }
+    
+    return;
+}   /* prune() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void DataCache :: clear(void)
+///
+/// \brief Method to clear all entries from the cache and reset the counters. Pointers
+///     already handed out remain valid.
+///
+
+void DataCache :: clear(void)
+{
+    std::lock_guard<std::mutex> lock(DataCache::cache_mutex);
+    
+    DataCache::stamp_map.clear();
+    
+    DataCache::normalized_series_map.clear();
+    DataCache::interp_map_1D.clear();
+    DataCache::interp_map_2D.clear();
+    DataCache::solar_ephemeris_map.clear();
+    DataCache::sea_state_memo_map.clear();
+    
+    DataCache::n_disk_reads = 0;
+    DataCache::n_cache_hits = 0;
+    DataCache::n_derived_builds = 0;
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
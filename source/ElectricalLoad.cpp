@@ -60,6 +60,7 @@
 
 ElectricalLoad :: ElectricalLoad(void)
 {
+    this->clear();
     return;
 }   /* ElectricalLoad() */
 
@@ -164,12 +165,224 @@ void ElectricalLoad :: readLoadData(std::string path_2_electrical_load_time_seri
         }
     }
     
+    //  7. set window attributes (the whole time series is a single window)
+    this->n_points_total = this->n_points;
+    this->window_points = this->n_points;
+    this->window_start = 0;
+    
     return;
 }   /* readLoadData() */
 
 // ---------------------------------------------------------------------------------- //
 
 
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ElectricalLoad :: openLoadStream(
+///         std::string path_2_electrical_load_time_series,
+///         int window_points
+///     )
+///
+/// \brief Method to open an electrical load time series for streaming, in windows of
+///     (at most) window_points points. Only the current window is held in time_vec_hrs,
+///     dt_vec_hrs, and load_vec_kW, so memory is bounded by the window size rather than
+///     by the length of the time series. A single pass is first made over the file to
+///     establish n_points_total, n_years, and the load statistics. Clears and
+///     overwrites any existing attribute values, and reads in the first window.
+///
+/// \param path_2_electrical_load_time_series A string defining the path (either
+///     relative or absolute) to the given electrical load time series.
+///
+/// \param window_points The (maximum) number of points per window.
+///
+
+void ElectricalLoad :: openLoadStream(
+    std::string path_2_electrical_load_time_series,
+    int window_points
+)
+{
+    //  1. check window size
+    if (window_points <= 0) {
+        std::string error_str = "ERROR:  ElectricalLoad::openLoadStream():  ";
+        error_str += "window_points must be > 0";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. clear
+    this->clear();
+    
+    //  3. first pass (nothing stored), get number of points, number of years, and load
+    //     statistics
+    io::CSVReader<2> CSV(path_2_electrical_load_time_series);
+    
+    CSV.read_header(
+        io::ignore_extra_column,
+        "Time (since start of data) [hrs]",
+        "Electrical Load [kW]"
+    );
+    
+    double time_hrs = 0;
+    double load_kW = 0;
+    double load_sum_kW = 0;
+    
+    this->n_points_total = 0;
+    
+    this->min_load_kW = std::numeric_limits<double>::infinity();
+    this->max_load_kW = -1 * std::numeric_limits<double>::infinity();
+    
+    while (CSV.read_row(time_hrs, load_kW)) {
+        load_sum_kW += load_kW;
+        
+        this->n_points_total++;
+        
+        if (this->min_load_kW > load_kW) {
+            this->min_load_kW = load_kW;
+        }
+        
+        if (this->max_load_kW < load_kW) {
+            this->max_load_kW = load_kW;
+        }
+    }
+    
+    this->mean_load_kW = load_sum_kW / this->n_points_total;
+    
+    //  4. set number of years (assuming 8,760 hours per year)
+    this->n_years = time_hrs / 8760;
+    
+    //  5. record path and window size, then rewind (reads in first window)
+    this->path_2_electrical_load_time_series = path_2_electrical_load_time_series;
+    this->window_points = window_points;
+    this->is_streaming = true;
+    
+    this->rewindLoadStream();
+    
+    return;
+}   /* openLoadStream() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ElectricalLoad :: rewindLoadStream(void)
+///
+/// \brief Method to rewind an open electrical load stream to the start of the time
+///     series, and read in the first window.
+///
+
+void ElectricalLoad :: rewindLoadStream(void)
+{
+    //  1. (re-)open CSV reader
+    this->stream_reader_ptr = std::make_shared<io::CSVReader<2>>(
+        this->path_2_electrical_load_time_series
+    );
+    
+    this->stream_reader_ptr->read_header(
+        io::ignore_extra_column,
+        "Time (since start of data) [hrs]",
+        "Electrical Load [kW]"
+    );
+    
+    //  2. read first row as lookahead
+    this->has_lookahead = this->stream_reader_ptr->read_row(
+        this->lookahead_time_hrs,
+        this->lookahead_load_kW
+    );
+    
+    //  3. reset window, read in first window
+    this->n_points = 0;
+    this->window_start = 0;
+    this->last_dt_hrs = 0;
+    
+    this->readLoadWindow();
+    
+    return;
+}   /* rewindLoadStream() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool ElectricalLoad :: readLoadWindow(void)
+///
+/// \brief Method to advance an open electrical load stream to its next window. The
+///     time delta of the last point in each window is taken from the first point of the
+///     next window, so that dt_vec_hrs matches that of readLoadData().
+///
+/// \return A boolean which indicates whether a new window was read (false once the
+///     time series is exhausted, in which case the current window is left as is).
+///
+
+bool ElectricalLoad :: readLoadWindow(void)
+{
+    //  1. check for end of time series
+    if (not this->has_lookahead) {
+        return false;
+    }
+    
+    //  2. advance window start, clear window
+    this->window_start += this->n_points;
+    
+    this->time_vec_hrs.clear();
+    this->load_vec_kW.clear();
+    this->dt_vec_hrs.clear();
+    
+    //  3. read in window (lookahead row first)
+    while (
+        this->has_lookahead and
+        (int)this->time_vec_hrs.size() < this->window_points
+    ) {
+        this->time_vec_hrs.push_back(this->lookahead_time_hrs);
+        this->load_vec_kW.push_back(this->lookahead_load_kW);
+        
+        this->has_lookahead = this->stream_reader_ptr->read_row(
+            this->lookahead_time_hrs,
+            this->lookahead_load_kW
+        );
+    }
+    
+    this->n_points = this->time_vec_hrs.size();
+    
+    //  4. populate dt_vec_hrs
+    this->dt_vec_hrs.resize(this->n_points, 0);
+    
+    for (int i = 0; i < this->n_points - 1; i++) {
+        this->dt_vec_hrs[i] = this->time_vec_hrs[i + 1] - this->time_vec_hrs[i];
+    }
+    
+    if (this->has_lookahead) {
+        this->dt_vec_hrs[this->n_points - 1] =
+            this->lookahead_time_hrs - this->time_vec_hrs[this->n_points - 1];
+    }
+    
+    else if (this->n_points > 1) {
+        this->dt_vec_hrs[this->n_points - 1] = this->dt_vec_hrs[this->n_points - 2];
+    }
+    
+    else {
+        this->dt_vec_hrs[this->n_points - 1] = this->last_dt_hrs;
+    }
+    
+    this->last_dt_hrs = this->dt_vec_hrs[this->n_points - 1];
+    
+    return true;
+}   /* readLoadWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -180,7 +393,19 @@ void ElectricalLoad :: readLoadData(std::string path_2_electrical_load_time_seri
 
 void ElectricalLoad :: clear(void)
 {
+    this->stream_reader_ptr = nullptr;
+    
+    this->has_lookahead = false;
+    this->lookahead_time_hrs = 0;
+    this->lookahead_load_kW = 0;
+    this->last_dt_hrs = 0;
+    
+    this->is_streaming = false;
+    
     this->n_points = 0;
+    this->n_points_total = 0;
+    this->window_points = 0;
+    this->window_start = 0;
     this->n_years = 0;
     this->min_load_kW = 0;
     this->mean_load_kW = 0;
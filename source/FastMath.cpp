@@ -0,0 +1,200 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+///
+/// \file FastMath.cpp
+///
+/// \brief Implementation file for the FastMath class.
+///
+/// A class of static, polynomial approximations of the transcendental functions used
+/// by the analytic production, degradation, and economics models (fast kernels mode).
+///
+
+
+#include "../header/FastMath.h"
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double FastMath :: exp(double x)
+///
+/// \brief Method to approximate the exponential function. The argument is reduced as
+///     x = k ln(2) + r, with |r| <= ln(2) / 2 (two part ln(2), so that the reduction is
+///     exact), exp(r) is approximated by its degree 7 Taylor polynomial (truncation
+///     error < 6e-9), and the result is scaled by 2^k directly in the exponent bits.
+///
+/// \param x The argument.
+///
+/// \return An approximation of exp(x), with relative error less than
+///     FAST_MATH_MAX_RELATIVE_ERROR.
+///
+
+double FastMath :: exp(double x)
+{
+    //  1. outside of the (normal) range of the approximation, defer to std
+    if (not (x > -708 and x < 709)) {
+        return std::exp(x);
+    }
+    
+    //  2. reduce argument (adding and subtracting 1.5 * 2^52 rounds to nearest)
+    const double round_shift = 6755399441055744.0;
+    
+    double k = (x * 1.4426950408889634 + round_shift) - round_shift;
+    
+    double r = x - k * 6.93147180369123816490e-01;
+    r -= k * 1.90821492927058770002e-10;
+    
+    //  3. evaluate polynomial (Estrin's scheme, for instruction level parallelism)
+    double r2 = r * r;
+    
+    double p = (1 + r) + r2 * (
+        (1.0 / 2 + r * (1.0 / 6)) + r2 * (
+            (1.0 / 24 + r * (1.0 / 120)) + r2 * (1.0 / 720 + r * (1.0 / 5040))
+        )
+    );
+    
+    //  4. scale by 2^k
+    std::int64_t scale_bits = (std::int64_t(k) + 1023) << 52;
+    
+    double scale = 0;
+    std::memcpy(&scale, &scale_bits, sizeof(double));
+    
+    return p * scale;
+}   /* exp() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double FastMath :: log(double x)
+///
+/// \brief Method to approximate the natural logarithm. The argument is split as
+///     x = m 2^e, with m in [sqrt(1/2), sqrt(2)), and ln(m) = 2 atanh(s), with
+///     s = (m - 1) / (m + 1), is approximated by its degree 15 series in s (truncation
+///     error < 4e-14, relative). Since |ln(m)| <= |ln(x)|, the error is relative to
+///     ln(x), which is what keeps FastMath::pow() within its bound for large |y|.
+///
+/// \param x The argument.
+///
+/// \return An approximation of ln(x), with relative error less than 1e-13.
+///
+
+double FastMath :: log(double x)
+{
+    //  1. outside of the (positive, normal, finite) range, defer to std
+    if (
+        not (
+            x >= std::numeric_limits<double>::min() and
+            x <= std::numeric_limits<double>::max()
+        )
+    ) {
+        return std::log(x);
+    }
+    
+    //  2. split into mantissa and exponent
+    std::uint64_t x_bits = 0;
+    std::memcpy(&x_bits, &x, sizeof(double));
+    
+    int e = int((x_bits >> 52) & 0x7ff) - 1023;
+    
+    std::uint64_t m_bits = (x_bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    
+    double m = 0;
+    std::memcpy(&m, &m_bits, sizeof(double));
+    
+    if (m > 1.4142135623730951) {
+        m *= 0.5;
+        e++;
+    }
+    
+    //  3. evaluate series
+    double s = (m - 1) / (m + 1);
+    double s2 = s * s;
+    double s4 = s2 * s2;
+    
+    double s8 = s4 * s4;
+    
+    double p = 2 * s * (
+        ((1 + s2 * (1.0 / 3)) + s4 * (1.0 / 5 + s2 * (1.0 / 7))) + s8 * (
+            (1.0 / 9 + s2 * (1.0 / 11)) + s4 * (1.0 / 13 + s2 * (1.0 / 15))
+        )
+    );
+    
+    return e * 6.93147180559945309417e-01 + p;
+}   /* log() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double FastMath :: pow(double x, double y)
+///
+/// \brief Method to approximate x^y, as exp(y ln(x)), for x > 0. Otherwise, defers to
+///     std. The relative error of ln(x) (< 1e-13) is scaled by |y ln(x)| <= 700, and so
+///     adds less than 1e-10 to the relative error of exp().
+///
+/// \param x The base.
+///
+/// \param y The exponent.
+///
+/// \return An approximation of x^y, with relative error less than
+///     FAST_MATH_MAX_RELATIVE_ERROR (for |y * ln(x)| <= 700).
+///
+
+double FastMath :: pow(double x, double y)
+{
+    if (x > 0) {
+        return FastMath::exp(y * FastMath::log(x));
+    }
+    
+    return std::pow(x, y);
+}   /* pow() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
@@ -46,6 +46,7 @@
 
 
 #include "../header/Interpolator.h"
+#include "../header/DataCache.h"
 
 
 
@@ -63,7 +64,10 @@
 
 void Interpolator :: __checkDataKey1D(int data_key)
 {
-    if (this->interp_map_1D.count(data_key) > 0) {
+    if (
+        this->interp_map_1D.count(data_key) > 0 or
+        this->borrowed_map_1D.count(data_key) > 0
+    ) {
         std::string error_str = "ERROR:  Interpolator::addData1D()  ";
         error_str += "data key (1D) ";
         error_str += std::to_string(data_key);
@@ -95,7 +99,10 @@ void Interpolator :: __checkDataKey1D(int data_key)
 
 void Interpolator :: __checkDataKey2D(int data_key)
 {
-    if (this->interp_map_2D.count(data_key) > 0) {
+    if (
+        this->interp_map_2D.count(data_key) > 0 or
+        this->borrowed_map_2D.count(data_key) > 0
+    ) {
         std::string error_str = "ERROR:  Interpolator::addData2D()  ";
         error_str += "data key (2D) ";
         error_str += std::to_string(data_key);
@@ -118,25 +125,123 @@ void Interpolator :: __checkDataKey2D(int data_key)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: __checkBounds1D(int data_key, double interp_x)
+/// \fn InterpolatorStruct1D* Interpolator :: __getOwnedData1D(
+///         int data_key,
+///         std::string caller_str
+///     )
+///
+/// \brief Helper method to get a (writeable) pointer to the owned 1D interpolation data
+///     associated with the given key. Borrowed data is read only, and so is an error.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param caller_str The name of the calling method (for error messages).
+///
+/// \return A pointer to the associated (owned) interpolation data.
+///
+
+InterpolatorStruct1D* Interpolator :: __getOwnedData1D(
+    int data_key,
+    std::string caller_str
+)
+{
+    if (this->borrowed_map_1D.count(data_key) > 0) {
+        std::string error_str = "ERROR:  Interpolator::" + caller_str + "()  ";
+        error_str += "data key (1D) ";
+        error_str += std::to_string(data_key);
+        error_str += " is borrowed (read only)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    // throws if not registered
+    this->getHandle1D(data_key);
+    
+    return &(this->interp_map_1D[data_key]);
+}   /* __getOwnedData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorStruct2D* Interpolator :: __getOwnedData2D(
+///         int data_key,
+///         std::string caller_str
+///     )
+///
+/// \brief Helper method to get a (writeable) pointer to the owned 2D interpolation data
+///     associated with the given key. Borrowed data is read only, and so is an error.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param caller_str The name of the calling method (for error messages).
+///
+/// \return A pointer to the associated (owned) interpolation data.
+///
+
+InterpolatorStruct2D* Interpolator :: __getOwnedData2D(
+    int data_key,
+    std::string caller_str
+)
+{
+    if (this->borrowed_map_2D.count(data_key) > 0) {
+        std::string error_str = "ERROR:  Interpolator::" + caller_str + "()  ";
+        error_str += "data key (2D) ";
+        error_str += std::to_string(data_key);
+        error_str += " is borrowed (read only)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    // throws if not registered
+    this->getHandle2D(data_key);
+    
+    return &(this->interp_map_2D[data_key]);
+}   /* __getOwnedData2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __checkBounds1D(
+///         const InterpolatorStruct1D* interp_struct_1D_ptr,
+///         double* interp_x_ptr
+///     )
 ///
 /// \brief Helper method to check that the given 1D interpolation value is contained 
-///     within the given corresponding data domain. Also checks that the data key has
-///     been registered.
+///     within the given corresponding data domain, and to apply the bounds policy of
+///     the given table if not. Also checks that the given table is valid (i.e., not a
+///     null handle).
 ///
-/// \param data_key A key associated with the given interpolation data.
+/// \param interp_struct_1D_ptr A pointer to the given 1D interpolation table.
 ///
-/// \param interp_x The query value to be interpolated.
+/// \param interp_x_ptr A pointer to the query value to be interpolated. Clamped in
+///     place under INTERP_BOUNDS_CLAMP.
 ///
 
-void Interpolator :: __checkBounds1D(int data_key, double interp_x)
+void Interpolator :: __checkBounds1D(
+    const InterpolatorStruct1D* interp_struct_1D_ptr,
+    double* interp_x_ptr
+)
 {
-    //  1. key error
-    if (this->interp_map_1D.count(data_key) == 0) {
+    //  1. handle error
+    if (interp_struct_1D_ptr == nullptr) {
         std::string error_str = "ERROR:  Interpolator::interp1D()  ";
-        error_str += "data key ";
-        error_str += std::to_string(data_key);
-        error_str += " has not been registered";
+        error_str += "invalid (null) interpolation handle";
         
         #ifdef _WIN32
             std::cout << error_str << std::endl;
@@ -145,18 +250,47 @@ void Interpolator :: __checkBounds1D(int data_key, double interp_x)
         throw std::invalid_argument(error_str);
     }
     
-    //  2. bounds error
+    double interp_x = *interp_x_ptr;
+    
+    if (
+        interp_x >= interp_struct_1D_ptr->min_x and
+        interp_x <= interp_struct_1D_ptr->max_x
+    ) {
+        return;
+    }
+    
+    //  2. apply bounds policy
+    switch (interp_struct_1D_ptr->bounds_policy) {
+        case (InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP): {
+            *interp_x_ptr = std::min(
+                std::max(interp_x, interp_struct_1D_ptr->min_x),
+                interp_struct_1D_ptr->max_x
+            );
+            
+            return;
+        }
+        
+        case (InterpolatorBoundsPolicy :: INTERP_BOUNDS_EXTRAPOLATE): {
+            return;
+        }
+        
+        default: {
+            break;
+        }
+    }
+    
+    //  3. bounds error
     if (
-        interp_x < this->interp_map_1D[data_key].min_x or
-        interp_x > this->interp_map_1D[data_key].max_x
+        interp_x < interp_struct_1D_ptr->min_x or
+        interp_x > interp_struct_1D_ptr->max_x
     ) {
         std::string error_str = "ERROR:  Interpolator::interp1D()  ";
         error_str += "interpolation value ";
         error_str += std::to_string(interp_x);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_1D[data_key].min_x);
+        error_str += std::to_string(interp_struct_1D_ptr->min_x);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_1D[data_key].max_x);
+        error_str += std::to_string(interp_struct_1D_ptr->max_x);
         error_str += "]";
         
         #ifdef _WIN32
@@ -176,27 +310,36 @@ void Interpolator :: __checkBounds1D(int data_key, double interp_x)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: __checkBounds2D(int data_key, double interp_x, double interp_y)
+/// \fn void Interpolator :: __checkBounds2D(
+///         const InterpolatorStruct2D* interp_struct_2D_ptr,
+///         double* interp_x_ptr,
+///         double* interp_y_ptr
+///     )
 ///
 /// \brief Helper method to check that the given 2D interpolation value is contained 
-///     within the given corresponding data domain. Also checks that the data key has
-///     been registered.
+///     within the given corresponding data domain, and to apply the bounds policy of
+///     the given table if not. Also checks that the given table is valid (i.e., not a
+///     null handle).
 ///
-/// \param data_key A key associated with the given interpolation data.
+/// \param interp_struct_2D_ptr A pointer to the given 2D interpolation table.
 ///
-/// \param interp_x The first query value to be interpolated.
+/// \param interp_x_ptr A pointer to the first query value to be interpolated. Clamped
+///     in place under INTERP_BOUNDS_CLAMP.
 ///
-/// \param interp_y The second query value to be interpolated.
+/// \param interp_y_ptr A pointer to the second query value to be interpolated.
+///     Clamped in place under INTERP_BOUNDS_CLAMP.
 ///
 
-void Interpolator :: __checkBounds2D(int data_key, double interp_x, double interp_y)
+void Interpolator :: __checkBounds2D(
+    const InterpolatorStruct2D* interp_struct_2D_ptr,
+    double* interp_x_ptr,
+    double* interp_y_ptr
+)
 {
-    //  1. key error
-    if (this->interp_map_2D.count(data_key) == 0) {
+    //  1. handle error
+    if (interp_struct_2D_ptr == nullptr) {
         std::string error_str = "ERROR:  Interpolator::interp2D()  ";
-        error_str += "data key ";
-        error_str += std::to_string(data_key);
-        error_str += " has not been registered";
+        error_str += "invalid (null) interpolation handle";
         
         #ifdef _WIN32
             std::cout << error_str << std::endl;
@@ -205,18 +348,55 @@ void Interpolator :: __checkBounds2D(int data_key, double interp_x, double inter
         throw std::invalid_argument(error_str);
     }
     
-    //  2. bounds error (x_interp)
+    double interp_x = *interp_x_ptr;
+    double interp_y = *interp_y_ptr;
+    
+    if (
+        interp_x >= interp_struct_2D_ptr->min_x and
+        interp_x <= interp_struct_2D_ptr->max_x and
+        interp_y >= interp_struct_2D_ptr->min_y and
+        interp_y <= interp_struct_2D_ptr->max_y
+    ) {
+        return;
+    }
+    
+    //  2. apply bounds policy
+    switch (interp_struct_2D_ptr->bounds_policy) {
+        case (InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP): {
+            *interp_x_ptr = std::min(
+                std::max(interp_x, interp_struct_2D_ptr->min_x),
+                interp_struct_2D_ptr->max_x
+            );
+            
+            *interp_y_ptr = std::min(
+                std::max(interp_y, interp_struct_2D_ptr->min_y),
+                interp_struct_2D_ptr->max_y
+            );
+            
+            return;
+        }
+        
+        case (InterpolatorBoundsPolicy :: INTERP_BOUNDS_EXTRAPOLATE): {
+            return;
+        }
+        
+        default: {
+            break;
+        }
+    }
+    
+    //  3. bounds error (x_interp)
     if (
-        interp_x < this->interp_map_2D[data_key].min_x or
-        interp_x > this->interp_map_2D[data_key].max_x
+        interp_x < interp_struct_2D_ptr->min_x or
+        interp_x > interp_struct_2D_ptr->max_x
     ) {
         std::string error_str = "ERROR:  Interpolator::interp2D()  ";
         error_str += "interpolation value interp_x = ";
         error_str += std::to_string(interp_x);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_2D[data_key].min_x);
+        error_str += std::to_string(interp_struct_2D_ptr->min_x);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_2D[data_key].max_x);
+        error_str += std::to_string(interp_struct_2D_ptr->max_x);
         error_str += "]";
         
         #ifdef _WIN32
@@ -226,18 +406,18 @@ void Interpolator :: __checkBounds2D(int data_key, double interp_x, double inter
         throw std::invalid_argument(error_str);
     }
     
-    //  2. bounds error (y_interp)
+    //  4. bounds error (y_interp)
     if (
-        interp_y < this->interp_map_2D[data_key].min_y or
-        interp_y > this->interp_map_2D[data_key].max_y
+        interp_y < interp_struct_2D_ptr->min_y or
+        interp_y > interp_struct_2D_ptr->max_y
     ) {
         std::string error_str = "ERROR:  Interpolator::interp2D()  ";
         error_str += "interpolation value interp_y = ";
         error_str += std::to_string(interp_y);
         error_str += " is outside of the given interpolation data domain [";
-        error_str += std::to_string(this->interp_map_2D[data_key].min_y);
+        error_str += std::to_string(interp_struct_2D_ptr->min_y);
         error_str += " , ";
-        error_str += std::to_string(this->interp_map_2D[data_key].max_y);
+        error_str += std::to_string(interp_struct_2D_ptr->max_y);
         error_str += "]";
         
         #ifdef _WIN32
@@ -319,33 +499,336 @@ bool Interpolator :: __isNonNumeric(std::string str)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool Interpolator :: __isUniformGrid(const std::vector<double>* x_vec_ptr)
+///
+/// \brief Helper method to determine if the given (increasing) vector of interpolation
+///     data is uniformly spaced, to within a small relative tolerance.
+///
+/// \param x_vec_ptr A pointer to the given vector of interpolation data.
+///
+/// \return A boolean indicating if the given vector is uniformly spaced.
+///
+
+bool Interpolator :: __isUniformGrid(const std::vector<double>* x_vec_ptr)
+{
+    int n_points = x_vec_ptr->size();
+    
+    if (n_points < 2) {
+        return false;
+    }
+    
+    double x_0 = x_vec_ptr->front();
+    double span = x_vec_ptr->back() - x_0;
+    
+    if (span <= 0) {
+        return false;
+    }
+    
+    double dx = span / (n_points - 1);
+    double tolerance = 1e-9 * span;
+    
+    for (int i = 1; i < n_points - 1; i++) {
+        if (fabs((*x_vec_ptr)[i] - (x_0 + i * dx)) > tolerance) {
+            return false;
+        }
+    }
+    
+    return true;
+}   /* __isUniformGrid() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __setGridProperties1D(InterpolatorStruct1D* interp_struct_1D_ptr)
+///
+/// \brief Helper method to set the derived (domain, grid spacing, and slope) attributes
+///     of the given 1D interpolation struct from its data.
+///
+/// \param interp_struct_1D_ptr A pointer to the given 1D interpolation struct.
+///
+
+void Interpolator :: __setGridProperties1D(InterpolatorStruct1D* interp_struct_1D_ptr)
+{
+    interp_struct_1D_ptr->n_points = interp_struct_1D_ptr->x_vec.size();
+    
+    interp_struct_1D_ptr->min_x = interp_struct_1D_ptr->x_vec.front();
+    interp_struct_1D_ptr->max_x = interp_struct_1D_ptr->x_vec.back();
+    
+    interp_struct_1D_ptr->is_uniform_x =
+        this->__isUniformGrid(&(interp_struct_1D_ptr->x_vec));
+    
+    interp_struct_1D_ptr->inv_dx = 0;
+    
+    if (interp_struct_1D_ptr->is_uniform_x) {
+        interp_struct_1D_ptr->inv_dx = (interp_struct_1D_ptr->n_points - 1) /
+            (interp_struct_1D_ptr->max_x - interp_struct_1D_ptr->min_x);
+    }
+    
+    interp_struct_1D_ptr->slope_vec.resize(interp_struct_1D_ptr->n_points - 1, 0);
+    
+    for (int i = 0; i < interp_struct_1D_ptr->n_points - 1; i++) {
+        interp_struct_1D_ptr->slope_vec[i] = (
+            interp_struct_1D_ptr->y_vec[i + 1] - interp_struct_1D_ptr->y_vec[i]
+        ) / (
+            interp_struct_1D_ptr->x_vec[i + 1] - interp_struct_1D_ptr->x_vec[i]
+        );
+    }
+    
+    return;
+}   /* __setGridProperties1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: __setGridProperties2D(InterpolatorStruct2D* interp_struct_2D_ptr)
+///
+/// \brief Helper method to set the derived (domain, grid spacing, and reciprocal
+///     interval width) attributes of the given 2D interpolation struct from its data.
+///
+/// \param interp_struct_2D_ptr A pointer to the given 2D interpolation struct.
+///
+
+void Interpolator :: __setGridProperties2D(InterpolatorStruct2D* interp_struct_2D_ptr)
+{
+    //  1. columns (x)
+    interp_struct_2D_ptr->min_x = interp_struct_2D_ptr->x_vec.front();
+    interp_struct_2D_ptr->max_x = interp_struct_2D_ptr->x_vec.back();
+    
+    interp_struct_2D_ptr->is_uniform_x =
+        this->__isUniformGrid(&(interp_struct_2D_ptr->x_vec));
+    
+    interp_struct_2D_ptr->inv_dx = 0;
+    
+    if (interp_struct_2D_ptr->is_uniform_x) {
+        interp_struct_2D_ptr->inv_dx = (interp_struct_2D_ptr->n_cols - 1) /
+            (interp_struct_2D_ptr->max_x - interp_struct_2D_ptr->min_x);
+    }
+    
+    interp_struct_2D_ptr->inv_dx_vec.resize(interp_struct_2D_ptr->n_cols - 1, 0);
+    
+    for (int j = 0; j < interp_struct_2D_ptr->n_cols - 1; j++) {
+        interp_struct_2D_ptr->inv_dx_vec[j] = 1.0 / (
+            interp_struct_2D_ptr->x_vec[j + 1] - interp_struct_2D_ptr->x_vec[j]
+        );
+    }
+    
+    //  2. rows (y)
+    interp_struct_2D_ptr->min_y = interp_struct_2D_ptr->y_vec.front();
+    interp_struct_2D_ptr->max_y = interp_struct_2D_ptr->y_vec.back();
+    
+    interp_struct_2D_ptr->is_uniform_y =
+        this->__isUniformGrid(&(interp_struct_2D_ptr->y_vec));
+    
+    interp_struct_2D_ptr->inv_dy = 0;
+    
+    if (interp_struct_2D_ptr->is_uniform_y) {
+        interp_struct_2D_ptr->inv_dy = (interp_struct_2D_ptr->n_rows - 1) /
+            (interp_struct_2D_ptr->max_y - interp_struct_2D_ptr->min_y);
+    }
+    
+    interp_struct_2D_ptr->inv_dy_vec.resize(interp_struct_2D_ptr->n_rows - 1, 0);
+    
+    for (int i = 0; i < interp_struct_2D_ptr->n_rows - 1; i++) {
+        interp_struct_2D_ptr->inv_dy_vec[i] = 1.0 / (
+            interp_struct_2D_ptr->y_vec[i + 1] - interp_struct_2D_ptr->y_vec[i]
+        );
+    }
+    
+    return;
+}   /* __setGridProperties2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: __bilinearKernel(
+///         const double* z_row_0_ptr,
+///         const double* z_row_1_ptr,
+///         double t_x,
+///         double t_y
+///     )
+///
+/// \brief Helper method to blend the four corners of a 2D interpolation cell. Where
+///     SSE2 is available, the two rows of the cell are blended (in y) as a single
+///     vector operation, followed by a scalar blend (in x).
+///
+/// \param z_row_0_ptr A pointer to the lower left corner of the cell (the lower right
+///     corner is assumed to immediately follow it, as in a row-major matrix).
+///
+/// \param z_row_1_ptr A pointer to the upper left corner of the cell (the upper right
+///     corner is assumed to immediately follow it, as in a row-major matrix).
+///
+/// \param t_x The fractional position of the query within the cell, in x.
+///
+/// \param t_y The fractional position of the query within the cell, in y.
+///
+/// \return The bilinear interpolation of the cell corners.
+///
+
+double Interpolator :: __bilinearKernel(
+    const double* z_row_0_ptr,
+    const double* z_row_1_ptr,
+    double t_x,
+    double t_y
+)
+{
+    #if defined(__SSE2__) || defined(_M_X64)
+        __m128d z_row_0 = _mm_loadu_pd(z_row_0_ptr);
+        __m128d z_row_1 = _mm_loadu_pd(z_row_1_ptr);
+        
+        __m128d z_col = _mm_add_pd(
+            z_row_0,
+            _mm_mul_pd(_mm_set1_pd(t_y), _mm_sub_pd(z_row_1, z_row_0))
+        );
+        
+        double z_col_array[2];
+        _mm_storeu_pd(z_col_array, z_col);
+        
+        return z_col_array[0] + t_x * (z_col_array[1] - z_col_array[0]);
+    
+    #else
+        double z_col_0 = z_row_0_ptr[0] + t_y * (z_row_1_ptr[0] - z_row_0_ptr[0]);
+        double z_col_1 = z_row_0_ptr[1] + t_y * (z_row_1_ptr[1] - z_row_0_ptr[1]);
+        
+        return z_col_0 + t_x * (z_col_1 - z_col_0);
+    #endif
+}   /* __bilinearKernel() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
 /// \fn int Interpolator :: __getInterpolationIndex(
 ///         double interp_x,
-///         std::vector<double>* x_vec_ptr
+///         const std::vector<double>* x_vec_ptr,
+///         bool is_uniform,
+///         double inv_dx,
+///         int* hint_ptr
 ///     )
 ///
-/// \brief Helper method to get appropriate interpolation index into given vector.
+/// \brief Helper method to get appropriate interpolation index into given vector. If
+///     the vector is uniformly spaced, then the index is computed directly (O(1)).
+///     Otherwise, if a hint is given, then the search begins from the hinted index and
+///     steps outward (amortized O(1) for smoothly varying queries), falling back to
+///     binary search (O(log n)) on a jump.
 ///
-/// \param interp_x The query value to be interpolated.
+/// \param interp_x The query value to be interpolated. Values outside of the data
+///     domain map to the nearest end interval (so as to support extrapolation).
 ///
 /// \param x_vec_ptr A pointer to the given vector of interpolation data.
 ///
+/// \param is_uniform A boolean which indicates whether the given vector is uniformly
+///     spaced.
+///
+/// \param inv_dx The reciprocal of the (uniform) spacing of the given vector. Only
+///     used if is_uniform is true.
+///
+/// \param hint_ptr A pointer to a hinted interpolation index (e.g., the index returned
+///     by the last call). If not nullptr, then the index found is written back to it.
+///
 /// \return The appropriate interpolation index into the given vector.
 ///
 
 int Interpolator :: __getInterpolationIndex(
     double interp_x,
-    std::vector<double>* x_vec_ptr
+    const std::vector<double>* x_vec_ptr,
+    bool is_uniform,
+    double inv_dx,
+    int* hint_ptr
 )
 {
+    int idx_max = x_vec_ptr->size() - 2;
     int idx = 0;
-    while (
-        not (interp_x >= x_vec_ptr->at(idx) and interp_x <= x_vec_ptr->at(idx + 1))
-    ) {
-        idx++;
+    bool index_found = false;
+    
+    //  1. uniform grid, compute index directly
+    if (is_uniform) {
+        // clamp before casting, so that far out-of-domain values cannot overflow
+        double idx_real = (interp_x - x_vec_ptr->front()) * inv_dx;
+        
+        if (not (idx_real > 0)) {
+            idx = 0;
+        }
+        
+        else if (idx_real > idx_max) {
+            idx = idx_max;
+        }
+        
+        else {
+            idx = (int)idx_real;
+        }
+        
+        // correct for round-off at grid points
+        if (idx > 0 and interp_x < (*x_vec_ptr)[idx]) {
+            idx--;
+        }
+        
+        else if (idx < idx_max and interp_x > (*x_vec_ptr)[idx + 1]) {
+            idx++;
+        }
+        
+        index_found = true;
+    }
+    
+    //  2. hinted, step outward from hint (a few steps at most)
+    else if (hint_ptr != nullptr and *hint_ptr >= 0 and *hint_ptr <= idx_max) {
+        idx = *hint_ptr;
+        
+        for (int n_steps = 0; n_steps < 3; n_steps++) {
+            if (idx > 0 and interp_x < (*x_vec_ptr)[idx]) {
+                idx--;
+            }
+            
+            else if (idx < idx_max and interp_x >= (*x_vec_ptr)[idx + 1]) {
+                idx++;
+            }
+            
+            else {
+                index_found = true;
+                break;
+            }
+        }
+    }
+    
+    //  3. otherwise (or on a jump), binary search
+    if (not index_found) {
+        std::vector<double>::const_iterator iter = std::upper_bound(
+            x_vec_ptr->begin(),
+            x_vec_ptr->end(),
+            interp_x
+        );
+        
+        idx = (iter - x_vec_ptr->begin()) - 1;
+        
+        if (idx < 0) {
+            idx = 0;
+        }
+        
+        else if (idx > idx_max) {
+            idx = idx_max;
+        }
+    }
+    
+    //  4. write back hint
+    if (hint_ptr != nullptr) {
+        *hint_ptr = idx;
     }
     
     return idx;
@@ -507,8 +990,7 @@ void Interpolator :: __readData1D(int data_key, std::string path_2_data)
         }
     }
     
-    interp_struct_1D.min_x = interp_struct_1D.x_vec[0];
-    interp_struct_1D.max_x = interp_struct_1D.x_vec[interp_struct_1D.n_points - 1];
+    this->__setGridProperties1D(&interp_struct_1D);
     
     //  3. write struct to map
     this->interp_map_1D.insert(
@@ -582,11 +1064,7 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
     interp_struct_2D.x_vec.resize(interp_struct_2D.n_cols, 0);
     interp_struct_2D.y_vec.resize(interp_struct_2D.n_rows, 0);
     
-    interp_struct_2D.z_matrix.resize(interp_struct_2D.n_rows, {});
-    
-    for (int i = 0; i < interp_struct_2D.n_rows; i++) {
-        interp_struct_2D.z_matrix[i].resize(interp_struct_2D.n_cols, 0);
-    }
+    interp_struct_2D.z_vec.resize(interp_struct_2D.n_rows * interp_struct_2D.n_cols, 0);
     
     for (size_t i = 1; i < string_matrix[0].size(); i++) {
         try {
@@ -598,9 +1076,6 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
         }
     }
     
-    interp_struct_2D.min_x = interp_struct_2D.x_vec[0];
-    interp_struct_2D.max_x = interp_struct_2D.x_vec[interp_struct_2D.n_cols - 1];
-    
     for (size_t i = 1; i < string_matrix.size(); i++) {
         try {
             interp_struct_2D.y_vec[i - 1] = std::stod(string_matrix[i][0]);
@@ -611,13 +1086,12 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
         }
     }
     
-    interp_struct_2D.min_y = interp_struct_2D.y_vec[0];
-    interp_struct_2D.max_y = interp_struct_2D.y_vec[interp_struct_2D.n_rows - 1];
-    
     for (size_t i = 1; i < string_matrix.size(); i++) {
         for (size_t j = 1; j < string_matrix[0].size(); j++) {
             try {
-                interp_struct_2D.z_matrix[i - 1][j - 1] = std::stod(string_matrix[i][j]);
+                interp_struct_2D.z_vec[
+                    (i - 1) * interp_struct_2D.n_cols + (j - 1)
+                ] = std::stod(string_matrix[i][j]);
             }
             
             catch (...) {
@@ -626,6 +1100,8 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
         }
     }
     
+    this->__setGridProperties2D(&interp_struct_2D);
+    
     //  3. write struct to map
     this->interp_map_2D.insert(
         std::pair<int, InterpolatorStruct2D>(data_key, interp_struct_2D)
@@ -673,7 +1149,9 @@ void Interpolator :: __readData2D(int data_key, std::string path_2_data)
             j < this->interp_map_2D[data_key].n_cols;
             j++
         ) {
-            std::cout << this->interp_map_2D[data_key].z_matrix[i][j] << ", ";
+            std::cout << this->interp_map_2D[data_key].z_vec[
+                i * this->interp_map_2D[data_key].n_cols + j
+            ] << ", ";
         }
         
         std::cout << "]" << std::endl;
@@ -717,28 +1195,46 @@ Interpolator :: Interpolator(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: addData1D(int data_key, std::string path_2_data)
+/// \fn InterpolatorHandle1D Interpolator :: addData1D(
+///         int data_key,
+///         std::string path_2_data
+///     )
 ///
-/// \brief Method to add 1D interpolation data to the Interpolator.
+/// \brief Method to add 1D interpolation data to the Interpolator. The data is parsed
+///     by way of the process-wide data cache (so a current file is not re-read), and
+///     then copied into this Interpolator, so that it may be modified (see
+///     resampleData1D() and setBoundsPolicy1D()). For read only use, see
+///     borrowData1D().
 ///
 /// \param data_key A key used to index into the Interpolator.
 ///
 /// \param path_2_data A path (either relative or absolute) to the given 1D
 ///     interpolation data.
 ///
+/// \return A handle to the added interpolation data.
+///
 
-void Interpolator :: addData1D(int data_key, std::string path_2_data)
+InterpolatorHandle1D Interpolator :: addData1D(int data_key, std::string path_2_data)
 {
     //  1. check key
     this->__checkDataKey1D(data_key);
     
-    //  2. read data into map
-    this->__readData1D(data_key, path_2_data);
+    //  2. read data into map (copying from the process-wide data cache, if current)
+    std::shared_ptr<const InterpolatorStruct1D> interp_struct_1D_ptr =
+        DataCache::getInterpolatorData1D(
+            path_2_data,
+            [this, data_key, path_2_data](void) {
+                this->__readData1D(data_key, path_2_data);
+                return this->interp_map_1D[data_key];
+            }
+        );
+    
+    this->interp_map_1D[data_key] = *interp_struct_1D_ptr;
     
     //  3. record path
     this->path_map_1D.insert(std::pair<int, std::string>(data_key, path_2_data));
     
-    return;
+    return this->getHandle1D(data_key);
 }   /* addData1D() */
 
 // ---------------------------------------------------------------------------------- //
@@ -748,29 +1244,560 @@ void Interpolator :: addData1D(int data_key, std::string path_2_data)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Interpolator :: addData2D(int data_key, std::string path_2_data)
+/// \fn InterpolatorHandle1D Interpolator :: addData1D(
+///         int data_key,
+///         InterpolatorStruct1D interp_struct_1D
+///     )
 ///
-/// \brief Method to add 2D interpolation data to the Interpolator.
+/// \brief Method to add 1D interpolation data, given directly (rather than read from
+///     file), to the Interpolator. Only x_vec and y_vec need be set; all derived
+///     attributes (n_points, domain, and grid spacing) are set here.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_struct_1D A 1D interpolation struct, holding the given data.
+///
+/// \return A handle to the added interpolation data.
+///
+
+InterpolatorHandle1D Interpolator :: addData1D(
+    int data_key,
+    InterpolatorStruct1D interp_struct_1D
+)
+{
+    //  1. check key
+    this->__checkDataKey1D(data_key);
+    
+    //  2. check data
+    if (
+        interp_struct_1D.x_vec.size() < 2 or
+        interp_struct_1D.x_vec.size() != interp_struct_1D.y_vec.size()
+    ) {
+        std::string error_str = "ERROR:  Interpolator::addData1D()  ";
+        error_str += "x_vec and y_vec must be of the same length (at least 2)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. set derived attributes, write struct to map
+    this->__setGridProperties1D(&interp_struct_1D);
+    
+    this->interp_map_1D.insert(
+        std::pair<int, InterpolatorStruct1D>(data_key, interp_struct_1D)
+    );
+    
+    return this->getHandle1D(data_key);
+}   /* addData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle2D Interpolator :: addData2D(
+///         int data_key,
+///         std::string path_2_data
+///     )
+///
+/// \brief Method to add 2D interpolation data to the Interpolator. The data is parsed
+///     by way of the process-wide data cache (so a current file is not re-read), and
+///     then copied into this Interpolator, so that it may be modified (see
+///     setBoundsPolicy2D()). For read only use, see borrowData2D().
 ///
 /// \param data_key A key used to index into the Interpolator.
 ///
 /// \param path_2_data A path (either relative or absolute) to the given 2D
 ///     interpolation data.
 ///
+/// \return A handle to the added interpolation data.
+///
+
+InterpolatorHandle2D Interpolator :: addData2D(int data_key, std::string path_2_data)
+{
+    //  1. check key
+    this->__checkDataKey2D(data_key);
+    
+    //  2. read data into map (copying from the process-wide data cache, if current)
+    std::shared_ptr<const InterpolatorStruct2D> interp_struct_2D_ptr =
+        DataCache::getInterpolatorData2D(
+            path_2_data,
+            [this, data_key, path_2_data](void) {
+                this->__readData2D(data_key, path_2_data);
+                return this->interp_map_2D[data_key];
+            }
+        );
+    
+    this->interp_map_2D[data_key] = *interp_struct_2D_ptr;
+    
+    //  3. record path
+    this->path_map_2D.insert(std::pair<int, std::string>(data_key, path_2_data));
+    
+    return this->getHandle2D(data_key);
+}   /* addData2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle1D Interpolator :: borrowData1D(
+///         int data_key,
+///         std::string path_2_data
+///     )
+///
+/// \brief Method to borrow 1D interpolation data from the process-wide data cache
+///     (reading it from disk only if not cached, or if the file has changed). Borrowed
+///     data is shared, rather than copied, and so is read only (it cannot be resampled,
+///     and its bounds policy cannot be changed).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param path_2_data A path (either relative or absolute) to the given 1D
+///     interpolation data.
+///
+/// \return A handle to the borrowed interpolation data.
+///
+
+InterpolatorHandle1D Interpolator :: borrowData1D(int data_key, std::string path_2_data)
+{
+    //  1. check key
+    this->__checkDataKey1D(data_key);
+    
+    //  2. borrow data (reading it through a temporary map entry, if need be)
+    std::shared_ptr<const InterpolatorStruct1D> interp_struct_1D_ptr =
+        DataCache::getInterpolatorData1D(
+            path_2_data,
+            [this, data_key, path_2_data](void) {
+                this->__readData1D(data_key, path_2_data);
+                
+                InterpolatorStruct1D interp_struct_1D =
+                    std::move(this->interp_map_1D[data_key]);
+                this->interp_map_1D.erase(data_key);
+                
+                return interp_struct_1D;
+            }
+        );
+    
+    this->borrowed_map_1D[data_key] = interp_struct_1D_ptr;
+    
+    //  3. record path
+    this->path_map_1D.insert(std::pair<int, std::string>(data_key, path_2_data));
+    
+    return this->getHandle1D(data_key);
+}   /* borrowData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle1D Interpolator :: borrowData1D(
+///         int data_key,
+///         std::shared_ptr<const InterpolatorStruct1D> interp_struct_1D_ptr
+///     )
+///
+/// \brief Method to borrow given 1D interpolation data (e.g., a table built once and
+///     shared through DataCache::getDerivedData1D()). The data is shared, rather than
+///     copied, and so is read only. It must already be complete (i.e., as returned by
+///     addData1D() or resampleData1D()).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_struct_1D_ptr A pointer to the (complete) 1D interpolation data.
+///
+/// \return A handle to the borrowed interpolation data.
+///
+
+InterpolatorHandle1D Interpolator :: borrowData1D(
+    int data_key,
+    std::shared_ptr<const InterpolatorStruct1D> interp_struct_1D_ptr
+)
+{
+    //  1. check key and data
+    this->__checkDataKey1D(data_key);
+    
+    if (
+        interp_struct_1D_ptr == nullptr or
+        interp_struct_1D_ptr->n_points < 2 or
+        (int)interp_struct_1D_ptr->slope_vec.size() != interp_struct_1D_ptr->n_points - 1
+    ) {
+        std::string error_str = "ERROR:  Interpolator::borrowData1D()  ";
+        error_str += "borrowed data must be complete (at least 2 points, with grid ";
+        error_str += "properties set)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. borrow data
+    this->borrowed_map_1D[data_key] = interp_struct_1D_ptr;
+    
+    return this->getHandle1D(data_key);
+}   /* borrowData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle2D Interpolator :: borrowData2D(
+///         int data_key,
+///         std::string path_2_data
+///     )
+///
+/// \brief Method to borrow 2D interpolation data from the process-wide data cache
+///     (reading it from disk only if not cached, or if the file has changed). Borrowed
+///     data is shared, rather than copied, and so is read only (its bounds policy
+///     cannot be changed).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param path_2_data A path (either relative or absolute) to the given 2D
+///     interpolation data.
+///
+/// \return A handle to the borrowed interpolation data.
+///
+
+InterpolatorHandle2D Interpolator :: borrowData2D(int data_key, std::string path_2_data)
+{
+    //  1. check key
+    this->__checkDataKey2D(data_key);
+    
+    //  2. borrow data (reading it through a temporary map entry, if need be)
+    std::shared_ptr<const InterpolatorStruct2D> interp_struct_2D_ptr =
+        DataCache::getInterpolatorData2D(
+            path_2_data,
+            [this, data_key, path_2_data](void) {
+                this->__readData2D(data_key, path_2_data);
+                
+                InterpolatorStruct2D interp_struct_2D =
+                    std::move(this->interp_map_2D[data_key]);
+                this->interp_map_2D.erase(data_key);
+                
+                return interp_struct_2D;
+            }
+        );
+    
+    this->borrowed_map_2D[data_key] = interp_struct_2D_ptr;
+    
+    //  3. record path
+    this->path_map_2D.insert(std::pair<int, std::string>(data_key, path_2_data));
+    
+    return this->getHandle2D(data_key);
+}   /* borrowData2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: resampleData1D(int data_key, int n_points)
+///
+/// \brief Method to resample the given 1D interpolation data onto a uniform grid (over
+///     the same domain), so that subsequent lookups require no search. This trades a
+///     bounded loss of accuracy for constant time evaluation; the maximum deviation of
+///     the resampled interpolant from the original is returned (and recorded as
+///     InterpolatorStruct1D::max_resample_deviation). Since both interpolants are
+///     piecewise linear, and they agree on the new grid, this maximum is attained at
+///     one of the original data points. Existing handles remain valid. Borrowed data
+///     cannot be resampled (see borrowData1D()).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param n_points The number of points in the uniform grid (at least 2).
+///
+/// \return The maximum absolute deviation of the resampled interpolant from the
+///     original.
+///
+
+double Interpolator :: resampleData1D(int data_key, int n_points)
+{
+    //  1. check inputs
+    if (n_points < 2) {
+        std::string error_str = "ERROR:  Interpolator::resampleData1D()  ";
+        error_str += "number of points must be at least 2";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    InterpolatorStruct1D* interp_struct_1D_ptr =
+        this->__getOwnedData1D(data_key, "resampleData1D");
+    InterpolatorHandle1D handle = this->getHandle1D(data_key);
+    
+    //  2. sample original interpolant onto uniform grid
+    InterpolatorStruct1D resampled_struct_1D;
+    
+    resampled_struct_1D.x_vec.resize(n_points, 0);
+    resampled_struct_1D.y_vec.resize(n_points, 0);
+    
+    double min_x = interp_struct_1D_ptr->min_x;
+    double max_x = interp_struct_1D_ptr->max_x;
+    
+    for (int i = 0; i < n_points; i++) {
+        double x = min_x + (i * (max_x - min_x)) / (n_points - 1);
+        
+        if (i == n_points - 1) {
+            x = max_x;
+        }
+        
+        resampled_struct_1D.x_vec[i] = x;
+        resampled_struct_1D.y_vec[i] = this->interp1D(handle, x);
+    }
+    
+    this->__setGridProperties1D(&resampled_struct_1D);
+    
+    //  3. swap in resampled data (in place, so that handles remain valid)
+    std::vector<double> original_x_vec = interp_struct_1D_ptr->x_vec;
+    std::vector<double> original_y_vec = interp_struct_1D_ptr->y_vec;
+    
+    resampled_struct_1D.bounds_policy = interp_struct_1D_ptr->bounds_policy;
+    *interp_struct_1D_ptr = resampled_struct_1D;
+    
+    //  4. get maximum deviation (attained at original data points)
+    double max_deviation = 0;
+    
+    for (size_t i = 0; i < original_x_vec.size(); i++) {
+        double deviation = fabs(
+            this->interp1D(handle, original_x_vec[i]) - original_y_vec[i]
+        );
+        
+        if (deviation > max_deviation) {
+            max_deviation = deviation;
+        }
+    }
+    
+    interp_struct_1D_ptr->is_resampled = true;
+    interp_struct_1D_ptr->max_resample_deviation = max_deviation;
+    
+    return max_deviation;
+}   /* resampleData1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle1D Interpolator :: getHandle1D(int data_key)
+///
+/// \brief Method to get a handle to the 1D interpolation data associated with the
+///     given key.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \return A handle to the associated interpolation data.
+///
+
+InterpolatorHandle1D Interpolator :: getHandle1D(int data_key)
+{
+    InterpolatorHandle1D handle;
+    
+    //  1. owned data
+    std::map<int, InterpolatorStruct1D>::iterator iter =
+        this->interp_map_1D.find(data_key);
+    
+    if (iter != this->interp_map_1D.end()) {
+        handle.interp_struct_1D_ptr = &(iter->second);
+        
+        return handle;
+    }
+    
+    //  2. borrowed data
+    std::map<int, std::shared_ptr<const InterpolatorStruct1D>>::iterator borrowed_iter =
+        this->borrowed_map_1D.find(data_key);
+    
+    if (borrowed_iter == this->borrowed_map_1D.end()) {
+        std::string error_str = "ERROR:  Interpolator::interp1D()  ";
+        error_str += "data key ";
+        error_str += std::to_string(data_key);
+        error_str += " has not been registered";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    handle.interp_struct_1D_ptr = borrowed_iter->second.get();
+    
+    return handle;
+}   /* getHandle1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorHandle2D Interpolator :: getHandle2D(int data_key)
+///
+/// \brief Method to get a handle to the 2D interpolation data associated with the
+///     given key.
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \return A handle to the associated interpolation data.
+///
+
+InterpolatorHandle2D Interpolator :: getHandle2D(int data_key)
+{
+    InterpolatorHandle2D handle;
+    
+    //  1. owned data
+    std::map<int, InterpolatorStruct2D>::iterator iter =
+        this->interp_map_2D.find(data_key);
+    
+    if (iter != this->interp_map_2D.end()) {
+        handle.interp_struct_2D_ptr = &(iter->second);
+        
+        return handle;
+    }
+    
+    //  2. borrowed data
+    std::map<int, std::shared_ptr<const InterpolatorStruct2D>>::iterator borrowed_iter =
+        this->borrowed_map_2D.find(data_key);
+    
+    if (borrowed_iter == this->borrowed_map_2D.end()) {
+        std::string error_str = "ERROR:  Interpolator::interp2D()  ";
+        error_str += "data key ";
+        error_str += std::to_string(data_key);
+        error_str += " has not been registered";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    handle.interp_struct_2D_ptr = borrowed_iter->second.get();
+    
+    return handle;
+}   /* getHandle2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: setBoundsPolicy1D(
+///         int data_key,
+///         InterpolatorBoundsPolicy bounds_policy
+///     )
+///
+/// \brief Method to set the policy by which the 1D interpolation data associated with
+///     the given key handles query values outside of its data domain (throw, clamp, or
+///     linearly extrapolate). Borrowed data is read only (see
+///     borrowData1D()).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param bounds_policy The bounds policy to apply.
+///
+
+void Interpolator :: setBoundsPolicy1D(
+    int data_key,
+    InterpolatorBoundsPolicy bounds_policy
+)
+{
+    //  1. check bounds policy
+    if (
+        bounds_policy < 0 or
+        bounds_policy >= InterpolatorBoundsPolicy :: N_INTERP_BOUNDS_POLICIES
+    ) {
+        std::string error_str = "ERROR:  Interpolator::setBoundsPolicy1D()  ";
+        error_str += "bounds policy ";
+        error_str += std::to_string(bounds_policy);
+        error_str += " not recognized";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. set bounds policy
+    this->__getOwnedData1D(data_key, "setBoundsPolicy1D")->bounds_policy = bounds_policy;
+    
+    return;
+}   /* setBoundsPolicy1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: setBoundsPolicy2D(
+///         int data_key,
+///         InterpolatorBoundsPolicy bounds_policy
+///     )
+///
+/// \brief Method to set the policy by which the 2D interpolation data associated with
+///     the given key handles query values outside of its data domain (throw, clamp, or
+///     linearly extrapolate). Borrowed data is read only (see
+///     borrowData2D()).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param bounds_policy The bounds policy to apply.
+///
 
-void Interpolator :: addData2D(int data_key, std::string path_2_data)
+void Interpolator :: setBoundsPolicy2D(
+    int data_key,
+    InterpolatorBoundsPolicy bounds_policy
+)
 {
-    //  1. check key
-    this->__checkDataKey2D(data_key);
-    
-    //  2. read data into map
-    this->__readData2D(data_key, path_2_data);
+    //  1. check bounds policy
+    if (
+        bounds_policy < 0 or
+        bounds_policy >= InterpolatorBoundsPolicy :: N_INTERP_BOUNDS_POLICIES
+    ) {
+        std::string error_str = "ERROR:  Interpolator::setBoundsPolicy2D()  ";
+        error_str += "bounds policy ";
+        error_str += std::to_string(bounds_policy);
+        error_str += " not recognized";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
     
-    //  3. record path
-    this->path_map_2D.insert(std::pair<int, std::string>(data_key, path_2_data));
+    //  2. set bounds policy
+    this->__getOwnedData2D(data_key, "setBoundsPolicy2D")->bounds_policy = bounds_policy;
     
     return;
-}   /* addData2D() */
+}   /* setBoundsPolicy2D() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -779,37 +1806,88 @@ void Interpolator :: addData2D(int data_key, std::string path_2_data)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Interpolator :: interp1D(int data_key, double interp_x)
+/// \fn double Interpolator :: interp1D(
+///         int data_key,
+///         double interp_x,
+///         InterpolatorCursor* cursor_ptr
+///     )
 ///
 /// \brief Method to perform a 1D interpolation.
 ///
 /// \param data_key A key used to index into the Interpolator.
 ///
 /// \param interp_x The query value to be interpolated. If this value is outside the
-///     domain of the associated interpolation data, then an error will occur.
+///     domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy1D()).
+///
+/// \param cursor_ptr A pointer to a caller-held cursor, used to speed up successive
+///     queries which are close together (optional). Results are the same with or
+///     without a cursor.
+///
+/// \return An interpolation of the given query value.
+///
+
+double Interpolator :: interp1D(
+    int data_key,
+    double interp_x,
+    InterpolatorCursor* cursor_ptr
+)
+{
+    return this->interp1D(this->getHandle1D(data_key), interp_x, cursor_ptr);
+}   /* interp1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp1D(
+///         InterpolatorHandle1D handle,
+///         double interp_x,
+///         InterpolatorCursor* cursor_ptr
+///     )
+///
+/// \brief Method to perform a 1D interpolation, through a handle (i.e., without any
+///     map lookups).
+///
+/// \param handle A handle to the interpolation data (see addData1D(), getHandle1D()).
+///
+/// \param interp_x The query value to be interpolated. If this value is outside the
+///     domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy1D()).
+///
+/// \param cursor_ptr A pointer to a caller-held cursor, used to speed up successive
+///     queries which are close together (optional). Results are the same with or
+///     without a cursor.
 ///
 /// \return An interpolation of the given query value.
 ///
 
-double Interpolator :: interp1D(int data_key, double interp_x)
+double Interpolator :: interp1D(
+    InterpolatorHandle1D handle,
+    double interp_x,
+    InterpolatorCursor* cursor_ptr
+)
 {
+    const InterpolatorStruct1D* interp_struct_1D_ptr = handle.interp_struct_1D_ptr;
+    
     //  1. check bounds
-    this->__checkBounds1D(data_key, interp_x);
+    this->__checkBounds1D(interp_struct_1D_ptr, &interp_x);
     
     //  2. get interpolation index
     int idx = this->__getInterpolationIndex(
         interp_x,
-        &(this->interp_map_1D[data_key].x_vec)
+        &(interp_struct_1D_ptr->x_vec),
+        interp_struct_1D_ptr->is_uniform_x,
+        interp_struct_1D_ptr->inv_dx,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_x)
     );
     
     //  3. perform interpolation
-    double x_0 = this->interp_map_1D[data_key].x_vec[idx];
-    double x_1 = this->interp_map_1D[data_key].x_vec[idx + 1];
-    
-    double y_0 = this->interp_map_1D[data_key].y_vec[idx];
-    double y_1 = this->interp_map_1D[data_key].y_vec[idx + 1];
-    
-    double interp_y = ((y_1 - y_0) / (x_1 - x_0)) * (interp_x - x_0) + y_0;
+    double interp_y = interp_struct_1D_ptr->slope_vec[idx] *
+        (interp_x - interp_struct_1D_ptr->x_vec[idx]) + interp_struct_1D_ptr->y_vec[idx];
     
     return interp_y;
 }   /* interp1D() */
@@ -821,61 +1899,519 @@ double Interpolator :: interp1D(int data_key, double interp_x)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Interpolator :: interp2D(int data_key, double interp_x, double interp_y)
+/// \fn double Interpolator :: interp2D(
+///         int data_key,
+///         double interp_x,
+///         double interp_y,
+///         InterpolatorCursor* cursor_ptr
+///     )
 ///
 /// \brief Method to perform a 2D interpolation.
 ///
 /// \param data_key A key used to index into the Interpolator.
 ///
 /// \param interp_x The first query value to be interpolated. If this value is outside
-///     the domain of the associated interpolation data, then an error will occur.
+///     the domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy2D()).
+///
+/// \param interp_y The second query value to be interpolated. If this value is outside
+///     the domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy2D()).
+///
+/// \param cursor_ptr A pointer to a caller-held cursor, used to speed up successive
+///     queries which are close together (optional). Results are the same with or
+///     without a cursor.
+///
+/// \return An interpolation of the given query values.
+///
+
+double Interpolator :: interp2D(
+    int data_key,
+    double interp_x,
+    double interp_y,
+    InterpolatorCursor* cursor_ptr
+)
+{
+    return this->interp2D(
+        this->getHandle2D(data_key),
+        interp_x,
+        interp_y,
+        cursor_ptr
+    );
+}   /* interp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp2D(
+///         InterpolatorHandle2D handle,
+///         double interp_x,
+///         double interp_y,
+///         InterpolatorCursor* cursor_ptr
+///     )
+///
+/// \brief Method to perform a 2D interpolation, through a handle (i.e., without any
+///     map lookups).
+///
+/// \param handle A handle to the interpolation data (see addData2D(), getHandle2D()).
+///
+/// \param interp_x The first query value to be interpolated. If this value is outside
+///     the domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy2D()).
 ///
 /// \param interp_y The second query value to be interpolated. If this value is outside
-///     the domain of the associated interpolation data, then an error will occur.
+///     the domain of the associated interpolation data, then the bounds policy of the
+///     table applies (by default, an error will occur; see setBoundsPolicy2D()).
+///
+/// \param cursor_ptr A pointer to a caller-held cursor, used to speed up successive
+///     queries which are close together (optional). Results are the same with or
+///     without a cursor.
 ///
 /// \return An interpolation of the given query values.
 ///
 
-double Interpolator :: interp2D(int data_key, double interp_x, double interp_y)
+double Interpolator :: interp2D(
+    InterpolatorHandle2D handle,
+    double interp_x,
+    double interp_y,
+    InterpolatorCursor* cursor_ptr
+)
 {
+    const InterpolatorStruct2D* interp_struct_2D_ptr = handle.interp_struct_2D_ptr;
+    
     //  1. check bounds
-    this->__checkBounds2D(data_key, interp_x, interp_y);
+    this->__checkBounds2D(interp_struct_2D_ptr, &interp_x, &interp_y);
     
     //  2. get interpolation indices
     int idx_x = this->__getInterpolationIndex(
         interp_x,
-        &(this->interp_map_2D[data_key].x_vec)
+        &(interp_struct_2D_ptr->x_vec),
+        interp_struct_2D_ptr->is_uniform_x,
+        interp_struct_2D_ptr->inv_dx,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_x)
     );
     
     int idx_y = this->__getInterpolationIndex(
         interp_y,
-        &(this->interp_map_2D[data_key].y_vec)
+        &(interp_struct_2D_ptr->y_vec),
+        interp_struct_2D_ptr->is_uniform_y,
+        interp_struct_2D_ptr->inv_dy,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_y)
+    );
+    
+    //  3. get fractional position within cell
+    double t_x = (interp_x - interp_struct_2D_ptr->x_vec[idx_x]) *
+        interp_struct_2D_ptr->inv_dx_vec[idx_x];
+    
+    double t_y = (interp_y - interp_struct_2D_ptr->y_vec[idx_y]) *
+        interp_struct_2D_ptr->inv_dy_vec[idx_y];
+    
+    //  4. blend cell corners
+    const double* z_row_0_ptr = interp_struct_2D_ptr->z_vec.data() +
+        idx_y * interp_struct_2D_ptr->n_cols + idx_x;
+    
+    double interp_z = this->__bilinearKernel(
+        z_row_0_ptr,
+        z_row_0_ptr + interp_struct_2D_ptr->n_cols,
+        t_x,
+        t_y
+    );
+    
+    return interp_z;
+}   /* interp2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp1DUnchecked(
+///         InterpolatorHandle1D handle,
+///         double interp_x,
+///         InterpolatorCursor* cursor_ptr
+///     )
+///
+/// \brief Method to perform a 1D interpolation through a handle, without any handle or
+///     bounds validation. This is a hot-path variant of interp1D() intended for
+///     callers which have already range-checked their inputs (e.g., once, at
+///     initialization); the results for in-domain queries are identical. Out-of-domain
+///     queries are linearly extrapolated, and a null handle is undefined behaviour.
+///
+/// \param handle A (valid) handle to the interpolation data.
+///
+/// \param interp_x The query value to be interpolated.
+///
+/// \param cursor_ptr A pointer to a caller-held cursor (optional).
+///
+/// \return An interpolation of the given query value.
+///
+
+double Interpolator :: interp1DUnchecked(
+    InterpolatorHandle1D handle,
+    double interp_x,
+    InterpolatorCursor* cursor_ptr
+)
+{
+    const InterpolatorStruct1D* interp_struct_1D_ptr = handle.interp_struct_1D_ptr;
+    
+    //  1. get interpolation index
+    int idx = this->__getInterpolationIndex(
+        interp_x,
+        &(interp_struct_1D_ptr->x_vec),
+        interp_struct_1D_ptr->is_uniform_x,
+        interp_struct_1D_ptr->inv_dx,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_x)
     );
     
-    //  3. perform first horizontal interpolation
-    double x_0 = this->interp_map_2D[data_key].x_vec[idx_x];
-    double x_1 = this->interp_map_2D[data_key].x_vec[idx_x + 1];
+    //  2. perform interpolation
+    double interp_y = interp_struct_1D_ptr->slope_vec[idx] *
+        (interp_x - interp_struct_1D_ptr->x_vec[idx]) + interp_struct_1D_ptr->y_vec[idx];
     
-    double z_0 = this->interp_map_2D[data_key].z_matrix[idx_y][idx_x];
-    double z_1 = this->interp_map_2D[data_key].z_matrix[idx_y][idx_x + 1];
+    return interp_y;
+}   /* interp1DUnchecked() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Interpolator :: interp2DUnchecked(
+///         InterpolatorHandle2D handle,
+///         double interp_x,
+///         double interp_y,
+///         InterpolatorCursor* cursor_ptr
+///     )
+///
+/// \brief Method to perform a 2D interpolation through a handle, without any handle or
+///     bounds validation. This is a hot-path variant of interp2D() intended for
+///     callers which have already range-checked their inputs (e.g., once, at
+///     initialization); the results for in-domain queries are identical. Out-of-domain
+///     queries are linearly extrapolated, and a null handle is undefined behaviour.
+///
+/// \param handle A (valid) handle to the interpolation data.
+///
+/// \param interp_x The first query value to be interpolated.
+///
+/// \param interp_y The second query value to be interpolated.
+///
+/// \param cursor_ptr A pointer to a caller-held cursor (optional).
+///
+/// \return An interpolation of the given query values.
+///
+
+double Interpolator :: interp2DUnchecked(
+    InterpolatorHandle2D handle,
+    double interp_x,
+    double interp_y,
+    InterpolatorCursor* cursor_ptr
+)
+{
+    const InterpolatorStruct2D* interp_struct_2D_ptr = handle.interp_struct_2D_ptr;
+    
+    //  1. get interpolation indices
+    int idx_x = this->__getInterpolationIndex(
+        interp_x,
+        &(interp_struct_2D_ptr->x_vec),
+        interp_struct_2D_ptr->is_uniform_x,
+        interp_struct_2D_ptr->inv_dx,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_x)
+    );
     
-    double interp_z_0 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    int idx_y = this->__getInterpolationIndex(
+        interp_y,
+        &(interp_struct_2D_ptr->y_vec),
+        interp_struct_2D_ptr->is_uniform_y,
+        interp_struct_2D_ptr->inv_dy,
+        cursor_ptr == nullptr ? nullptr : &(cursor_ptr->idx_y)
+    );
     
-    //  4. perform second horizontal interpolation
-    z_0 = this->interp_map_2D[data_key].z_matrix[idx_y + 1][idx_x];
-    z_1 = this->interp_map_2D[data_key].z_matrix[idx_y + 1][idx_x + 1];
+    //  2. get fractional position within cell
+    double t_x = (interp_x - interp_struct_2D_ptr->x_vec[idx_x]) *
+        interp_struct_2D_ptr->inv_dx_vec[idx_x];
     
-    double interp_z_1 = ((z_1 - z_0) / (x_1 - x_0)) * (interp_x - x_0) + z_0;
+    double t_y = (interp_y - interp_struct_2D_ptr->y_vec[idx_y]) *
+        interp_struct_2D_ptr->inv_dy_vec[idx_y];
     
-    //  5. perform vertical interpolation
-    double y_0 = this->interp_map_2D[data_key].y_vec[idx_y];
-    double y_1 = this->interp_map_2D[data_key].y_vec[idx_y + 1];
+    //  3. blend cell corners
+    const double* z_row_0_ptr = interp_struct_2D_ptr->z_vec.data() +
+        idx_y * interp_struct_2D_ptr->n_cols + idx_x;
     
-    double interp_z =
-        ((interp_z_1 - interp_z_0) / (y_1 - y_0)) * (interp_y - y_0) + interp_z_0;
+    double interp_z = this->__bilinearKernel(
+        z_row_0_ptr,
+        z_row_0_ptr + interp_struct_2D_ptr->n_cols,
+        t_x,
+        t_y
+    );
     
     return interp_z;
-}   /* interp2D() */
+}   /* interp2DUnchecked() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp1DBatch(
+///         int data_key,
+///         std::vector<double>* interp_x_vec_ptr,
+///         std::vector<double>* interp_y_vec_ptr
+///     )
+///
+/// \brief Method to perform a batch of 1D interpolations. The data key and bounds are
+///     checked once per batch (rather than once per query), and the results are the
+///     same as those of interp1D() (including under the bounds policy of the table).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_x_vec_ptr A pointer to the vector of query values to be interpolated.
+///     If any value is outside the domain of the associated interpolation data, then
+///     the bounds policy of the table applies.
+///
+/// \param interp_y_vec_ptr A pointer to the vector to which the interpolations of the
+///     given query values are written (resized to match, if need be).
+///
+
+void Interpolator :: interp1DBatch(
+    int data_key,
+    std::vector<double>* interp_x_vec_ptr,
+    std::vector<double>* interp_y_vec_ptr
+)
+{
+    int n_queries = interp_x_vec_ptr->size();
+    interp_y_vec_ptr->resize(n_queries, 0);
+    
+    const InterpolatorStruct1D* interp_struct_1D_ptr =
+        this->getHandle1D(data_key).interp_struct_1D_ptr;
+    
+    if (n_queries == 0) {
+        return;
+    }
+    
+    //  1. check bounds (once, on the batch extremes)
+    double min_interp_x = *std::min_element(
+        interp_x_vec_ptr->begin(),
+        interp_x_vec_ptr->end()
+    );
+    
+    double max_interp_x = *std::max_element(
+        interp_x_vec_ptr->begin(),
+        interp_x_vec_ptr->end()
+    );
+    
+    this->__checkBounds1D(interp_struct_1D_ptr, &min_interp_x);
+    this->__checkBounds1D(interp_struct_1D_ptr, &max_interp_x);
+    
+    const double* interp_x_ptr = interp_x_vec_ptr->data();
+    
+    std::vector<double> clamped_x_vec;
+    
+    if (interp_struct_1D_ptr->bounds_policy == InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP) {
+        clamped_x_vec.resize(n_queries, 0);
+        
+        for (int i = 0; i < n_queries; i++) {
+            clamped_x_vec[i] = std::min(
+                std::max(interp_x_ptr[i], interp_struct_1D_ptr->min_x),
+                interp_struct_1D_ptr->max_x
+            );
+        }
+        
+        interp_x_ptr = clamped_x_vec.data();
+    }
+    double* interp_y_ptr = interp_y_vec_ptr->data();
+    
+    const double* x_ptr = interp_struct_1D_ptr->x_vec.data();
+    const double* y_ptr = interp_struct_1D_ptr->y_vec.data();
+    const double* slope_ptr = interp_struct_1D_ptr->slope_vec.data();
+    
+    //  2. get interpolation indices (hinted, since batches are often series)
+    std::vector<int> idx_vec(n_queries, 0);
+    int hint = -1;
+    
+    for (int i = 0; i < n_queries; i++) {
+        idx_vec[i] = this->__getInterpolationIndex(
+            interp_x_ptr[i],
+            &(interp_struct_1D_ptr->x_vec),
+            interp_struct_1D_ptr->is_uniform_x,
+            interp_struct_1D_ptr->inv_dx,
+            &hint
+        );
+    }
+    
+    //  3. perform interpolations (branch-free)
+    for (int i = 0; i < n_queries; i++) {
+        int idx = idx_vec[i];
+        
+        interp_y_ptr[i] = slope_ptr[idx] * (interp_x_ptr[i] - x_ptr[idx]) + y_ptr[idx];
+    }
+    
+    return;
+}   /* interp1DBatch() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Interpolator :: interp2DBatch(
+///         int data_key,
+///         std::vector<double>* interp_x_vec_ptr,
+///         std::vector<double>* interp_y_vec_ptr,
+///         std::vector<double>* interp_z_vec_ptr
+///     )
+///
+/// \brief Method to perform a batch of 2D interpolations. The data key and bounds are
+///     checked once per batch (rather than once per query), and the results are the
+///     same as those of interp2D() (including under the bounds policy of the table).
+///
+/// \param data_key A key used to index into the Interpolator.
+///
+/// \param interp_x_vec_ptr A pointer to the vector of first query values to be
+///     interpolated. If any value is outside the domain of the associated
+///     interpolation data, then the bounds policy of the table applies.
+///
+/// \param interp_y_vec_ptr A pointer to the vector of second query values to be
+///     interpolated (must be the same length as the first). If any value is outside
+///     the domain of the associated interpolation data, then the bounds policy of the
+///     table applies.
+///
+/// \param interp_z_vec_ptr A pointer to the vector to which the interpolations of the
+///     given query values are written (resized to match, if need be).
+///
+
+void Interpolator :: interp2DBatch(
+    int data_key,
+    std::vector<double>* interp_x_vec_ptr,
+    std::vector<double>* interp_y_vec_ptr,
+    std::vector<double>* interp_z_vec_ptr
+)
+{
+    //  1. check lengths
+    if (interp_x_vec_ptr->size() != interp_y_vec_ptr->size()) {
+        std::string error_str = "ERROR:  Interpolator::interp2DBatch()  ";
+        error_str += "query vectors must be of the same length";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    int n_queries = interp_x_vec_ptr->size();
+    interp_z_vec_ptr->resize(n_queries, 0);
+    
+    const InterpolatorStruct2D* interp_struct_2D_ptr =
+        this->getHandle2D(data_key).interp_struct_2D_ptr;
+    
+    if (n_queries == 0) {
+        return;
+    }
+    
+    //  2. check bounds (once, on the batch extremes)
+    double min_interp_x = *std::min_element(
+        interp_x_vec_ptr->begin(),
+        interp_x_vec_ptr->end()
+    );
+    
+    double max_interp_x = *std::max_element(
+        interp_x_vec_ptr->begin(),
+        interp_x_vec_ptr->end()
+    );
+    
+    double min_interp_y = *std::min_element(
+        interp_y_vec_ptr->begin(),
+        interp_y_vec_ptr->end()
+    );
+    
+    double max_interp_y = *std::max_element(
+        interp_y_vec_ptr->begin(),
+        interp_y_vec_ptr->end()
+    );
+    
+    this->__checkBounds2D(interp_struct_2D_ptr, &min_interp_x, &min_interp_y);
+    this->__checkBounds2D(interp_struct_2D_ptr, &max_interp_x, &max_interp_y);
+    
+    const double* interp_x_ptr = interp_x_vec_ptr->data();
+    const double* interp_y_ptr = interp_y_vec_ptr->data();
+    
+    std::vector<double> clamped_x_vec;
+    std::vector<double> clamped_y_vec;
+    
+    if (interp_struct_2D_ptr->bounds_policy == InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP) {
+        clamped_x_vec.resize(n_queries, 0);
+        clamped_y_vec.resize(n_queries, 0);
+        
+        for (int i = 0; i < n_queries; i++) {
+            clamped_x_vec[i] = std::min(
+                std::max(interp_x_ptr[i], interp_struct_2D_ptr->min_x),
+                interp_struct_2D_ptr->max_x
+            );
+            
+            clamped_y_vec[i] = std::min(
+                std::max(interp_y_ptr[i], interp_struct_2D_ptr->min_y),
+                interp_struct_2D_ptr->max_y
+            );
+        }
+        
+        interp_x_ptr = clamped_x_vec.data();
+        interp_y_ptr = clamped_y_vec.data();
+    }
+    double* interp_z_ptr = interp_z_vec_ptr->data();
+    
+    const double* z_ptr = interp_struct_2D_ptr->z_vec.data();
+    int n_cols = interp_struct_2D_ptr->n_cols;
+    
+    //  3. perform interpolations (hinted, since batches are often series)
+    int hint_x = -1;
+    int hint_y = -1;
+    
+    for (int i = 0; i < n_queries; i++) {
+        int idx_x = this->__getInterpolationIndex(
+            interp_x_ptr[i],
+            &(interp_struct_2D_ptr->x_vec),
+            interp_struct_2D_ptr->is_uniform_x,
+            interp_struct_2D_ptr->inv_dx,
+            &hint_x
+        );
+        
+        int idx_y = this->__getInterpolationIndex(
+            interp_y_ptr[i],
+            &(interp_struct_2D_ptr->y_vec),
+            interp_struct_2D_ptr->is_uniform_y,
+            interp_struct_2D_ptr->inv_dy,
+            &hint_y
+        );
+        
+        double t_x = (interp_x_ptr[i] - interp_struct_2D_ptr->x_vec[idx_x]) *
+            interp_struct_2D_ptr->inv_dx_vec[idx_x];
+        
+        double t_y = (interp_y_ptr[i] - interp_struct_2D_ptr->y_vec[idx_y]) *
+            interp_struct_2D_ptr->inv_dy_vec[idx_y];
+        
+        const double* z_row_0_ptr = z_ptr + idx_y * n_cols + idx_x;
+        
+        interp_z_ptr[i] = this->__bilinearKernel(
+            z_row_0_ptr,
+            z_row_0_ptr + n_cols,
+            t_x,
+            t_y
+        );
+    }
+    
+    return;
+}   /* interp2DBatch() */
 
 // ---------------------------------------------------------------------------------- //
 
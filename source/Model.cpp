@@ -138,6 +138,18 @@ void Model :: __checkInputs(ModelInputs model_inputs)
         throw std::invalid_argument(error_str);
     }
     
+    //  4. check stream_window_points
+    if (model_inputs.stream_window_points < 0) {
+        std::string error_str = "ERROR:  Model():  ";
+        error_str += "ModelInputs::stream_window_points must be >= 0";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
     return;
 }   /* __checkInputs() */
 
@@ -351,24 +363,37 @@ void Model :: __computeEconomics(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Model :: __writeSummary(std::string write_path)
+/// \fn void Model :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Model.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Model :: __writeSummary(std::string write_path)
+void Model :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create subdirectory
+    //  1. get components to write from, and create subdirectory
+    ElectricalLoad* electrical_load_ptr = this->__getResultsElectricalLoad();
+    Resources* resources_ptr = this->__getResultsResources();
+    
     write_path += "Model/";
-    std::filesystem::create_directory(write_path);
+    if (not std::filesystem::is_directory(write_path)) {
+        std::filesystem::create_directory(write_path);
+    }
     
-    //  2. create filestream
+    //  2. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  3. write summary results (markdown)
     ofs << "# Model Summary Results\n";
@@ -378,12 +403,12 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "## Electrical Load\n";
     ofs << "\n";
     ofs << "Path: " <<
-        this->electrical_load.path_2_electrical_load_time_series << "  \n";
-    ofs << "Data Points: " << this->electrical_load.n_points << "  \n";
-    ofs << "Years: " << this->electrical_load.n_years << "  \n";
-    ofs << "Min: " << this->electrical_load.min_load_kW << " kW  \n";
-    ofs << "Mean: " << this->electrical_load.mean_load_kW << " kW  \n";
-    ofs << "Max: " << this->electrical_load.max_load_kW << " kW  \n";
+        electrical_load_ptr->path_2_electrical_load_time_series << "  \n";
+    ofs << "Data Points: " << electrical_load_ptr->n_points << "  \n";
+    ofs << "Years: " << electrical_load_ptr->n_years << "  \n";
+    ofs << "Min: " << electrical_load_ptr->min_load_kW << " kW  \n";
+    ofs << "Mean: " << electrical_load_ptr->mean_load_kW << " kW  \n";
+    ofs << "Max: " << electrical_load_ptr->max_load_kW << " kW  \n";
     ofs << "\n--------\n\n";
     
     //  3.2. Controller
@@ -401,6 +426,8 @@ void Model :: __writeSummary(std::string write_path)
         this->controller.firm_dispatch_ratio << "  \n";
     ofs << "Load Reserve Ratio: " <<
         this->controller.load_reserve_ratio << "  \n";
+    ofs << "\n";
+    ofs << "Fast Kernels (N = 0 / Y = 1): " << this->fast_kernels << "  \n";
     ofs << "\n--------\n\n";
     
     //  3.3. Resources (1D)
@@ -408,13 +435,13 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "\n";
     
     std::map<int, std::string>::iterator string_map_1D_iter =
-        this->resources.string_map_1D.begin();
+        resources_ptr->string_map_1D.begin();
     std::map<int, std::string>::iterator path_map_1D_iter =
-        this->resources.path_map_1D.begin();
+        resources_ptr->path_map_1D.begin();
     
     while (
-        string_map_1D_iter != this->resources.string_map_1D.end() and
-        path_map_1D_iter != this->resources.path_map_1D.end()
+        string_map_1D_iter != resources_ptr->string_map_1D.end() and
+        path_map_1D_iter != resources_ptr->path_map_1D.end()
     ) {
         ofs << "Resource Key: " << string_map_1D_iter->first << "  \n";
         ofs << "Type: " << string_map_1D_iter->second << "  \n";
@@ -432,13 +459,13 @@ void Model :: __writeSummary(std::string write_path)
     ofs << "\n";
     
     std::map<int, std::string>::iterator string_map_2D_iter =
-        this->resources.string_map_2D.begin();
+        resources_ptr->string_map_2D.begin();
     std::map<int, std::string>::iterator path_map_2D_iter =
-        this->resources.path_map_2D.begin();
+        resources_ptr->path_map_2D.begin();
     
     while (
-        string_map_2D_iter != this->resources.string_map_2D.end() and
-        path_map_2D_iter != this->resources.path_map_2D.end()
+        string_map_2D_iter != resources_ptr->string_map_2D.end() and
+        path_map_2D_iter != resources_ptr->path_map_2D.end()
     ) {
         ofs << "Resource Key: " << string_map_2D_iter->first << "  \n";
         ofs << "Type: " << string_map_2D_iter->second << "  \n";
@@ -549,48 +576,48 @@ void Model :: __writeSummary(std::string write_path)
     
     ofs << "Total Fuel Consumed: " << this->total_fuel_consumed_L << " L "
         << "(Annual Average: " <<
-            this->total_fuel_consumed_L / this->electrical_load.n_years
+            this->total_fuel_consumed_L / electrical_load_ptr->n_years
         << " L/yr)  \n";
     ofs << "\n";
     
     ofs << "Total Carbon Dioxide (CO2) Emissions: " <<
         this->total_emissions.CO2_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CO2_kg / this->electrical_load.n_years
+            this->total_emissions.CO2_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Carbon Monoxide (CO) Emissions: " <<
         this->total_emissions.CO_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CO_kg / this->electrical_load.n_years
+            this->total_emissions.CO_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Nitrogen Oxides (NOx) Emissions: " <<
         this->total_emissions.NOx_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.NOx_kg / this->electrical_load.n_years
+            this->total_emissions.NOx_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Sulfur Oxides (SOx) Emissions: " <<
         this->total_emissions.SOx_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.SOx_kg / this->electrical_load.n_years
+            this->total_emissions.SOx_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Methane (CH4) Emissions: " << this->total_emissions.CH4_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.CH4_kg / this->electrical_load.n_years
+            this->total_emissions.CH4_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "Total Particulate Matter (PM) Emissions: " <<
         this->total_emissions.PM_kg << " kg "
         << "(Annual Average: " << 
-            this->total_emissions.PM_kg / this->electrical_load.n_years
+            this->total_emissions.PM_kg / electrical_load_ptr->n_years
         << " kg/yr)  \n";
         
     ofs << "\n--------\n\n";
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeSummary() */
 
@@ -601,7 +628,11 @@ void Model :: __writeSummary(std::string write_path)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Model :: __writeTimeSeries(std::string write_path, int max_lines)
+/// \fn void Model :: __writeTimeSeries(
+///         std::string write_path,
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write time series results for Model.
 ///
@@ -610,13 +641,22 @@ void Model :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Model :: __writeTimeSeries(std::string write_path, int max_lines)
+void Model :: __writeTimeSeries(
+    std::string write_path,
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. get ElectricalLoad to write from, and create output stream (buffered,
+    //     written out via results manifest)
+    ElectricalLoad* electrical_load_ptr = this->__getResultsElectricalLoad();
+    
     write_path += "Model/time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results header (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -652,8 +692,8 @@ void Model :: __writeTimeSeries(std::string write_path, int max_lines)
     //  3. write time series results values (comma separated value)
     for (int i = 0; i < max_lines; i++) {
         //  3.1. load values
-        ofs << this->electrical_load.time_vec_hrs[i] << ",";
-        ofs << this->electrical_load.load_vec_kW[i] << ",";
+        ofs << electrical_load_ptr->time_vec_hrs[i] << ",";
+        ofs << electrical_load_ptr->load_vec_kW[i] << ",";
         ofs << this->controller.net_load_vec_kW[i] << ",";
         ofs << this->controller.missed_load_vec_kW[i] << ",";
         ofs << this->controller.missed_firm_dispatch_vec_kW[i] << ",";
@@ -679,12 +719,775 @@ void Model :: __writeTimeSeries(std::string write_path, int max_lines)
         ofs << "\n";
     }
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeTimeSeries() */
 
 // ---------------------------------------------------------------------------------- //
 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __createAssetDirectories(std::string write_path)
+///
+/// \brief Helper method to create the shared asset subdirectories (Production/,
+///     Production/Combustion/, etc.) up front, so that concurrent per-asset writes
+///     never race on directory creation.
+///
+/// \param write_path A path (either relative or absolute) to the directory location 
+///     where results are to be written.
+///
+
+void Model :: __createAssetDirectories(std::string write_path)
+{
+    //  1. build list of required subdirectories
+    std::vector<std::string> subdirectory_vec;
+    
+    if (
+        not this->combustion_ptr_vec.empty() or
+        not this->noncombustion_ptr_vec.empty() or
+        not this->renewable_ptr_vec.empty()
+    ) {
+        subdirectory_vec.push_back("Production/");
+    }
+    
+    if (not this->combustion_ptr_vec.empty()) {
+        subdirectory_vec.push_back("Production/Combustion/");
+    }
+    
+    if (not this->noncombustion_ptr_vec.empty()) {
+        subdirectory_vec.push_back("Production/Noncombustion/");
+    }
+    
+    if (not this->renewable_ptr_vec.empty()) {
+        subdirectory_vec.push_back("Production/Renewable/");
+    }
+    
+    if (not this->storage_ptr_vec.empty()) {
+        subdirectory_vec.push_back("Storage/");
+    }
+    
+    //  2. create (in order, so that parents precede children)
+    for (size_t i = 0; i < subdirectory_vec.size(); i++) {
+        std::string subdirectory_path = write_path + subdirectory_vec[i];
+        
+        if (not std::filesystem::is_directory(subdirectory_path)) {
+            std::filesystem::create_directory(subdirectory_path);
+        }
+    }
+    
+    return;
+}   /* __createAssetDirectories() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __writeAssetResults(
+///         std::string write_path,
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
+///     )
+///
+/// \brief Helper method to call out to writeResults() for each contained asset. Since
+///     each asset writes to its own subdirectory, the calls are independent and so
+///     are fanned out over a pool of worker threads (sized by the hardware
+///     concurrency). Any exception thrown by a worker is re-thrown once all workers
+///     have been joined.
+///
+/// \param write_path A path (either relative or absolute) to the directory location 
+///     where results are to be written.
+///
+/// \param max_lines The maximum number of lines of output to write.
+///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
+
+void Model :: __writeAssetResults(
+    std::string write_path,
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
+)
+{
+    //  1. build task list (one task per asset)
+    std::vector<std::function<void(void)>> task_vec;
+    
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        task_vec.push_back(
+            [this, &write_path, i, max_lines, results_manifest_ptr]() {
+                this->combustion_ptr_vec[i]->writeResults(
+                    write_path,
+                    &(this->__getResultsElectricalLoad()->time_vec_hrs),
+                    i,
+                    max_lines,
+                    results_manifest_ptr
+                );
+            }
+        );
+    }
+    
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        task_vec.push_back(
+            [this, &write_path, i, max_lines, results_manifest_ptr]() {
+                this->noncombustion_ptr_vec[i]->writeResults(
+                    write_path,
+                    &(this->__getResultsElectricalLoad()->time_vec_hrs),
+                    i,
+                    max_lines,
+                    results_manifest_ptr
+                );
+            }
+        );
+    }
+    
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        task_vec.push_back(
+            [this, &write_path, i, max_lines, results_manifest_ptr]() {
+                this->renewable_ptr_vec[i]->writeResults(
+                    write_path,
+                    &(this->__getResultsElectricalLoad()->time_vec_hrs),
+                    &(this->__getResultsResources()->resource_map_1D),
+                    &(this->__getResultsResources()->resource_map_2D),
+                    i,
+                    max_lines,
+                    results_manifest_ptr
+                );
+            }
+        );
+    }
+    
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        task_vec.push_back(
+            [this, &write_path, i, max_lines, results_manifest_ptr]() {
+                this->storage_ptr_vec[i]->writeResults(
+                    write_path,
+                    &(this->__getResultsElectricalLoad()->time_vec_hrs),
+                    i,
+                    max_lines,
+                    results_manifest_ptr
+                );
+            }
+        );
+    }
+    
+    if (task_vec.empty()) {
+        return;
+    }
+    
+    //  2. size worker pool
+    size_t n_workers = std::thread::hardware_concurrency();
+    
+    if (n_workers == 0) {
+        n_workers = 1;
+    }
+    
+    if (n_workers > task_vec.size()) {
+        n_workers = task_vec.size();
+    }
+    
+    //  3. define worker (pulls tasks off shared index until exhausted)
+    std::atomic<size_t> next_task(0);
+    std::exception_ptr exception_ptr = nullptr;
+    std::mutex exception_mutex;
+    
+    auto worker = [&task_vec, &next_task, &exception_ptr, &exception_mutex]() {
+        while (true) {
+            size_t task_idx = next_task.fetch_add(1);
+            
+            if (task_idx >= task_vec.size()) {
+                break;
+            }
+            
+            try {
+                task_vec[task_idx]();
+            }
+            
+            catch (...) {
+                std::lock_guard<std::mutex> lock(exception_mutex);
+                
+                if (exception_ptr == nullptr) {
+                    exception_ptr = std::current_exception();
+                }
+            }
+        }
+    };
+    
+    //  4. run (calling thread is also a worker), then join
+    std::vector<std::thread> thread_vec;
+    
+    for (size_t i = 1; i < n_workers; i++) {
+        thread_vec.push_back(std::thread(worker));
+    }
+    
+    worker();
+    
+    for (size_t i = 0; i < thread_vec.size(); i++) {
+        thread_vec[i].join();
+    }
+    
+    //  5. re-throw first exception (if any)
+    if (exception_ptr != nullptr) {
+        std::rethrow_exception(exception_ptr);
+    }
+    
+    return;
+}   /* __writeAssetResults() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ElectricalLoad* Model :: __getResultsElectricalLoad(void)
+///
+/// \brief Helper method to get the ElectricalLoad that results are to be written from.
+///     This is the shared (read-only) copy if this Model is a results snapshot, and
+///     the ElectricalLoad component of this Model otherwise.
+///
+/// \return A pointer to the ElectricalLoad that results are to be written from.
+///
+
+ElectricalLoad* Model :: __getResultsElectricalLoad(void)
+{
+    if (this->is_results_snapshot) {
+        return this->shared_electrical_load_ptr.get();
+    }
+    
+    return &(this->electrical_load);
+}   /* __getResultsElectricalLoad() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Resources* Model :: __getResultsResources(void)
+///
+/// \brief Helper method to get the Resources that results are to be written from. This
+///     is the shared (read-only) copy if this Model is a results snapshot, and the
+///     Resources component of this Model otherwise.
+///
+/// \return A pointer to the Resources that results are to be written from.
+///
+
+Resources* Model :: __getResultsResources(void)
+{
+    if (this->is_results_snapshot) {
+        return this->shared_resources_ptr.get();
+    }
+    
+    return &(this->resources);
+}   /* __getResultsResources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool Model :: __sharedComponentsAreStale(void)
+///
+/// \brief Helper method to check whether or not the shared copies of the
+///     ElectricalLoad and Resources (see __snapshotResults()) need to be re-taken.
+///     Neither is touched by reset(), and resources are only ever added (either by
+///     addResource() or by lazy loading), so it suffices to compare sizes. Streaming
+///     windows change from window to window, and so are always stale.
+///
+/// \return A boolean which indicates whether or not the shared copies are stale.
+///
+
+bool Model :: __sharedComponentsAreStale(void)
+{
+    if (
+        this->shared_electrical_load_ptr == nullptr or
+        this->shared_resources_ptr == nullptr
+    ) {
+        return true;
+    }
+    
+    if (this->electrical_load.is_streaming or this->resources.is_streaming) {
+        return true;
+    }
+    
+    if (
+        this->shared_electrical_load_ptr->n_points != this->electrical_load.n_points or
+        this->shared_electrical_load_ptr->path_2_electrical_load_time_series !=
+            this->electrical_load.path_2_electrical_load_time_series
+    ) {
+        return true;
+    }
+    
+    Resources* copy_ptr = this->shared_resources_ptr.get();
+    
+    return
+        copy_ptr->resource_map_1D.size() != this->resources.resource_map_1D.size() or
+        copy_ptr->resource_map_2D.size() != this->resources.resource_map_2D.size() or
+        copy_ptr->path_map_1D.size() != this->resources.path_map_1D.size() or
+        copy_ptr->path_map_2D.size() != this->resources.path_map_2D.size();
+}   /* __sharedComponentsAreStale() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn Model* Model :: __snapshotResults(void)
+///
+/// \brief Helper method to snapshot the results of the Model into a new (detached)
+///     Model, for use by the background results writer. Only what the writers read is
+///     snapshot: ownership of the assets and the Controller time series is moved to
+///     the snapshot, and the ElectricalLoad and Resources (which reset() leaves alone)
+///     are shared read-only, copied once and re-used by every snapshot until stale
+///     (see __sharedComponentsAreStale()). So, the memory held by pending writes does
+///     not grow with whole-horizon copies of the Resources or ElectricalLoad. On
+///     return, this Model is in the same state as after reset().
+///
+/// \return A pointer to a new Model which owns the snapshot.
+///
+
+Model* Model :: __snapshotResults(void)
+{
+    Model* snapshot_ptr = new Model();
+    snapshot_ptr->is_results_snapshot = true;
+    
+    //  1. share ElectricalLoad and Resources (re-taking shared copies, if stale)
+    if (this->__sharedComponentsAreStale()) {
+        this->shared_electrical_load_ptr =
+            std::make_shared<ElectricalLoad>(this->electrical_load);
+        this->shared_resources_ptr = std::make_shared<Resources>(this->resources);
+    }
+    
+    snapshot_ptr->shared_electrical_load_ptr = this->shared_electrical_load_ptr;
+    snapshot_ptr->shared_resources_ptr = this->shared_resources_ptr;
+    
+    //  2. copy Controller settings, and move Controller time series (these are
+    //     cleared by reset() anyway)
+    snapshot_ptr->controller.control_mode = this->controller.control_mode;
+    snapshot_ptr->controller.control_string = this->controller.control_string;
+    snapshot_ptr->controller.firm_dispatch_ratio = this->controller.firm_dispatch_ratio;
+    snapshot_ptr->controller.load_reserve_ratio = this->controller.load_reserve_ratio;
+    
+    snapshot_ptr->controller.net_load_vec_kW.swap(this->controller.net_load_vec_kW);
+    snapshot_ptr->controller.missed_load_vec_kW.swap(
+        this->controller.missed_load_vec_kW
+    );
+    snapshot_ptr->controller.missed_firm_dispatch_vec_kW.swap(
+        this->controller.missed_firm_dispatch_vec_kW
+    );
+    snapshot_ptr->controller.missed_spinning_reserve_vec_kW.swap(
+        this->controller.missed_spinning_reserve_vec_kW
+    );
+    
+    //  3. copy totals
+    snapshot_ptr->total_fuel_consumed_L = this->total_fuel_consumed_L;
+    snapshot_ptr->total_emissions = this->total_emissions;
+    snapshot_ptr->net_present_cost = this->net_present_cost;
+    
+    snapshot_ptr->total_renewable_noncombustion_dispatch_kWh =
+        this->total_renewable_noncombustion_dispatch_kWh;
+    snapshot_ptr->total_renewable_noncombustion_charge_kWh =
+        this->total_renewable_noncombustion_charge_kWh;
+    snapshot_ptr->total_combustion_charge_kWh = this->total_combustion_charge_kWh;
+    snapshot_ptr->total_discharge_kWh = this->total_discharge_kWh;
+    snapshot_ptr->total_dispatch_kWh = this->total_dispatch_kWh;
+    snapshot_ptr->renewable_penetration = this->renewable_penetration;
+    
+    snapshot_ptr->levellized_cost_of_energy_kWh = this->levellized_cost_of_energy_kWh;
+    
+    snapshot_ptr->fast_kernels = this->fast_kernels;
+    
+    //  4. move assets (snapshot takes ownership)
+    snapshot_ptr->combustion_ptr_vec.swap(this->combustion_ptr_vec);
+    snapshot_ptr->noncombustion_ptr_vec.swap(this->noncombustion_ptr_vec);
+    snapshot_ptr->renewable_ptr_vec.swap(this->renewable_ptr_vec);
+    snapshot_ptr->storage_ptr_vec.swap(this->storage_ptr_vec);
+    
+    //  5. reset (asset pointer vectors are now empty, so nothing is deleted)
+    this->reset();
+    
+    return snapshot_ptr;
+}   /* __snapshotResults() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __resultsWriterLoop(void)
+///
+/// \brief Helper method (run on the background results writer thread) which drains
+///     results_writer_queue, writing and then freeing each snapshot in turn. Exits
+///     once told to stop and the queue is empty.
+///
+
+void Model :: __resultsWriterLoop(void)
+{
+    std::unique_lock<std::mutex> lock(this->results_writer_mutex);
+    
+    while (true) {
+        //  1. wait for work (or stop)
+        this->results_writer_cv.wait(
+            lock,
+            [this]() {
+                return this->results_writer_stop or
+                    not this->results_writer_queue.empty();
+            }
+        );
+        
+        if (this->results_writer_queue.empty()) {
+            break;
+        }
+        
+        ResultsWriteJob job = std::move(this->results_writer_queue.front());
+        this->results_writer_queue.pop_front();
+        
+        //  2. write (unlocked), then free snapshot
+        lock.unlock();
+        
+        std::exception_ptr exception_ptr = nullptr;
+        
+        try {
+            job.snapshot_ptr->writeResults(
+                job.write_path,
+                job.max_lines,
+                job.incremental
+            );
+        }
+        
+        catch (...) {
+            exception_ptr = std::current_exception();
+        }
+        
+        delete job.snapshot_ptr;
+        
+        //  3. fulfill promise, update state, and notify
+        if (exception_ptr == nullptr) {
+            job.promise.set_value();
+        }
+        
+        else {
+            job.promise.set_exception(exception_ptr);
+        }
+        
+        lock.lock();
+        
+        if (
+            exception_ptr != nullptr and
+            this->results_writer_exception_ptr == nullptr
+        ) {
+            this->results_writer_exception_ptr = exception_ptr;
+        }
+        
+        this->results_writer_n_pending--;
+        this->results_writer_cv.notify_all();
+    }
+    
+    return;
+}   /* __resultsWriterLoop() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __stopResultsWriter(void)
+///
+/// \brief Helper method to stop the background results writer thread (if running).
+///     Any pending writes are completed first.
+///
+
+void Model :: __stopResultsWriter(void)
+{
+    if (not this->results_writer_thread.joinable()) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(this->results_writer_mutex);
+        this->results_writer_stop = true;
+    }
+    
+    this->results_writer_cv.notify_all();
+    this->results_writer_thread.join();
+    
+    this->results_writer_stop = false;
+    
+    return;
+}   /* __stopResultsWriter() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __runWindow(void)
+///
+/// \brief Helper method to init the Controller and apply dispatch control over the
+///     current window (the whole modelling time series, unless streaming).
+///
+
+void Model :: __runWindow(void)
+{
+    //  1. init Controller
+    this->controller.init(
+        &(this->electrical_load),
+        &(this->renewable_ptr_vec),
+        &(this->resources),
+        &(this->combustion_ptr_vec),
+        &(this->noncombustion_ptr_vec)
+    );
+    
+    //  2. apply dispatch control
+    this->controller.applyDispatchControl(
+        &(this->electrical_load),
+        &(this->resources),
+        &(this->combustion_ptr_vec),
+        &(this->noncombustion_ptr_vec),
+        &(this->renewable_ptr_vec),
+        &(this->storage_ptr_vec)
+    );
+    
+    return;
+}   /* __runWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __accumulateWindow(void)
+///
+/// \brief Helper method to accumulate the asset-wise fuel consumption, emissions, and
+///     net present costs of the current (non-final) streaming window. These asset-wise
+///     computations are all additive over time, and so the final window is simply
+///     handled by run() as usual.
+///
+
+void Model :: __accumulateWindow(void)
+{
+    //  1. accumulate Combustion fuel consumption, emissions, and economics
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        this->combustion_ptr_vec[i]->computeFuelAndEmissions();
+        
+        this->combustion_ptr_vec[i]->computeEconomics(
+            &(this->electrical_load.time_vec_hrs)
+        );
+    }
+    
+    //  2. accumulate Noncombustion economics
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        this->noncombustion_ptr_vec[i]->computeEconomics(
+            &(this->electrical_load.time_vec_hrs)
+        );
+    }
+    
+    //  3. accumulate Renewable economics
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        this->renewable_ptr_vec[i]->computeEconomics(
+            &(this->electrical_load.time_vec_hrs)
+        );
+    }
+    
+    //  4. accumulate Storage economics
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        this->storage_ptr_vec[i]->computeEconomics(
+            &(this->electrical_load.time_vec_hrs)
+        );
+    }
+    
+    return;
+}   /* __accumulateWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __resetWindow(void)
+///
+/// \brief Helper method to begin a new streaming window, by resizing (and zeroing) the
+///     time series of the Controller and of every asset to the current window.
+///
+
+void Model :: __resetWindow(void)
+{
+    int n_points = this->electrical_load.n_points;
+    
+    //  1. reset Controller
+    this->controller.clear();
+    
+    //  2. reset assets
+    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
+        this->combustion_ptr_vec[i]->resetWindow(n_points);
+    }
+    
+    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
+        this->noncombustion_ptr_vec[i]->resetWindow(n_points);
+    }
+    
+    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
+        this->renewable_ptr_vec[i]->resetWindow(n_points);
+    }
+    
+    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
+        this->storage_ptr_vec[i]->resetWindow(n_points);
+    }
+    
+    return;
+}   /* __resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __writeWindowResults(std::string write_path)
+///
+/// \brief Helper method to write the time series results of the current streaming
+///     window (Model and asset-wise) to the given directory.
+///
+/// \param write_path A path (either relative or absolute) to the directory location
+///     where window results are to be written. If already exists, will overwrite.
+///
+
+void Model :: __writeWindowResults(std::string write_path)
+{
+    //  1. create (clean) directory
+    if (std::filesystem::is_directory(write_path)) {
+        std::filesystem::remove_all(write_path);
+    }
+    
+    std::filesystem::create_directories(write_path + "Model/");
+    
+    //  2. write Model time series
+    ResultsManifest results_manifest(write_path);
+    
+    int max_lines = this->electrical_load.n_points;
+    
+    this->__writeTimeSeries(write_path, max_lines, &results_manifest);
+    
+    //  3. write asset results
+    this->__createAssetDirectories(write_path);
+    this->__writeAssetResults(write_path, max_lines, &results_manifest);
+    
+    results_manifest.writeManifest();
+    
+    return;
+}   /* __writeWindowResults() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: __runStreaming(void)
+///
+/// \brief Helper method to run dispatch control window by window over a streamed
+///     electrical load (and resources). All asset state carries across windows. The
+///     results of each window are accumulated into the asset-wise totals and, if
+///     stream_sink_path is given, written to disk.
+///
+
+void Model :: __runStreaming(void)
+{
+    //  1. check that streams are at the first window
+    if (this->electrical_load.window_start != 0) {
+        std::string error_str = "ERROR:  Model::run():  ";
+        error_str += "streaming Model must be reset() before being run again";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::runtime_error(error_str);
+    }
+    
+    //  2. open streams for bound resources only (reads in first window)
+    std::vector<int> resource_keys_1D;
+    std::vector<int> resource_keys_2D;
+    
+    this->controller.getBoundResourceKeys(
+        &(this->renewable_ptr_vec),
+        &(this->noncombustion_ptr_vec),
+        &resource_keys_1D,
+        &resource_keys_2D
+    );
+    
+    this->resources.openResourceStreams(
+        &(this->electrical_load),
+        &resource_keys_1D,
+        &resource_keys_2D
+    );
+    
+    int window = 0;
+    
+    while (true) {
+        //  3. run window
+        this->__runWindow();
+        
+        //  4. write window results (if sink given)
+        if (not this->stream_sink_path.empty()) {
+            std::string window_path = this->stream_sink_path;
+            
+            if (window_path.back() != '/') {
+                window_path += '/';
+            }
+            
+            window_path += "window_" + std::to_string(window) + "/";
+            
+            this->__writeWindowResults(window_path);
+        }
+        
+        //  5. if final window, stop (accumulated by run())
+        if (
+            this->electrical_load.window_start + this->electrical_load.n_points >=
+            this->electrical_load.n_points_total
+        ) {
+            break;
+        }
+        
+        //  6. accumulate window
+        this->__accumulateWindow();
+        
+        //  7. advance electrical load and resources, reset time series
+        this->electrical_load.readLoadWindow();
+        this->resources.readResourceWindows(&(this->electrical_load));
+        
+        this->__resetWindow();
+        
+        window++;
+    }
+    
+    return;
+}   /* __runStreaming() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -723,8 +1526,19 @@ Model :: Model(ModelInputs model_inputs)
     //  1. check inputs
     this->__checkInputs(model_inputs);
     
-    //  2. read in electrical load data
-    this->electrical_load.readLoadData(model_inputs.path_2_electrical_load_time_series);
+    //  2. read in electrical load data (or open for streaming)
+    if (model_inputs.stream_window_points > 0) {
+        this->electrical_load.openLoadStream(
+            model_inputs.path_2_electrical_load_time_series,
+            model_inputs.stream_window_points
+        );
+    }
+    
+    else {
+        this->electrical_load.readLoadData(
+            model_inputs.path_2_electrical_load_time_series
+        );
+    }
     
     //  3. set controller attributes
     this->controller.setControlMode(model_inputs.control_mode);
@@ -736,8 +1550,16 @@ Model :: Model(ModelInputs model_inputs)
     this->controller.setFirmDispatchRatio(model_inputs.firm_dispatch_ratio);
     this->controller.setLoadReserveRatio(model_inputs.load_reserve_ratio);
     
+    //  4. set resources attributes (streamed resources must be registered, not read)
+    this->resources.lazy_loading = (
+        model_inputs.lazy_resource_loading or
+        model_inputs.stream_window_points > 0
+    );
+    
+    
+    //  5. set public attributes
+    this->fast_kernels = model_inputs.fast_kernels;
     
-    //  4. set public attributes
     this->total_fuel_consumed_L = 0;
     this->net_present_cost = 0;
     
@@ -776,6 +1598,8 @@ void Model :: addDiesel(DieselInputs diesel_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    diesel_ptr->fast_kernels = this->fast_kernels;
+    
     this->combustion_ptr_vec.push_back(diesel_ptr);
     
     return;
@@ -880,6 +1704,8 @@ void Model :: addHydro(HydroInputs hydro_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    hydro_ptr->fast_kernels = this->fast_kernels;
+    
     this->noncombustion_ptr_vec.push_back(hydro_ptr);
     
     return;
@@ -908,6 +1734,8 @@ void Model :: addSolar(SolarInputs solar_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    solar_ptr->fast_kernels = this->fast_kernels;
+    
     this->renewable_ptr_vec.push_back(solar_ptr);
     
     return;
@@ -936,6 +1764,8 @@ void Model :: addTidal(TidalInputs tidal_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    tidal_ptr->fast_kernels = this->fast_kernels;
+    
     this->renewable_ptr_vec.push_back(tidal_ptr);
     
     return;
@@ -964,6 +1794,8 @@ void Model :: addWave(WaveInputs wave_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    wave_ptr->fast_kernels = this->fast_kernels;
+    
     this->renewable_ptr_vec.push_back(wave_ptr);
     
     return;
@@ -992,6 +1824,8 @@ void Model :: addWind(WindInputs wind_inputs)
         &(this->electrical_load.time_vec_hrs)
     );
     
+    wind_ptr->fast_kernels = this->fast_kernels;
+    
     this->renewable_ptr_vec.push_back(wind_ptr);
     
     return;
@@ -1019,6 +1853,8 @@ void Model :: addLiIon(LiIonInputs liion_inputs)
         liion_inputs
     );
     
+    liion_ptr->fast_kernels = this->fast_kernels;
+    
     this->storage_ptr_vec.push_back(liion_ptr);
     
     return;
@@ -1033,36 +1869,32 @@ void Model :: addLiIon(LiIonInputs liion_inputs)
 ///
 /// \fn void Model :: run(void)
 ///
-/// \brief A method to run the Model.
+/// \brief A method to run the Model. If streaming (see ModelInputs::stream_window_points),
+///     then the Model is run window by window, with all asset state carried across
+///     windows and totals accumulated as it goes. In that case, on return, the time
+///     series attributes of the Model hold only the final window (earlier windows are
+///     written to stream_sink_path, if given), and reset() must be called before
+///     running again.
 ///
 
 void Model :: run(void)
 {
-    // 1. init Controller
-    this->controller.init(
-        &(this->electrical_load),
-        &(this->renewable_ptr_vec),
-        &(this->resources),
-        &(this->combustion_ptr_vec)
-    );
+    //  1. init Controller and apply dispatch control (window by window, if streaming)
+    if (this->electrical_load.is_streaming) {
+        this->__runStreaming();
+    }
     
-    //  2. apply dispatch control
-    this->controller.applyDispatchControl(
-        &(this->electrical_load),
-        &(this->resources),
-        &(this->combustion_ptr_vec),
-        &(this->noncombustion_ptr_vec),
-        &(this->renewable_ptr_vec),
-        &(this->storage_ptr_vec)
-    );
+    else {
+        this->__runWindow();
+    }
     
-    //  3. compute total fuel consumption and emissions
+    //  2. compute total fuel consumption and emissions
     this->__computeFuelAndEmissions();
     
-    //  4. compute key economic metrics
+    //  3. compute key economic metrics
     this->__computeEconomics();
     
-    //  5. compute renewable penetration
+    //  4. compute renewable penetration
     this->renewable_penetration +=
         this->total_renewable_noncombustion_dispatch_kWh;
     
@@ -1129,9 +1961,20 @@ void Model :: reset(void)
     }
     this->storage_ptr_vec.clear();
     
-    //  5. reset components and attributes
+    //  5. reset components and attributes (rewinding streams, if streaming)
     this->controller.clear();
     
+    if (
+        this->electrical_load.is_streaming and
+        (
+            this->electrical_load.window_start != 0 or
+            this->resources.is_streaming
+        )
+    ) {
+        this->electrical_load.rewindLoadStream();
+        this->resources.closeResourceStreams();
+    }
+    
     this->total_fuel_consumed_L = 0;
     
     this->total_emissions.CO2_kg = 0;
@@ -1172,11 +2015,14 @@ void Model :: clear(void)
     //  1. reset
     this->reset();
     
-    //  2. clear components
+    //  2. clear components (and drop shared copies)
     controller.clear();
     electrical_load.clear();
     resources.clear();
     
+    this->shared_electrical_load_ptr = nullptr;
+    this->shared_resources_ptr = nullptr;
+    
     return;
 }   /* clear() */
 
@@ -1189,11 +2035,14 @@ void Model :: clear(void)
 ///
 /// \fn void Model :: writeResults(
 ///         std::string write_path,
-///         int max_lines
+///         int max_lines,
+///         bool incremental
 ///     )
 ///
 /// \brief Method which writes Model results to an output directory. Also calls out to
-///     writeResults() for each contained asset.
+///     writeResults() for each contained asset (these calls are independent, and so
+///     are distributed over a pool of worker threads). A manifest of content hashes
+///     (results_manifest.csv) is always written alongside the results.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
@@ -1201,23 +2050,31 @@ void Model :: clear(void)
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param incremental If true, then a pre-existing output directory is not removed.
+///     Instead, only files whose contents differ from those recorded in the manifest
+///     are (re-)written, and files recorded in the manifest but no longer written
+///     (e.g. those of removed assets) are pruned.
+///
 
 void Model :: writeResults(
     std::string write_path,
-    int max_lines
+    int max_lines,
+    bool incremental
 )
 {
     //  1. handle sentinel
+    int n_points = this->__getResultsElectricalLoad()->n_points;
+    
     if (max_lines < 0) {
-        max_lines = this->electrical_load.n_points;
+        max_lines = n_points;
     }
     
-    //  2. check for pre-existing, warn (and remove), then create
+    //  2. check for pre-existing, warn (and remove, unless incremental), then create
     if (write_path.back() != '/') {
         write_path += '/';
     }
     
-    if (std::filesystem::is_directory(write_path)) {
+    if (not incremental and std::filesystem::is_directory(write_path)) {
         std::string warning_str = "WARNING:  Model::writeResults():  ";
         warning_str += write_path;
         warning_str += " already exists, contents will be overwritten!";
@@ -1227,64 +2084,152 @@ void Model :: writeResults(
         std::filesystem::remove_all(write_path);
     }
     
-    std::filesystem::create_directory(write_path);
+    if (not std::filesystem::is_directory(write_path)) {
+        std::filesystem::create_directory(write_path);
+    }
+    
+    //  3. construct results manifest (reads in pre-existing manifest, if any)
+    ResultsManifest results_manifest(write_path);
     
-    //  3. write summary
-    this->__writeSummary(write_path);
+    //  4. write summary
+    this->__writeSummary(write_path, &results_manifest);
     
-    //  4. write time series
-    if (max_lines > this->electrical_load.n_points) {
-        max_lines = this->electrical_load.n_points;
+    //  5. write time series
+    if (max_lines > n_points) {
+        max_lines = n_points;
     }
     
     if (max_lines > 0) {
-        this->__writeTimeSeries(write_path, max_lines);
+        this->__writeTimeSeries(write_path, max_lines, &results_manifest);
     }
     
-    //  5. call out to Combustion :: writeResults()
-    for (size_t i = 0; i < this->combustion_ptr_vec.size(); i++) {
-        this->combustion_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
-        );
+    //  6. create asset subdirectories up front
+    this->__createAssetDirectories(write_path);
+    
+    //  7. call out to asset writeResults() (in parallel)
+    this->__writeAssetResults(write_path, max_lines, &results_manifest);
+    
+    //  8. prune stale files, then write manifest
+    results_manifest.prune();
+    results_manifest.writeManifest();
+    
+    return;
+}   /* writeResults() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::shared_future<void> Model :: writeResultsAsync(
+///         std::string write_path,
+///         int max_lines,
+///         bool incremental
+///     )
+///
+/// \brief Method which queues Model results to be written to an output directory by a
+///     background (I/O) thread, and then returns immediately. The results are moved
+///     into a snapshot (ownership of the assets is transferred), so that on return
+///     this Model is in the same state as after reset() and can be re-populated and
+///     run while the write proceeds. If max_pending_writes writes are already
+///     pending, then this method blocks until one completes.
+///
+/// \param write_path A path (either relative or absolute) to the directory location 
+///     where results are to be written. If already exists, will overwrite.
+///
+/// \param max_lines The maximum number of lines of output to write. If <0, then all
+///     available lines are written. If =0, then only summary results are written.
+///
+/// \param incremental If true, then only changed files are (re-)written (see
+///     writeResults()).
+///
+/// \return A future which becomes ready when the write completes (re-throws on get()
+///     if the write failed).
+///
+
+std::shared_future<void> Model :: writeResultsAsync(
+    std::string write_path,
+    int max_lines,
+    bool incremental
+)
+{
+    //  1. start results writer thread (if not already running)
+    if (not this->results_writer_thread.joinable()) {
+        this->results_writer_thread = std::thread(&Model::__resultsWriterLoop, this);
     }
     
-    //  6. call out to Noncombustion :: writeResults()
-    for (size_t i = 0; i < this->noncombustion_ptr_vec.size(); i++) {
-        this->noncombustion_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
+    //  2. wait for space in the queue (bounded memory)
+    {
+        std::unique_lock<std::mutex> lock(this->results_writer_mutex);
+        
+        this->results_writer_cv.wait(
+            lock,
+            [this]() {
+                return this->results_writer_n_pending < this->max_pending_writes or
+                    this->results_writer_n_pending == 0;
+            }
         );
     }
     
-    //  7. call out to Renewable :: writeResults()
-    for (size_t i = 0; i < this->renewable_ptr_vec.size(); i++) {
-        this->renewable_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            &(this->resources.resource_map_1D),
-            &(this->resources.resource_map_2D),
-            i,
-            max_lines
-        );
+    //  3. snapshot results (moves assets, leaves Model reset)
+    ResultsWriteJob job;
+    job.snapshot_ptr = this->__snapshotResults();
+    job.write_path = write_path;
+    job.max_lines = max_lines;
+    job.incremental = incremental;
+    
+    std::shared_future<void> future = job.promise.get_future().share();
+    
+    //  4. enqueue, then notify results writer
+    {
+        std::lock_guard<std::mutex> lock(this->results_writer_mutex);
+        
+        this->results_writer_queue.push_back(std::move(job));
+        this->results_writer_n_pending++;
     }
     
-    //  8. call out to Storage :: writeResults()
-    for (size_t i = 0; i < this->storage_ptr_vec.size(); i++) {
-        this->storage_ptr_vec[i]->writeResults(
-            write_path,
-            &(this->electrical_load.time_vec_hrs),
-            i,
-            max_lines
-        );
+    this->results_writer_cv.notify_all();
+    
+    return future;
+}   /* writeResultsAsync() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Model :: flush(void)
+///
+/// \brief Method which blocks until all pending asynchronous results writes (see
+///     writeResultsAsync()) have completed. Re-throws the first exception thrown by
+///     the results writer since the last flush() (if any).
+///
+
+void Model :: flush(void)
+{
+    std::unique_lock<std::mutex> lock(this->results_writer_mutex);
+    
+    this->results_writer_cv.wait(
+        lock,
+        [this]() {
+            return this->results_writer_n_pending == 0;
+        }
+    );
+    
+    if (this->results_writer_exception_ptr != nullptr) {
+        std::exception_ptr exception_ptr = this->results_writer_exception_ptr;
+        this->results_writer_exception_ptr = nullptr;
+        
+        lock.unlock();
+        std::rethrow_exception(exception_ptr);
     }
     
     return;
-}   /* writeResults() */
+}   /* flush() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -1295,11 +2240,13 @@ void Model :: writeResults(
 ///
 /// \fn Model :: ~Model(void)
 ///
-/// \brief Destructor for the Model class.
+/// \brief Destructor for the Model class. Completes any pending asynchronous results
+///     writes before clearing.
 ///
 
 Model :: ~Model(void)
 {
+    this->__stopResultsWriter();
     this->clear();
     return;
 }   /* ~Model() */
@@ -172,11 +172,18 @@ Production(
         case (FuelMode :: FUEL_MODE_LOOKUP): {
             this->fuel_mode_str = "FUEL_MODE_LOOKUP";
             
-            this->interpolator.addData1D(
+            this->fuel_curve_handle = this->interpolator.addData1D(
                 0,
                 combustion_inputs.path_2_fuel_interp_data
             );
             
+            if (combustion_inputs.fuel_interp_resample_points > 0) {
+                this->interpolator.resampleData1D(
+                    0,
+                    combustion_inputs.fuel_interp_resample_points
+                );
+            }
+            
             break;
         }
         
@@ -267,6 +274,40 @@ void Combustion :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Combustion :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window. Resizes and zeros the modelling
+///     time series, while all scalar state carries over.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void Combustion :: resetWindow(int n_points)
+{
+    //  1. invoke base class method
+    Production :: resetWindow(n_points);
+    
+    //  2. reset time series
+    this->fuel_consumption_vec_L.assign(this->n_points, 0);
+    this->fuel_cost_vec.assign(this->n_points, 0);
+    
+    this->CO2_emissions_vec_kg.assign(this->n_points, 0);
+    this->CO_emissions_vec_kg.assign(this->n_points, 0);
+    this->NOx_emissions_vec_kg.assign(this->n_points, 0);
+    this->SOx_emissions_vec_kg.assign(this->n_points, 0);
+    this->CH4_emissions_vec_kg.assign(this->n_points, 0);
+    this->PM_emissions_vec_kg.assign(this->n_points, 0);
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -313,14 +354,26 @@ void Combustion :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
     //  1. account for fuel costs in net present cost
     double t_hrs = 0;
     double real_fuel_escalation_scalar = 0;
+    double log_real_fuel_escalation = 0;
+    
+    if (this->fast_kernels) {
+        log_real_fuel_escalation = FastMath::log(1 + this->real_fuel_escalation_annual);
+    }
     
     for (int i = 0; i < this->n_points; i++) {
         t_hrs = time_vec_hrs_ptr->at(i);
         
-        real_fuel_escalation_scalar = 1.0 / pow(
-            1 + this->real_fuel_escalation_annual,
-            t_hrs / 8760
-        );
+        if (this->fast_kernels) {
+            real_fuel_escalation_scalar =
+                FastMath::exp(-log_real_fuel_escalation * t_hrs / 8760);
+        }
+        
+        else {
+            real_fuel_escalation_scalar = 1.0 / pow(
+                1 + this->real_fuel_escalation_annual,
+                t_hrs / 8760
+            );
+        }
         
         this->net_present_cost += real_fuel_escalation_scalar * this->fuel_cost_vec[i];
     }
@@ -432,7 +485,11 @@ double Combustion :: getFuelConsumptionL(double dt_hrs, double production_kW)
         case (FuelMode :: FUEL_MODE_LOOKUP): {
             double load_ratio = production_kW / this->capacity_kW;
             
-            fuel_consumed_L = this->interpolator.interp1D(0, load_ratio) * dt_hrs;
+            fuel_consumed_L = this->interpolator.interp1D(
+                this->fuel_curve_handle,
+                load_ratio,
+                &(this->fuel_curve_cursor)
+            ) * dt_hrs;
             
             break;
         }
@@ -497,7 +554,8 @@ Emissions Combustion :: getEmissionskg(double fuel_consumed_L) {
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         int combustion_index,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Method which writes Combustion results to an output directory.
@@ -513,19 +571,28 @@ Emissions Combustion :: getEmissionskg(double fuel_consumed_L) {
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param results_manifest_ptr A pointer to a ResultsManifest through which output files
+///     are written (unchanged files are skipped). If null, all files are written.
+///
 
 void Combustion :: writeResults(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     int combustion_index,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinels
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    ResultsManifest local_results_manifest;
+    if (results_manifest_ptr == nullptr) {
+        results_manifest_ptr = &local_results_manifest;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -546,7 +613,7 @@ void Combustion :: writeResults(
     std::filesystem::create_directory(write_path);
     
     //  3. write summary
-    this->__writeSummary(write_path);
+    this->__writeSummary(write_path, results_manifest_ptr);
     
     //  4. write time series
     if (max_lines > this->n_points) {
@@ -554,7 +621,12 @@ void Combustion :: writeResults(
     }
     
     if (max_lines > 0) {
-        this->__writeTimeSeries(write_path, time_vec_hrs_ptr, max_lines);
+        this->__writeTimeSeries(
+            write_path,
+            time_vec_hrs_ptr,
+            max_lines,
+            results_manifest_ptr
+        );
     }
     
     return;
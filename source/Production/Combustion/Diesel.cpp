@@ -358,20 +358,28 @@ void Diesel :: __handleStartStop(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Diesel :: __writeSummary(std::string write_path)
+/// \fn void Diesel :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Diesel.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Diesel :: __writeSummary(std::string write_path)
+void Diesel :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write to summary results (markdown)
     ofs << "# ";
@@ -531,7 +539,7 @@ void Diesel :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
 
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeSummary() */
 
@@ -545,7 +553,8 @@ void Diesel :: __writeSummary(std::string write_path)
 /// \fn void Diesel :: __writeTimeSeries(
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Diesel.
@@ -557,17 +566,20 @@ void Diesel :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Diesel :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -608,7 +620,7 @@ void Diesel :: __writeTimeSeries(
         ofs << "\n";
     }
 
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeTimeSeries() */
 
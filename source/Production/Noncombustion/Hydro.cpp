@@ -122,113 +122,144 @@ void Hydro :: __checkInputs(HydroInputs hydro_inputs)
 ///
 /// \fn void Hydro :: __initInterpolator(void)
 ///
-/// \brief Helper method to set up turbine and generator efficiency interpolation
+/// \brief Helper method to set up turbine and generator efficiency interpolation, as
+///     well as flow to power interpolation. The efficiency curves are constant (see
+///     HYDRO_GENERATOR_EFFICIENCIES and HYDRO_TURBINE_EFFICIENCIES), and so are only
+///     registered with the Interpolator if resampling is requested. The resampled
+///     efficiency curves and the flow to power table are built once per distinct
+///     parameter set and borrowed, not copied (see DataCache::getDerivedData1D() and
+///     Interpolator::borrowData1D()).
 ///
 /// Ref: \cite Hydro_2023\n
 ///
 
 void Hydro :: __initInterpolator(void)
 {
-    //  1. set up generator efficiency interpolation
-    InterpolatorStruct1D generator_interp_struct_1D;
-    
-    generator_interp_struct_1D.n_points = 12;
-    
-    generator_interp_struct_1D.x_vec = {
-        0,   0.1, 0.2,  0.3, 0.4, 0.5,
-        0.6, 0.7, 0.75, 0.8, 0.9, 1
-    };
-    
-    generator_interp_struct_1D.min_x = 0;
-    generator_interp_struct_1D.max_x = 1;
-    
-    generator_interp_struct_1D.y_vec = {
-        0.000, 0.800, 0.900, 0.913,
-        0.925, 0.943, 0.947, 0.950,
-        0.953, 0.954, 0.956, 0.958
-    };
-    
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
-            generator_interp_struct_1D
-        )
-    );
-    
-    //  2. set up turbine efficiency interpolation
-    InterpolatorStruct1D turbine_interp_struct_1D;
-    
-    turbine_interp_struct_1D.n_points = 11;
-    
-    turbine_interp_struct_1D.x_vec = {
-        0,   0.1, 0.2, 0.3, 0.4,
-        0.5, 0.6, 0.7, 0.8, 0.9,
-        1
-    };
+    //  1. select turbine efficiency curve
+    if (
+        this->turbine_type < 0 or
+        this->turbine_type >= HydroTurbineType :: N_HYDRO_TURBINES
+    ) {
+        std::string error_str = "ERROR:  Hydro():  turbine type ";
+        error_str += std::to_string(this->turbine_type);
+        error_str += " not recognized";
     
-    turbine_interp_struct_1D.min_x = 0;
-    turbine_interp_struct_1D.max_x = 1;
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::runtime_error(error_str);
+    }
     
-    std::vector<double> efficiency_vec;
+    this->turbine_efficiency_ptr = HYDRO_TURBINE_EFFICIENCIES[this->turbine_type];
     
-    switch (this->turbine_type) {
-        case(HydroTurbineType :: HYDRO_TURBINE_PELTON): {
-            efficiency_vec = {
-                0.000, 0.780, 0.855, 0.875, 0.890,
-                0.900, 0.908, 0.913, 0.918, 0.908,
-                0.880
-            };
-            
-            break;
-        }
-        
-        case(HydroTurbineType :: HYDRO_TURBINE_FRANCIS): {
-            efficiency_vec = {
-                0.000, 0.400, 0.625, 0.745, 0.810,
-                0.845, 0.880, 0.900, 0.910, 0.900,
-                0.850
-            };
-            
-            break;
-        }
-        
-        case(HydroTurbineType :: HYDRO_TURBINE_KAPLAN): {
-            efficiency_vec = {
-                0.000, 0.265, 0.460, 0.550, 0.650,
-                0.740, 0.805, 0.845, 0.900, 0.880,
-                0.850
-            };
-            
-            break;
-        }
+    //  2. borrow resampled efficiency curves (if requested; otherwise, the constant
+    //     curves are evaluated directly, see __getEfficiencyFactor())
+    if (this->efficiency_interp_resample_points > 0) {
+        std::string resample_str =
+            std::to_string(this->efficiency_interp_resample_points);
         
-        default: {
-            std::string error_str = "ERROR:  Hydro():  turbine type ";
-            error_str += std::to_string(this->turbine_type);
-            error_str += " not recognized";
+        this->generator_efficiency_handle = this->interpolator.borrowData1D(
+            HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
+            DataCache::getDerivedData1D(
+                "Hydro::generator_efficiency::" + resample_str,
+                [this](void) {
+                    return this->__buildResampledEfficiency(
+                        HYDRO_GENERATOR_POWER_RATIOS,
+                        HYDRO_GENERATOR_EFFICIENCIES,
+                        HYDRO_GENERATOR_N_POINTS
+                    );
+                }
+            )
+        );
         
-            #ifdef _WIN32
-                std::cout << error_str << std::endl;
-            #endif
-
-            throw std::runtime_error(error_str);
-            
-            break;
-        }
+        this->turbine_efficiency_handle = this->interpolator.borrowData1D(
+            HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
+            DataCache::getDerivedData1D(
+                "Hydro::turbine_efficiency::" + std::to_string(this->turbine_type) +
+                    "::" + resample_str,
+                [this](void) {
+                    return this->__buildResampledEfficiency(
+                        HYDRO_TURBINE_POWER_RATIOS,
+                        this->turbine_efficiency_ptr,
+                        HYDRO_TURBINE_N_POINTS
+                    );
+                }
+            )
+        );
     }
     
-    turbine_interp_struct_1D.y_vec = efficiency_vec;
-    
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
-            turbine_interp_struct_1D
+    //  3. borrow flow to power table (built once per parameter set)
+    this->flow_to_power_handle = this->interpolator.borrowData1D(
+        HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
+        DataCache::getDerivedData1D(
+            this->__getFlowToPowerKey(),
+            [this](void) {
+                Interpolator interpolator;
+                
+                interpolator.addData1D(0, this->__buildFlowToPower());
+                
+                return interpolator.interp_map_1D[0];
+            }
         )
     );
     
-    //  3. set up flow to power interpolation
-    InterpolatorStruct1D flow_to_power_interp_struct_1D;
+    return;
+}   /* __initInterpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string Hydro :: __getFlowToPowerKey(void)
+///
+/// \brief Helper method to construct a key which uniquely identifies the flow to power
+///     table of this asset, for sharing through DataCache. Encodes every parameter on
+///     which the table depends (exactly, so that no two parameter sets collide).
+///
+/// \return The flow to power table key.
+///
+
+std::string Hydro :: __getFlowToPowerKey(void)
+{
+    std::ostringstream key_stream;
     
+    key_stream << std::hexfloat;
+    key_stream << "Hydro::flow_to_power";
+    key_stream << "::" << this->turbine_type;
+    key_stream << "::" << this->net_head_m;
+    key_stream << "::" << this->fluid_density_kgm3;
+    key_stream << "::" << this->capacity_kW;
+    key_stream << "::" << this->efficiency_interp_resample_points;
+    
+    return key_stream.str();
+}   /* __getFlowToPowerKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorStruct1D Hydro :: __buildFlowToPower(void)
+///
+/// \brief Helper method to build the flow to power table of this asset, by inverting
+///     the power to flow relation at power ratios from 0.1 to 1. Requires that the
+///     efficiency curves have already been set up.
+///
+/// Ref: \cite Hydro_2023\n
+///
+/// \return A 1D interpolation struct holding the flow to power table (only x_vec and
+///     y_vec are set; see Interpolator::addData1D()).
+///
+
+InterpolatorStruct1D Hydro :: __buildFlowToPower(void)
+{
+    //  1. get power ratios
     double power_ratio = 0.1;
     std::vector<double> power_ratio_vec (91, 0);
     
@@ -246,38 +277,67 @@ void Hydro :: __initInterpolator(void)
         }
     }
     
-    flow_to_power_interp_struct_1D.n_points = power_ratio_vec.size();
+    //  2. translate to flow and power
+    InterpolatorStruct1D flow_to_power_interp_struct_1D;
     
-    std::vector<double> flow_vec_m3hr;
-    std::vector<double> power_vec_kW;
-    flow_vec_m3hr.resize(power_ratio_vec.size(), 0);
-    power_vec_kW.resize(power_ratio_vec.size(), 0);
+    flow_to_power_interp_struct_1D.x_vec.resize(power_ratio_vec.size(), 0);
+    flow_to_power_interp_struct_1D.y_vec.resize(power_ratio_vec.size(), 0);
     
     for (size_t i = 0; i < power_ratio_vec.size(); i++) {
-        flow_vec_m3hr[i] = this->__powerToFlow(power_ratio_vec[i] * this->capacity_kW);
-        power_vec_kW[i] = power_ratio_vec[i] * this->capacity_kW;
-        /*
-        std::cout << flow_vec_m3hr[i] << "\t" << power_vec_kW[i] << " (" <<
-            power_ratio_vec[i] << ")" << std::endl;
-        */
+        flow_to_power_interp_struct_1D.x_vec[i] =
+            this->__powerToFlow(power_ratio_vec[i] * this->capacity_kW);
+        
+        flow_to_power_interp_struct_1D.y_vec[i] =
+            power_ratio_vec[i] * this->capacity_kW;
     }
     
-    flow_to_power_interp_struct_1D.x_vec = flow_vec_m3hr;
+    return flow_to_power_interp_struct_1D;
+}   /* __buildFlowToPower() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn InterpolatorStruct1D Hydro :: __buildResampledEfficiency(
+///         const double* power_ratio_array,
+///         const double* efficiency_ptr,
+///         int n_points
+///     )
+///
+/// \brief Helper method to build the given (constant) efficiency curve, resampled onto
+///     a uniform grid of efficiency_interp_resample_points points (see
+///     Interpolator::resampleData1D()).
+///
+/// \param power_ratio_array The (increasing) power ratios at which efficiency is given.
+///
+/// \param efficiency_ptr A pointer to the efficiencies at the given power ratios.
+///
+/// \param n_points The number of points in the efficiency curve.
+///
+/// \return A (complete) 1D interpolation struct holding the resampled curve.
+///
+
+InterpolatorStruct1D Hydro :: __buildResampledEfficiency(
+    const double* power_ratio_array,
+    const double* efficiency_ptr,
+    int n_points
+)
+{
+    InterpolatorStruct1D interp_struct_1D;
     
-    flow_to_power_interp_struct_1D.min_x = flow_vec_m3hr[0];
-    flow_to_power_interp_struct_1D.max_x = flow_vec_m3hr[flow_vec_m3hr.size() - 1];
+    interp_struct_1D.x_vec.assign(power_ratio_array, power_ratio_array + n_points);
+    interp_struct_1D.y_vec.assign(efficiency_ptr, efficiency_ptr + n_points);
     
-    flow_to_power_interp_struct_1D.y_vec = power_vec_kW;
+    Interpolator interpolator;
     
-    this->interpolator.interp_map_1D.insert(
-        std::pair<int, InterpolatorStruct1D>(
-            HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
-            flow_to_power_interp_struct_1D
-        )
-    );
+    interpolator.addData1D(0, interp_struct_1D);
+    interpolator.resampleData1D(0, this->efficiency_interp_resample_points);
     
-    return;
-}   /* __initInterpolator() */
+    return interpolator.interp_map_1D[0];
+}   /* __buildResampledEfficiency() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -365,15 +425,34 @@ double Hydro :: __getEfficiencyFactor(double power_kW)
     }
     
     
-    //  3. init efficiency factor to the turbine efficiency
-    double efficiency_factor = this->interpolator.interp1D(
-        HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
+    //  3. resampled curves, use interpolation (unchecked, since the power ratio has
+    //     been clipped to the efficiency data domain of [0, 1] above)
+    if (this->efficiency_interp_resample_points > 0) {
+        double efficiency_factor = this->interpolator.interp1DUnchecked(
+            this->turbine_efficiency_handle,
+            power_ratio,
+            &(this->turbine_efficiency_cursor)
+        );
+        
+        efficiency_factor *= this->interpolator.interp1DUnchecked(
+            this->generator_efficiency_handle,
+            power_ratio,
+            &(this->generator_efficiency_cursor)
+        );
+        
+        return efficiency_factor;
+    }
+    
+    //  4. otherwise, evaluate constant curves directly (no table indirection)
+    double efficiency_factor = hydroEfficiencyLookup(
+        HYDRO_TURBINE_POWER_RATIOS,
+        this->turbine_efficiency_ptr,
         power_ratio
     );
     
-    //  4. include generator efficiency
-    efficiency_factor *= this->interpolator.interp1D(
-        HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
+    efficiency_factor *= hydroEfficiencyLookup(
+        HYDRO_GENERATOR_POWER_RATIOS,
+        HYDRO_GENERATOR_EFFICIENCIES,
         power_ratio
     );
     
@@ -457,8 +536,9 @@ double Hydro :: __flowToPower(double flow_m3hr)
     
     //  2. interpolate flow to power
     double power_kW = this->interpolator.interp1D(
-        HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY,
-        flow_m3hr
+        this->flow_to_power_handle,
+        flow_m3hr,
+        &(this->flow_to_power_cursor)
     );
     
     return power_kW;
@@ -641,20 +721,28 @@ void Hydro :: __updateState(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Hydro :: __writeSummary(std::string write_path)
+/// \fn void Hydro :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Hydro.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Hydro :: __writeSummary(std::string write_path)
+void Hydro :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write to summary results (markdown)
     ofs << "# ";
@@ -768,7 +856,7 @@ void Hydro :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
 
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeSummary() */
 
@@ -782,7 +870,8 @@ void Hydro :: __writeSummary(std::string write_path)
 /// \fn void Hydro :: __writeTimeSeries(
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Hydro.
@@ -794,17 +883,20 @@ void Hydro :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Hydro :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -835,7 +927,7 @@ void Hydro :: __writeTimeSeries(
         ofs << "\n";
     }
 
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeTimeSeries() */
 
@@ -908,6 +1000,8 @@ Noncombustion(
     this->resource_key = hydro_inputs.resource_key;
     
     this->turbine_type = hydro_inputs.turbine_type;
+    this->efficiency_interp_resample_points =
+        hydro_inputs.efficiency_interp_resample_points;
     
     this->fluid_density_kgm3 = hydro_inputs.fluid_density_kgm3;
     this->net_head_m = hydro_inputs.net_head_m;
@@ -980,6 +1074,34 @@ void Hydro :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Hydro :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window. Resizes and zeros the modelling
+///     time series, while all scalar state carries over.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void Hydro :: resetWindow(int n_points)
+{
+    //  1. invoke base class method
+    Noncombustion :: resetWindow(n_points);
+    
+    //  2. reset time series (reservoir state carries over)
+    this->turbine_flow_vec_m3hr.assign(this->n_points, 0);
+    this->spill_rate_vec_m3hr.assign(this->n_points, 0);
+    this->stored_volume_vec_m3.assign(this->n_points, 0);
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
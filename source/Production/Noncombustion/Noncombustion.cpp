@@ -293,7 +293,8 @@ double Noncombustion :: commit(
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         int combustion_index,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Method which writes Noncombustion results to an output directory.
@@ -309,19 +310,28 @@ double Noncombustion :: commit(
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param results_manifest_ptr A pointer to a ResultsManifest through which output files
+///     are written (unchanged files are skipped). If null, all files are written.
+///
 
 void Noncombustion :: writeResults(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     int combustion_index,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinels
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    ResultsManifest local_results_manifest;
+    if (results_manifest_ptr == nullptr) {
+        results_manifest_ptr = &local_results_manifest;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -342,7 +352,7 @@ void Noncombustion :: writeResults(
     std::filesystem::create_directory(write_path);
     
     //  3. write summary
-    this->__writeSummary(write_path);
+    this->__writeSummary(write_path, results_manifest_ptr);
     
     //  4. write time series
     if (max_lines > this->n_points) {
@@ -350,7 +360,12 @@ void Noncombustion :: writeResults(
     }
     
     if (max_lines > 0) {
-        this->__writeTimeSeries(write_path, time_vec_hrs_ptr, max_lines);
+        this->__writeTimeSeries(
+            write_path,
+            time_vec_hrs_ptr,
+            max_lines,
+            results_manifest_ptr
+        );
     }
     
     return;
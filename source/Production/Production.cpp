@@ -236,7 +236,10 @@ void Production :: __checkNormalizedProduction(double normalized_production)
 ///         std::vector<double>* time_vec_hrs_ptr
 ///     )
 ///
-/// \brief Helper method to read in a given time series of normalized production.
+/// \brief Helper method to read in a given time series of normalized production. The
+///     file is parsed by way of DataCache, so repeated construction does not re-read
+///     it (unless it has changed on disk); the series is then checked and copied into
+///     normalized_production_vec, which this asset owns.
 ///
 /// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
 ///
@@ -245,43 +248,57 @@ void Production :: __readNormalizedProductionData(
     std::vector<double>* time_vec_hrs_ptr
 )
 {
-    //  1. init CSV reader
-    io::CSVReader<2> CSV(this->path_2_normalized_production_time_series);
+    //  1. get normalized production data (from the process-wide data cache, if
+    //     current, otherwise reading from disk)
+    std::string path_2_data = this->path_2_normalized_production_time_series;
+    
+    std::shared_ptr<const NormalizedSeriesData> normalized_series_ptr =
+        DataCache::getNormalizedSeries(
+            path_2_data,
+            [path_2_data](void) {
+                io::CSVReader<2> CSV(path_2_data);
+                
+                CSV.read_header(
+                    io::ignore_extra_column,
+                    "Time (since start of data) [hrs]",
+                    "Normalized Production [ ]"
+                );
+                
+                NormalizedSeriesData normalized_series;
+                
+                double time_hrs = 0;
+                double normalized_production = 0;
+                
+                while (CSV.read_row(time_hrs, normalized_production)) {
+                    normalized_series.time_vec_hrs.push_back(time_hrs);
+                    normalized_series.normalized_vec.push_back(normalized_production);
+                }
+                
+                return normalized_series;
+            }
+        );
     
-    CSV.read_header(
-        io::ignore_extra_column,
-        "Time (since start of data) [hrs]",
-        "Normalized Production [ ]"
-    );
+    //  2. check length of data
+    int n_points = normalized_series_ptr->normalized_vec.size();
     
-    //  2. read in normalized performance data,
-    //     check values and check against time series (point-wise and length)
-    int n_points = 0;
-    double time_hrs = 0;
-    double time_expected_hrs = 0;
-    double normalized_production = 0;
+    if (n_points != this->n_points) {
+        this->__throwLengthError();
+    }
     
-    while (CSV.read_row(time_hrs, normalized_production)) {
-        //  2.1. check length of data
-        if (n_points > this->n_points) {
-            this->__throwLengthError();
-        }
+    //  3. check values and check against time series (point-wise), write to
+    //     normalized production vector
+    double time_expected_hrs = 0;
     
-        //  2.2. check normalized production value
-        this->__checkNormalizedProduction(normalized_production);
+    for (int i = 0; i < n_points; i++) {
+        //  3.1. check normalized production value
+        this->__checkNormalizedProduction(normalized_series_ptr->normalized_vec[i]);
         
-        //  2.3. check time point
-        time_expected_hrs = time_vec_hrs_ptr->at(n_points);
-        this->__checkTimePoint(time_hrs, time_expected_hrs);
+        //  3.2. check time point
+        time_expected_hrs = time_vec_hrs_ptr->at(i);
+        this->__checkTimePoint(normalized_series_ptr->time_vec_hrs[i], time_expected_hrs);
         
-        //  2.4. write to normalized production vector, increment n_points
-        this->normalized_production_vec[n_points] = normalized_production;
-        n_points++;
-    }
-    
-    //  3. check length of data
-    if (n_points != this->n_points) {
-        this->__throwLengthError();
+        //  3.3. write to normalized production vector
+        this->normalized_production_vec[i] = normalized_series_ptr->normalized_vec[i];
     }
     
     return;
@@ -347,6 +364,7 @@ Production :: Production(
     this->print_flag = production_inputs.print_flag;
     this->is_running = false;
     this->is_sunk = production_inputs.is_sunk;
+    this->fast_kernels = false;
     this->normalized_production_series_given = false;
     
     this->n_points = n_points;
@@ -440,6 +458,43 @@ void Production :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Production :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window (see ElectricalLoad::openLoadStream()).
+///     Resizes and zeros the modelling time series, while all scalar state (running
+///     hours, starts, replacements, totals, etc.) carries over. Note that a given
+///     normalized production time series spans the full modelling time series, and so
+///     cannot be used when streaming.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void Production :: resetWindow(int n_points)
+{
+    //  1. set number of points
+    this->n_points = n_points;
+    
+    //  2. reset time series (all scalar state carries over)
+    this->is_running_vec.assign(this->n_points, 0);
+    
+    this->production_vec_kW.assign(this->n_points, 0);
+    this->dispatch_vec_kW.assign(this->n_points, 0);
+    this->storage_vec_kW.assign(this->n_points, 0);
+    this->curtailment_vec_kW.assign(this->n_points, 0);
+    
+    this->capital_cost_vec.assign(this->n_points, 0);
+    this->operation_maintenance_cost_vec.assign(this->n_points, 0);
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -497,14 +552,25 @@ void Production :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
     //  1. compute net present cost
     double t_hrs = 0;
     double real_discount_scalar = 0;
+    double log_real_discount = 0;
+    
+    if (this->fast_kernels) {
+        log_real_discount = FastMath::log(1 + this->real_discount_annual);
+    }
     
     for (int i = 0; i < this->n_points; i++) {
         t_hrs = time_vec_hrs_ptr->at(i);
         
-        real_discount_scalar = 1.0 / pow(
-            1 + this->real_discount_annual,
-            t_hrs / 8760
-        );
+        if (this->fast_kernels) {
+            real_discount_scalar = FastMath::exp(-log_real_discount * t_hrs / 8760);
+        }
+        
+        else {
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+        }
         
         this->net_present_cost += real_discount_scalar * this->capital_cost_vec[i];
         
@@ -107,6 +107,118 @@ void Renewable :: __handleStartStop(
 
 // ---------------------------------------------------------------------------------- //
 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn int Renewable :: __getPowerCurveResamplePoints(
+///         const InterpolatorStruct1D* power_curve_ptr
+///     )
+///
+/// \brief Helper method to get the (automatic) resolution at which to pre-sample the
+///     given power curve. This is the coarsest uniform grid which is at least as fine
+///     as the narrowest interval of the curve, and which contains every point of the
+///     curve (so that pre-sampling is exact). If there is no such grid of at most
+///     RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS points, then the finest grid allowed
+///     is used instead.
+///
+/// \param power_curve_ptr A pointer to the given power curve.
+///
+/// \return The number of points in the uniform grid (0 if the curve is already
+///     uniform).
+///
+
+int Renewable :: __getPowerCurveResamplePoints(
+    const InterpolatorStruct1D* power_curve_ptr
+)
+{
+    //  1. uniform curves are used as given
+    if (power_curve_ptr->is_uniform_x) {
+        return 0;
+    }
+    
+    //  2. get narrowest interval
+    double range_x = power_curve_ptr->max_x - power_curve_ptr->min_x;
+    double min_dx = range_x;
+    
+    for (int i = 0; i < power_curve_ptr->n_points - 1; i++) {
+        double dx = power_curve_ptr->x_vec[i + 1] - power_curve_ptr->x_vec[i];
+        
+        if (dx > 0 and dx < min_dx) {
+            min_dx = dx;
+        }
+    }
+    
+    //  3. find coarsest grid (at least as fine as the narrowest interval) on which
+    //     every point of the curve lies
+    int min_intervals = (int)ceil(range_x / min_dx - 1e-9);
+    
+    for (
+        int n_intervals = min_intervals;
+        n_intervals < RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS;
+        n_intervals++
+    ) {
+        bool on_grid = true;
+        
+        for (int i = 0; i < power_curve_ptr->n_points; i++) {
+            double grid_idx = n_intervals *
+                (power_curve_ptr->x_vec[i] - power_curve_ptr->min_x) / range_x;
+            
+            if (fabs(grid_idx - round(grid_idx)) > 1e-6) {
+                on_grid = false;
+                break;
+            }
+        }
+        
+        if (on_grid) {
+            return n_intervals + 1;
+        }
+    }
+    
+    //  4. otherwise, finest grid allowed
+    return RENEWABLE_POWER_CURVE_MAX_RESAMPLE_POINTS;
+}   /* __getPowerCurveResamplePoints() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string Renewable :: __getPowerCurveKey(
+///         const InterpolatorStruct1D* power_curve_ptr
+///     )
+///
+/// \brief Helper method to construct a key which uniquely identifies the pre-sampled
+///     power curve (i.e., the given curve data, exactly, and the resolution), for use
+///     with the process-wide data cache. Keying on the data (rather than the path)
+///     means that an edited curve file is never matched to a stale pre-sampling.
+///
+/// \param power_curve_ptr A pointer to the given power curve.
+///
+/// \return A key which uniquely identifies the pre-sampled power curve.
+///
+
+std::string Renewable :: __getPowerCurveKey(const InterpolatorStruct1D* power_curve_ptr)
+{
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "Renewable::power_curve";
+    key_stream << "::" << this->power_curve_resample_points;
+    
+    for (int i = 0; i < power_curve_ptr->n_points; i++) {
+        key_stream << "::" << power_curve_ptr->x_vec[i];
+        key_stream << "," << power_curve_ptr->y_vec[i];
+    }
+    
+    return key_stream.str();
+}   /* __getPowerCurveKey() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -170,7 +282,8 @@ Production(
     this->__checkInputs(renewable_inputs);
     
     //  2. set attributes
-    //...
+    this->power_curve_resample_points = 0;
+    this->power_curve_key = "";
     
     //  3. construction print
     if (this->print_flag) {
@@ -232,6 +345,360 @@ void Renewable :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: initPowerCurve(
+///         std::string path_2_normalized_power_curve,
+///         int power_curve_resample_points
+///     )
+///
+/// \brief Method to set up a normalized power curve for lookup (see the LOOKUP power
+///     production models of Wind and Tidal). The curve is borrowed from the
+///     process-wide data cache and then, unless uniformly tabulated (with no resolution
+///     requested), pre-sampled onto a uniform grid, so that lookups are constant time.
+///     The pre-sampled curve is built once per distinct curve and resolution, and
+///     borrowed by every asset which uses it (see DataCache::getDerivedData1D()). A
+///     warning is printed if the pre-sampled curve deviates from the given curve by
+///     more than RENEWABLE_POWER_CURVE_MAX_RESAMPLE_DEVIATION.
+///
+/// \param path_2_normalized_power_curve A path (either relative or absolute) to the
+///     normalized power curve.
+///
+/// \param power_curve_resample_points The number of points in the uniform grid onto
+///     which the curve is pre-sampled (if 0, chosen automatically, so that every point
+///     of the curve lies on the grid; see __getPowerCurveResamplePoints()).
+///
+
+void Renewable :: initPowerCurve(
+    std::string path_2_normalized_power_curve,
+    int power_curve_resample_points
+)
+{
+    //  1. borrow given power curve
+    this->power_curve_handle = this->interpolator.borrowData1D(
+        RenewableInterpKeys :: POWER_CURVE_INTERP_KEY,
+        path_2_normalized_power_curve
+    );
+    
+    const InterpolatorStruct1D* power_curve_ptr =
+        this->power_curve_handle.interp_struct_1D_ptr;
+    
+    //  2. get pre-sampling resolution
+    this->power_curve_resample_points = power_curve_resample_points;
+    
+    if (this->power_curve_resample_points == 0) {
+        this->power_curve_resample_points =
+            this->__getPowerCurveResamplePoints(power_curve_ptr);
+    }
+    
+    this->power_curve_key = this->__getPowerCurveKey(power_curve_ptr);
+    
+    if (this->power_curve_resample_points == 0) {
+        return;
+    }
+    
+    //  3. borrow pre-sampled power curve (built once per curve and resolution)
+    int resample_points = this->power_curve_resample_points;
+    
+    this->power_curve_handle = this->interpolator.borrowData1D(
+        RenewableInterpKeys :: RESAMPLED_POWER_CURVE_INTERP_KEY,
+        DataCache::getDerivedData1D(
+            this->power_curve_key,
+            [power_curve_ptr, resample_points](void) {
+                Interpolator interpolator;
+                
+                interpolator.addData1D(0, *power_curve_ptr);
+                interpolator.resampleData1D(0, resample_points);
+                
+                return interpolator.interp_map_1D[0];
+            }
+        )
+    );
+    
+    //  4. check deviation of pre-sampled curve
+    double max_resample_deviation =
+        this->power_curve_handle.interp_struct_1D_ptr->max_resample_deviation;
+    
+    if (max_resample_deviation > RENEWABLE_POWER_CURVE_MAX_RESAMPLE_DEVIATION) {
+        std::string warning_str = "WARNING:  Renewable::initPowerCurve():  ";
+        warning_str += "pre-sampling the power curve at ";
+        warning_str += path_2_normalized_power_curve;
+        warning_str += " onto ";
+        warning_str += std::to_string(this->power_curve_resample_points);
+        warning_str += " points deviates from the given curve by up to ";
+        warning_str += std::to_string(max_resample_deviation);
+        warning_str += " (normalized production)";
+        
+        std::cout << warning_str << std::endl;
+    }
+    
+    return;
+}   /* initPowerCurve() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Renewable :: scaleNormalizedProductionkW(double normalized_production)
+///
+/// \brief Method which scales a normalized production (i.e., production per unit of
+///     capacity, see computeNormalizedProduction()) up to the production of this asset.
+///     Derived classes apply any further asset specific factors here, so that the
+///     Controller can share one normalized production among assets which differ only
+///     in size (see getNormalizedResponseKey()).
+///
+/// \param normalized_production The normalized production [ ].
+///
+/// \return The production [kW] of the asset.
+///
+
+double Renewable :: scaleNormalizedProductionkW(double normalized_production)
+{
+    return normalized_production * this->capacity_kW;
+}   /* scaleNormalizedProductionkW() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeNormalizedProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* resource_vec_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Method which takes in a (1D) resource over a series of consecutive
+///     timesteps, and then writes the normalized production over that series. This
+///     default calls computeNormalizedProduction() at each timestep; derived classes
+///     override it with a tight loop over the series.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param resource_vec_ptr A pointer to the resource over the series, one value per
+///     timestep.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production over the series is written (resized to match, if need
+///     be).
+///
+
+void Renewable :: computeNormalizedProductionSeries(
+    int start_timestep,
+    std::vector<double>* resource_vec_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    int n_timesteps = resource_vec_ptr->size();
+    normalized_production_vec_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        (*normalized_production_vec_ptr)[i] = this->computeNormalizedProduction(
+            start_timestep + i,
+            0,
+            (*resource_vec_ptr)[i]
+        );
+    }
+    
+    return;
+}   /* computeNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeNormalizedProductionSeries(
+///         int start_timestep,
+///         std::vector<std::vector<double>>* resource_vec_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Method which takes in a (2D) resource over a series of consecutive
+///     timesteps, and then writes the normalized production over that series. This
+///     default calls computeNormalizedProduction() at each timestep; derived classes
+///     override it with a tight loop over the series.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param resource_vec_ptr A pointer to the resource over the series, one pair of
+///     values per timestep.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production over the series is written (resized to match, if need
+///     be).
+///
+
+void Renewable :: computeNormalizedProductionSeries(
+    int start_timestep,
+    std::vector<std::vector<double>>* resource_vec_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    int n_timesteps = resource_vec_ptr->size();
+    normalized_production_vec_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        (*normalized_production_vec_ptr)[i] = this->computeNormalizedProduction(
+            start_timestep + i,
+            0,
+            (*resource_vec_ptr)[i][0],
+            (*resource_vec_ptr)[i][1]
+        );
+    }
+    
+    return;
+}   /* computeNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: scaleNormalizedProductionSeries(
+///         std::vector<double>* normalized_production_vec_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which scales a normalized production series up to the production
+///     series of this asset (see scaleNormalizedProductionkW()).
+///
+/// \param normalized_production_vec_ptr A pointer to the normalized production series.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     series is written (resized to match, if need be).
+///
+
+void Renewable :: scaleNormalizedProductionSeries(
+    std::vector<double>* normalized_production_vec_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    int n_timesteps = normalized_production_vec_ptr->size();
+    production_vec_kW_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        (*production_vec_kW_ptr)[i] =
+            (*normalized_production_vec_ptr)[i] * this->capacity_kW;
+    }
+    
+    return;
+}   /* scaleNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* resource_vec_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in a (1D) resource over a series of consecutive
+///     timesteps, and then writes the production over that series. Equivalent to
+///     calling computeProductionkW() at each timestep (which this default does), but
+///     derived classes override it with a tight loop over the series, so that the
+///     Controller makes one call per asset per run rather than one per timestep.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param resource_vec_ptr A pointer to the resource over the series, one value per
+///     timestep.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Renewable :: computeProductionSeries(
+    int start_timestep,
+    std::vector<double>* resource_vec_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    int n_timesteps = resource_vec_ptr->size();
+    production_vec_kW_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        (*production_vec_kW_ptr)[i] = this->computeProductionkW(
+            start_timestep + i,
+            0,
+            (*resource_vec_ptr)[i]
+        );
+    }
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Renewable :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<std::vector<double>>* resource_vec_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in a (2D) resource over a series of consecutive
+///     timesteps, and then writes the production over that series. Equivalent to
+///     calling computeProductionkW() at each timestep (which this default does), but
+///     derived classes override it with a tight loop over the series.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param resource_vec_ptr A pointer to the resource over the series, one pair of
+///     values per timestep.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Renewable :: computeProductionSeries(
+    int start_timestep,
+    std::vector<std::vector<double>>* resource_vec_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    int n_timesteps = resource_vec_ptr->size();
+    production_vec_kW_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        (*production_vec_kW_ptr)[i] = this->computeProductionkW(
+            start_timestep + i,
+            0,
+            (*resource_vec_ptr)[i][0],
+            (*resource_vec_ptr)[i][1]
+        );
+    }
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -293,7 +760,8 @@ double Renewable :: commit(
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
 ///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
 ///         int renewable_index,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Method which writes Renewable results to an output directory.
@@ -313,6 +781,9 @@ double Renewable :: commit(
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param results_manifest_ptr A pointer to a ResultsManifest through which output files
+///     are written (unchanged files are skipped). If null, all files are written.
+///
 
 void Renewable :: writeResults(
     std::string write_path,
@@ -320,14 +791,20 @@ void Renewable :: writeResults(
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
     std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
     int renewable_index,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinels
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    ResultsManifest local_results_manifest;
+    if (results_manifest_ptr == nullptr) {
+        results_manifest_ptr = &local_results_manifest;
+    }
+    
     //  2. create subdirectories
     write_path += "Production/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -348,7 +825,7 @@ void Renewable :: writeResults(
     std::filesystem::create_directory(write_path);
     
     //  3. write summary
-    this->__writeSummary(write_path);
+    this->__writeSummary(write_path, results_manifest_ptr);
     
     //  4. write time series
     if (max_lines > this->n_points) {
@@ -361,7 +838,8 @@ void Renewable :: writeResults(
             time_vec_hrs_ptr,
             resource_map_1D_ptr,
             resource_map_2D_ptr,
-            max_lines
+            max_lines,
+            results_manifest_ptr
         );
     }
     
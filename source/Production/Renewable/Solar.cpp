@@ -166,6 +166,79 @@ void Solar :: __checkInputs(SolarInputs solar_inputs)
         throw std::invalid_argument(error_str);
     }
     
+    //  8. check panel planes (multi-plane arrays)
+    if (
+        solar_inputs.plane_tilt_deg_vec.size() !=
+            solar_inputs.plane_azimuth_deg_vec.size() or
+        (
+            not solar_inputs.plane_capacity_fraction_vec.empty() and
+            solar_inputs.plane_capacity_fraction_vec.size() !=
+                solar_inputs.plane_azimuth_deg_vec.size()
+        )
+    ) {
+        std::string error_str = "ERROR:  Solar():  ";
+        error_str += "SolarInputs::plane_azimuth_deg_vec, plane_tilt_deg_vec, and ";
+        error_str += "plane_capacity_fraction_vec (if given) must be of the same size";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    for (size_t i = 0; i < solar_inputs.plane_tilt_deg_vec.size(); i++) {
+        if (
+            solar_inputs.plane_tilt_deg_vec[i] < 0 or
+            solar_inputs.plane_tilt_deg_vec[i] > 90
+        ) {
+            std::string error_str = "ERROR:  Solar():  ";
+            error_str += "SolarInputs::plane_tilt_deg_vec values must be in the closed ";
+            error_str += "interval [0, 90] degrees";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::invalid_argument(error_str);
+        }
+    }
+    
+    double capacity_fraction_sum = 0;
+    
+    for (size_t i = 0; i < solar_inputs.plane_capacity_fraction_vec.size(); i++) {
+        if (
+            solar_inputs.plane_capacity_fraction_vec[i] < 0 or
+            solar_inputs.plane_capacity_fraction_vec[i] > 1
+        ) {
+            std::string error_str = "ERROR:  Solar():  ";
+            error_str += "SolarInputs::plane_capacity_fraction_vec values must be in ";
+            error_str += "the closed interval [0, 1]";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::invalid_argument(error_str);
+        }
+        
+        capacity_fraction_sum += solar_inputs.plane_capacity_fraction_vec[i];
+    }
+    
+    if (
+        not solar_inputs.plane_capacity_fraction_vec.empty() and
+        fabs(capacity_fraction_sum - 1) > 1e-6
+    ) {
+        std::string error_str = "ERROR:  Solar():  ";
+        error_str += "SolarInputs::plane_capacity_fraction_vec values must sum to 1";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
     return;
 }   /* __checkInputs() */
 
@@ -227,20 +300,23 @@ double Solar :: __getGenericOpMaintCost(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getMeanLongitudeDeg(void)
+/// \fn double Solar :: __getMeanLongitudeDeg(double julian_day)
 ///
 /// \brief Method to compute and return the mean longitude [deg], bound to the half-open
 ///     interval [0, 360). From eqn (4.7) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000, at the time of interest.
+///
 /// \return The mean longitude [deg], bound to the half-open interval [0, 360).
 ///
 
-double Solar :: __getMeanLongitudeDeg(void)
+double Solar :: __getMeanLongitudeDeg(double julian_day)
 {
     // compute mean longitude
-    double mean_longitude_deg = 280.46 + 0.9856474 * this->julian_day;
+    double mean_longitude_deg = 280.46 + 0.9856474 * julian_day;
     
     // bound to the half-open interval [0, 360) deg
     int mean_longitude_deg_int = int(mean_longitude_deg);
@@ -259,20 +335,23 @@ double Solar :: __getMeanLongitudeDeg(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// double Solar :: __getMeanAnomalyRad(void)
+/// \fn double Solar :: __getMeanAnomalyRad(double julian_day)
 ///
 /// \brief Method to compute and return the mean anomaly [rad], bound to the half-open 
 ///     interval [0, 2pi). From eqn (4.8) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000, at the time of interest.
+///
 /// \return The mean anomaly [rad], bound to the half-open interval [0, 2pi).
 ///
 
-double Solar :: __getMeanAnomalyRad(void)
+double Solar :: __getMeanAnomalyRad(double julian_day)
 {
     // compute mean anomaly
-    double mean_anomaly_deg = 357.528 + 0.9856003 * this->julian_day;
+    double mean_anomaly_deg = 357.528 + 0.9856003 * julian_day;
     
     // bound to the half-open interval [0, 360) deg.
     int mean_anomaly_deg_int = int(mean_anomaly_deg);
@@ -344,20 +423,23 @@ double Solar :: __getEclipticLongitudeRad(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getObliquityOfEclipticRad(void)
+/// \fn double Solar :: __getObliquityOfEclipticRad(double julian_day)
 ///
 /// \brief Method to compute and return the obliquity of the ecliptic [rad], bound to 
 ///     the half-open interval [0, 2pi). From eqn (4.10) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000, at the time of interest.
+///
 /// \return The obliquity of the ecliptic [rad], bound to the half-open interval [0, 2pi).
 ///
 
-double Solar :: __getObliquityOfEclipticRad(void)
+double Solar :: __getObliquityOfEclipticRad(double julian_day)
 {
     // compute obliquity of ecliptic
-    double obleq_deg = 23.439 - 0.0000004 * this->julian_day;
+    double obleq_deg = 23.439 - 0.0000004 * julian_day;
     
     // bound to half-open interval [0, 360) deg
     int obleq_deg_int = int(obleq_deg);
@@ -379,22 +461,25 @@ double Solar :: __getObliquityOfEclipticRad(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getGreenwichMeanSiderialTimeHrs(void)
+/// \fn double Solar :: __getGreenwichMeanSiderialTimeHrs(double julian_day)
 ///
 /// \brief Method to compute the Greenwich mean siderial time [hrs], bound to the 
 ///     half-open interval [0, 24) hrs. From eqn (4.13) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000, at the time of interest.
+///
 /// \return Greenwich mean siderial time [hrs], bound to the half-open interval 
 ///     [0, 24) hrs.
 ///
 
-double Solar :: __getGreenwichMeanSiderialTimeHrs(void)
+double Solar :: __getGreenwichMeanSiderialTimeHrs(double julian_day)
 {
     // compute Greenwich mean siderial time
     double Greenwich_mean_siderial_time_hrs = 6.697375 + 
-        0.0657098242 * this->julian_day -
+        0.0657098242 * julian_day -
         (this->longitude_deg / 15);
     
     // bound to the half-open interval [0, 24) hrs
@@ -861,6 +946,7 @@ double Solar :: __getDirectNormalIrradiancekWm2(
 
 ///
 /// \fn double Solar :: __getAngleOfIncidenceRad(
+///         int plane,
 ///         double solar_zenith_rad,
 ///         double solar_azimuth_rad
 ///     )
@@ -870,6 +956,8 @@ double Solar :: __getDirectNormalIrradiancekWm2(
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param plane The index of the panel plane.
+///
 /// \param solar_zenith_rad The solar zenith [rad].
 ///
 /// \param solar_azimuth_rad The solar azimuth [rad].
@@ -878,16 +966,17 @@ double Solar :: __getDirectNormalIrradiancekWm2(
 ///
 
 double Solar :: __getAngleOfIncidenceRad(
+    int plane,
     double solar_zenith_rad,
     double solar_azimuth_rad
 )
 {
     double a =
         sin(solar_zenith_rad) *
-        cos(solar_azimuth_rad - this->panel_azimuth_rad) *
-        sin(this->panel_tilt_rad) +
+        cos(solar_azimuth_rad - this->plane_azimuth_rad_vec[plane]) *
+        sin(this->plane_tilt_rad_vec[plane]) +
         cos(solar_zenith_rad) *
-        cos(this->panel_tilt_rad);
+        cos(this->plane_tilt_rad_vec[plane]);
     
     double angle_of_incidence_rad = 0;
     
@@ -949,22 +1038,30 @@ double Solar :: __getBeamIrradiancekWm2(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getDiffuseIrradiancekWm2(double diffuse_horizontal_irradiance_kWm2)
+/// \fn double Solar :: __getDiffuseIrradiancekWm2(
+///         int plane,
+///         double diffuse_horizontal_irradiance_kWm2
+///     )
 ///
 /// \brief Method which computes and returns the (isotropic) diffuse sky
 ///     irradiance [kW/m2]. From eqn (6.5) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param plane The index of the panel plane.
+///
 /// \param diffuse_horizontal_irradiance_kWm2 The DHI [kW/m2]
 ///
 /// \return The (isotropic) diffuse sky irradiance [kW/m2]
 ///
 
-double Solar :: __getDiffuseIrradiancekWm2(double diffuse_horizontal_irradiance_kWm2)
+double Solar :: __getDiffuseIrradiancekWm2(
+    int plane,
+    double diffuse_horizontal_irradiance_kWm2
+)
 {
     double diffuse_sky_irradiance_kWm2 = diffuse_horizontal_irradiance_kWm2 *
-        cos(this->panel_tilt_rad);
+        cos(this->plane_tilt_rad_vec[plane]);
     
     return diffuse_sky_irradiance_kWm2;
 }   /* __getDiffuseIrradiancekWm2() */
@@ -976,23 +1073,31 @@ double Solar :: __getDiffuseIrradiancekWm2(double diffuse_horizontal_irradiance_
 // ---------------------------------------------------------------------------------- //'
 
 ///
-/// \fn double Solar :: __getGroundReflectedIrradiancekWm2(double solar_resource_kWm2)
+/// \fn double Solar :: __getGroundReflectedIrradiancekWm2(
+///         int plane,
+///         double solar_resource_kWm2
+///     )
 ///
 /// \brief Method to compute and return the ground reflected irradiance [kW/m2]. From
 ///     eqn (6.21) of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
+/// \param plane The index of the panel plane.
+///
 /// \param solar_resource_kWm2 Solar resource (i.e. global horizontal irradiance) [kW/m2].
 ///
 /// \return The ground reflected irradiance [kW/m2].
 ///
 
-double Solar :: __getGroundReflectedIrradiancekWm2(double solar_resource_kWm2)
+double Solar :: __getGroundReflectedIrradiancekWm2(
+    int plane,
+    double solar_resource_kWm2
+)
 {
     double ground_reflected_irradiance_kWm2 =
         this->albedo_ground_reflectance * solar_resource_kWm2 *
-        ((1 - cos(this->panel_tilt_rad)) / 2);
+        ((1 - cos(this->plane_tilt_rad_vec[plane])) / 2);
     
     return ground_reflected_irradiance_kWm2;
 }   /* __getGroundReflectedIrradiancekWm2() */
@@ -1004,35 +1109,35 @@ double Solar :: __getGroundReflectedIrradiancekWm2(double solar_resource_kWm2)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Solar :: __getPlaneOfArrayIrradiancekWm2(
-///         int timestep,
-///         double dt_hrs,
-///         double solar_resource_kWm2
+/// \fn void Solar :: __computeSolarPosition(
+///         double julian_day,
+///         double* solar_zenith_rad_ptr,
+///         double* solar_azimuth_rad_ptr
 ///     )
 ///
-/// \brief Method which takes in the solar resource at a particular point in time, and
-///     then returns the nominal plane of array irradiance. From eqn (7.1) of Gilman.
+/// \brief Helper method to compute the position (zenith and azimuth) of the sun, as
+///     seen from the site of the solar PV array, at the given Julian day. From
+///     chapter 4 of Gilman.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
-/// \param timestep The timestep (i.e., time series index) for the request.
-///
-/// \param dt_hrs The interval of time [hrs] associated with the timestep.
+/// \param julian_day The number of days (including partial days) since 12:00 on
+///     1 Jan 2000, at the time of interest.
 ///
-/// \param solar_resource_kWm2 Solar resource (i.e. global horizontal irradiance) [kW/m2].
+/// \param solar_zenith_rad_ptr A pointer to the solar zenith [rad] to be written to.
 ///
-/// \return The nominal plane of array irradiance [kW/m2].
+/// \param solar_azimuth_rad_ptr A pointer to the solar azimuth [rad] to be written to.
 ///
 
-double Solar :: __getPlaneOfArrayIrradiancekWm2(
-    int timestep,
-    double dt_hrs,
-    double solar_resource_kWm2
+void Solar :: __computeSolarPosition(
+    double julian_day,
+    double* solar_zenith_rad_ptr,
+    double* solar_azimuth_rad_ptr
 )
 {
     // get mean longitude and mean anomaly
-    double mean_longitude_deg = this->__getMeanLongitudeDeg();
-    double mean_anomaly_rad = this->__getMeanAnomalyRad();
+    double mean_longitude_deg = this->__getMeanLongitudeDeg(julian_day);
+    double mean_anomaly_rad = this->__getMeanAnomalyRad(julian_day);
     
     
     // get ecliptic longitude and obliquity of the ecliptic
@@ -1041,11 +1146,12 @@ double Solar :: __getPlaneOfArrayIrradiancekWm2(
         mean_anomaly_rad
     );
     
-    double obleq_rad = this->__getObliquityOfEclipticRad();
+    double obleq_rad = this->__getObliquityOfEclipticRad(julian_day);
     
     
     // get local mean siderial time
-    double Greenwich_mean_siderial_time_hrs = this->__getGreenwichMeanSiderialTimeHrs();
+    double Greenwich_mean_siderial_time_hrs =
+        this->__getGreenwichMeanSiderialTimeHrs(julian_day);
     
     double local_mean_siderial_time_hrs = this->__getLocalMeanSiderialTimeHrs(
         Greenwich_mean_siderial_time_hrs
@@ -1063,31 +1169,207 @@ double Solar :: __getPlaneOfArrayIrradiancekWm2(
     
     
     // get solar azimuth and zenith
-    double solar_azimuth_rad = this->__getSolarAzimuthRad(
+    *solar_azimuth_rad_ptr = this->__getSolarAzimuthRad(
         declination_rad,
         hour_angle_rad
     );
     
-    double solar_zenith_rad = this->__getSolarZenithRad(
+    *solar_zenith_rad_ptr = this->__getSolarZenithRad(
         declination_rad,
         hour_angle_rad
     );
     
+    return;
+}   /* __computeSolarPosition() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string Solar :: __getEphemerisKey(void)
+///
+/// \brief Helper method to construct a key which uniquely identifies the site of this
+///     asset, for sharing its solar ephemeris through DataCache. Encodes the site
+///     (latitude and longitude) and the start of the series (Julian day and initial
+///     time) exactly. The time series itself is not encoded; rather, DataCache checks
+///     that the cached ephemeris is over the current time series (see
+///     DataCache::getSolarEphemeris()).
+///
+/// \return The site solar ephemeris key.
+///
+
+std::string Solar :: __getEphemerisKey(void)
+{
+    std::ostringstream key_stream;
     
-    // get diffuse horizontal irradiance (DHI) and direct normal irradiance (DNI)
-    double diffuse_horizontal_irradiance_kWm2 = this->__getDiffuseHorizontalIrradiancekWm2(
-        solar_resource_kWm2
-    );
+    key_stream << std::hexfloat;
+    key_stream << "Solar::ephemeris";
+    key_stream << "::" << this->latitude_deg;
+    key_stream << "::" << this->longitude_deg;
+    key_stream << "::" << this->julian_day;
+    key_stream << "::" << this->init_time_hrs;
     
-    double direct_normal_irradiance_kWm2 = this->__getDirectNormalIrradiancekWm2(
-        solar_resource_kWm2,
-        diffuse_horizontal_irradiance_kWm2,
-        solar_zenith_rad
-    );
+    return key_stream.str();
+}   /* __getEphemerisKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn SolarEphemerisData Solar :: __buildEphemeris(void)
+///
+/// \brief Helper method to build the site solar ephemeris (the position of the sun at
+///     every point of the current modelling time series). The sines and cosines of
+///     the solar angles are tabulated too, so that block production is trig-free
+///     (see computeProductionBlockkW()).
+///
+/// \return The site solar ephemeris.
+///
+
+SolarEphemerisData Solar :: __buildEphemeris(void)
+{
+    SolarEphemerisData ephemeris;
+    
+    int n_points = this->time_vec_hrs_ptr->size();
     
+    ephemeris.time_vec_hrs = *(this->time_vec_hrs_ptr);
+    ephemeris.solar_zenith_vec_rad.resize(n_points, 0);
+    ephemeris.solar_azimuth_vec_rad.resize(n_points, 0);
     
+    ephemeris.cos_zenith_vec.resize(n_points, 0);
+    ephemeris.sin_zenith_vec.resize(n_points, 0);
+    ephemeris.cos_azimuth_vec.resize(n_points, 0);
+    ephemeris.sin_azimuth_vec.resize(n_points, 0);
+    
+    for (int i = 0; i < n_points; i++) {
+        this->__computeSolarPosition(
+            this->getJulianDay(i),
+            &(ephemeris.solar_zenith_vec_rad[i]),
+            &(ephemeris.solar_azimuth_vec_rad[i])
+        );
+        
+        ephemeris.cos_zenith_vec[i] = cos(ephemeris.solar_zenith_vec_rad[i]);
+        ephemeris.sin_zenith_vec[i] = sin(ephemeris.solar_zenith_vec_rad[i]);
+        ephemeris.cos_azimuth_vec[i] = cos(ephemeris.solar_azimuth_vec_rad[i]);
+        ephemeris.sin_azimuth_vec[i] = sin(ephemeris.solar_azimuth_vec_rad[i]);
+    }
+    
+    return ephemeris;
+}   /* __buildEphemeris() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __getSolarPosition(
+///         int timestep,
+///         double* solar_zenith_rad_ptr,
+///         double* solar_azimuth_rad_ptr
+///     )
+///
+/// \brief Helper method to look up the position (zenith and azimuth) of the sun at the
+///     given timestep in the site solar ephemeris. The ephemeris is acquired on first
+///     use, and re-acquired whenever the modelling time series changes (e.g., on a new
+///     streaming window). Solar assets at the same site share one ephemeris, and the
+///     cache holds only that of the current window (see
+///     DataCache::getSolarEphemeris()).
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \param solar_zenith_rad_ptr A pointer to the solar zenith [rad] to be written to.
+///
+/// \param solar_azimuth_rad_ptr A pointer to the solar azimuth [rad] to be written to.
+///
+
+void Solar :: __getSolarPosition(
+    int timestep,
+    double* solar_zenith_rad_ptr,
+    double* solar_azimuth_rad_ptr
+)
+{
+    //  1. acquire ephemeris (if none, or if time base has changed)
+    if (
+        this->ephemeris_ptr == nullptr or
+        timestep >= (int)this->ephemeris_ptr->time_vec_hrs.size() or
+        this->ephemeris_ptr->time_vec_hrs[timestep] !=
+            (*(this->time_vec_hrs_ptr))[timestep]
+    ) {
+        this->ephemeris_ptr = DataCache::getSolarEphemeris(
+            this->__getEphemerisKey(),
+            this->time_vec_hrs_ptr,
+            [this](void) {
+                return this->__buildEphemeris();
+            }
+        );
+    }
+    
+    //  2. look up solar position
+    *solar_zenith_rad_ptr = this->ephemeris_ptr->solar_zenith_vec_rad[timestep];
+    *solar_azimuth_rad_ptr = this->ephemeris_ptr->solar_azimuth_vec_rad[timestep];
+    
+    return;
+}   /* __getSolarPosition() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Solar :: __getPlaneOfArrayIrradiancekWm2(
+///         int plane,
+///         double solar_resource_kWm2,
+///         double diffuse_horizontal_irradiance_kWm2,
+///         double direct_normal_irradiance_kWm2,
+///         double solar_zenith_rad,
+///         double solar_azimuth_rad
+///     )
+///
+/// \brief Method which takes in the (decomposed) solar resource and the position of
+///     the sun at a particular point in time, and then returns the nominal plane of
+///     array irradiance of the given panel plane. From eqn (7.1) of Gilman. The
+///     decomposition and solar position are common to all planes, so only the angle of
+///     incidence and plane-dependent terms are computed here.
+///
+/// Ref: \cite Gilman_2018\n
+///
+/// \param plane The index of the panel plane.
+///
+/// \param solar_resource_kWm2 Solar resource (i.e. global horizontal irradiance) [kW/m2].
+///
+/// \param diffuse_horizontal_irradiance_kWm2 The DHI [kW/m2].
+///
+/// \param direct_normal_irradiance_kWm2 The DNI [kW/m2].
+///
+/// \param solar_zenith_rad The solar zenith [rad].
+///
+/// \param solar_azimuth_rad The solar azimuth [rad].
+///
+/// \return The nominal plane of array irradiance [kW/m2].
+///
+
+double Solar :: __getPlaneOfArrayIrradiancekWm2(
+    int plane,
+    double solar_resource_kWm2,
+    double diffuse_horizontal_irradiance_kWm2,
+    double direct_normal_irradiance_kWm2,
+    double solar_zenith_rad,
+    double solar_azimuth_rad
+)
+{
     // get angle of incidence
     double angle_of_incidence_rad = this->__getAngleOfIncidenceRad(
+        plane,
         solar_zenith_rad,
         solar_azimuth_rad
     );
@@ -1103,10 +1385,12 @@ double Solar :: __getPlaneOfArrayIrradiancekWm2(
     );
     
     plane_of_array_irradiance_kWm2 += this->__getDiffuseIrradiancekWm2(
+        plane,
         diffuse_horizontal_irradiance_kWm2
     );
     
     plane_of_array_irradiance_kWm2 += this->__getGroundReflectedIrradiancekWm2(
+        plane,
         solar_resource_kWm2
     );
     
@@ -1128,7 +1412,7 @@ double Solar :: __getPlaneOfArrayIrradiancekWm2(
 ///
 /// \brief Method which takes in the solar resource at a particular point in time, and
 ///     then returns the solar PV production at that point in time base on a simple,
-///     "HOMER-like" model.
+///     "HOMER-like" model. The production of each panel plane is recorded.
 ///
 /// Ref: \cite HOMER_how_homer_calculates_the_pv_array_power_output\n
 ///
@@ -1147,12 +1431,23 @@ double Solar :: __computeSimpleProductionkW(
     double solar_resource_kWm2
 )
 {
-    // apply simple production model (GHI -> production)
-    double production_kW = this->derating * solar_resource_kWm2 * this->capacity_kW;
+    double production_kW = 0;
     
-    // cap production at capacity
-    if (production_kW > this->capacity_kW) {
-        production_kW = this->capacity_kW;
+    for (int plane = 0; plane < this->n_planes; plane++) {
+        // apply simple production model (GHI -> production)
+        double plane_production_kW = this->derating * solar_resource_kWm2 *
+            this->plane_capacity_kW_vec[plane];
+        
+        // cap production at capacity
+        if (plane_production_kW > this->plane_capacity_kW_vec[plane]) {
+            plane_production_kW = this->plane_capacity_kW_vec[plane];
+        }
+        
+        if (this->n_planes > 1) {
+            this->plane_production_vec_kW[plane][timestep] = plane_production_kW;
+        }
+        
+        production_kW += plane_production_kW;
     }
     
     return production_kW;
@@ -1173,7 +1468,9 @@ double Solar :: __computeSimpleProductionkW(
 ///
 /// \brief Method which takes in the solar resource at a particular point in time, and
 ///     then returns the solar PV production at that point in time base on a detailed,
-///     "PVWatts/SAM-like" model.
+///     "PVWatts/SAM-like" model. The solar resource is decomposed (into DHI and DNI)
+///     once, and then fanned out to each panel plane, the production of which is
+///     recorded.
 ///
 /// Ref: \cite Gilman_2018\n
 ///
@@ -1192,19 +1489,49 @@ double Solar :: __computeDetailedProductionkW(
     double solar_resource_kWm2
 )
 {
-    // apply detailed production model (POA irradiance -> production)
-    double plane_of_array_irradiance_kWm2 = this->__getPlaneOfArrayIrradiancekWm2(
-        timestep,
-        dt_hrs,
+    //  1. get solar zenith and azimuth (from the site ephemeris)
+    double solar_zenith_rad = 0;
+    double solar_azimuth_rad = 0;
+    
+    this->__getSolarPosition(timestep, &solar_zenith_rad, &solar_azimuth_rad);
+    
+    //  2. get diffuse horizontal irradiance (DHI) and direct normal irradiance (DNI)
+    double diffuse_horizontal_irradiance_kWm2 = this->__getDiffuseHorizontalIrradiancekWm2(
         solar_resource_kWm2
     );
     
-    double production_kW =
-        this->derating * plane_of_array_irradiance_kWm2 * this->capacity_kW;
+    double direct_normal_irradiance_kWm2 = this->__getDirectNormalIrradiancekWm2(
+        solar_resource_kWm2,
+        diffuse_horizontal_irradiance_kWm2,
+        solar_zenith_rad
+    );
+    
+    //  3. apply detailed production model to each plane (POA irradiance -> production)
+    double production_kW = 0;
     
-    // cap production at capacity
-    if (production_kW > this->capacity_kW) {
-        production_kW = this->capacity_kW;
+    for (int plane = 0; plane < this->n_planes; plane++) {
+        double plane_of_array_irradiance_kWm2 = this->__getPlaneOfArrayIrradiancekWm2(
+            plane,
+            solar_resource_kWm2,
+            diffuse_horizontal_irradiance_kWm2,
+            direct_normal_irradiance_kWm2,
+            solar_zenith_rad,
+            solar_azimuth_rad
+        );
+        
+        double plane_production_kW = this->derating * plane_of_array_irradiance_kWm2 *
+            this->plane_capacity_kW_vec[plane];
+        
+        // cap production at capacity
+        if (plane_production_kW > this->plane_capacity_kW_vec[plane]) {
+            plane_production_kW = this->plane_capacity_kW_vec[plane];
+        }
+        
+        if (this->n_planes > 1) {
+            this->plane_production_vec_kW[plane][timestep] = plane_production_kW;
+        }
+        
+        production_kW += plane_production_kW;
     }
     
     return production_kW;
@@ -1217,20 +1544,304 @@ double Solar :: __computeDetailedProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Solar :: __writeSummary(std::string write_path)
+/// \fn void Solar :: __computeDetailedProductionBlockkW(
+///         int plane,
+///         int start_timestep,
+///         int n_timesteps,
+///         const double* solar_resource_kWm2_ptr,
+///         double* production_kW_ptr
+///     )
+///
+/// \brief Helper method to compute the detailed production of a panel plane over a
+///     block of timesteps.
+///     Using the tabulated sines and cosines of the site ephemeris, the plane of array
+///     irradiance reduces to
+///
+///         POA = GHI * ((1 - k) * cos(AOI) / cos(zenith) + k * cos(tilt) + R),
+///
+///     with cos(AOI) expanded by the angle difference identity (k being the DHI ratio,
+///     and R the ground reflected ratio), so the kernel is trig-free. Timesteps are
+///     processed four at a time with AVX, two at a time with SSE2, and one at a time
+///     otherwise (and for any remainder).
+///
+/// Ref: \cite Gilman_2018\n
+///
+/// \param plane The index of the panel plane.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the block
+///     starts.
+///
+/// \param n_timesteps The number of timesteps in the block.
+///
+/// \param solar_resource_kWm2_ptr A pointer to the solar resource (i.e. global
+///     horizontal irradiance) [kW/m2] over the block.
+///
+/// \param production_kW_ptr A pointer to the production [kW] of the panel plane over
+///     the block, to be written to.
+///
+
+void Solar :: __computeDetailedProductionBlockkW(
+    int plane,
+    int start_timestep,
+    int n_timesteps,
+    const double* solar_resource_kWm2_ptr,
+    double* production_kW_ptr
+)
+{
+    //  1. make sure the site ephemeris is current over the block
+    double solar_zenith_rad = 0;
+    double solar_azimuth_rad = 0;
+    
+    this->__getSolarPosition(start_timestep, &solar_zenith_rad, &solar_azimuth_rad);
+    
+    this->__getSolarPosition(
+        start_timestep + n_timesteps - 1,
+        &solar_zenith_rad,
+        &solar_azimuth_rad
+    );
+    
+    const double* cos_zenith_ptr =
+        this->ephemeris_ptr->cos_zenith_vec.data() + start_timestep;
+    const double* sin_zenith_ptr =
+        this->ephemeris_ptr->sin_zenith_vec.data() + start_timestep;
+    const double* cos_azimuth_ptr =
+        this->ephemeris_ptr->cos_azimuth_vec.data() + start_timestep;
+    const double* sin_azimuth_ptr =
+        this->ephemeris_ptr->sin_azimuth_vec.data() + start_timestep;
+    
+    //  2. get per-plane constants
+    double cos_tilt = cos(this->plane_tilt_rad_vec[plane]);
+    double sin_tilt = sin(this->plane_tilt_rad_vec[plane]);
+    
+    double aoi_cos_azimuth_factor = cos(this->plane_azimuth_rad_vec[plane]) * sin_tilt;
+    double aoi_sin_azimuth_factor = sin(this->plane_azimuth_rad_vec[plane]) * sin_tilt;
+    
+    double DHI_ratio = this->__getDiffuseHorizontalIrradiancekWm2(1);
+    double beam_factor = 1 - DHI_ratio;
+    double sky_ground_factor = this->__getDiffuseIrradiancekWm2(plane, DHI_ratio) +
+        this->__getGroundReflectedIrradiancekWm2(plane, 1);
+    
+    double plane_capacity_kW = this->plane_capacity_kW_vec[plane];
+    double production_factor = this->derating * plane_capacity_kW;
+    
+    int i = 0;
+    
+    //  3. AVX (four timesteps at a time)
+    #if defined(__AVX__)
+        __m256d aoi_cos_azimuth_factor_256 = _mm256_set1_pd(aoi_cos_azimuth_factor);
+        __m256d aoi_sin_azimuth_factor_256 = _mm256_set1_pd(aoi_sin_azimuth_factor);
+        __m256d cos_tilt_256 = _mm256_set1_pd(cos_tilt);
+        __m256d beam_factor_256 = _mm256_set1_pd(beam_factor);
+        __m256d sky_ground_factor_256 = _mm256_set1_pd(sky_ground_factor);
+        __m256d production_factor_256 = _mm256_set1_pd(production_factor);
+        __m256d capacity_256 = _mm256_set1_pd(plane_capacity_kW);
+        __m256d one_256 = _mm256_set1_pd(1);
+        __m256d minus_one_256 = _mm256_set1_pd(-1);
+        __m256d zero_256 = _mm256_setzero_pd();
+        
+        for ( ; i + 4 <= n_timesteps; i += 4) {
+            __m256d GHI_256 = _mm256_loadu_pd(solar_resource_kWm2_ptr + i);
+            __m256d cos_zenith_256 = _mm256_loadu_pd(cos_zenith_ptr + i);
+            
+            __m256d cos_AOI_256 = _mm256_add_pd(
+                _mm256_mul_pd(
+                    _mm256_loadu_pd(sin_zenith_ptr + i),
+                    _mm256_add_pd(
+                        _mm256_mul_pd(
+                            _mm256_loadu_pd(cos_azimuth_ptr + i),
+                            aoi_cos_azimuth_factor_256
+                        ),
+                        _mm256_mul_pd(
+                            _mm256_loadu_pd(sin_azimuth_ptr + i),
+                            aoi_sin_azimuth_factor_256
+                        )
+                    )
+                ),
+                _mm256_mul_pd(cos_zenith_256, cos_tilt_256)
+            );
+            
+            cos_AOI_256 = _mm256_min_pd(_mm256_max_pd(cos_AOI_256, minus_one_256), one_256);
+            
+            __m256d POA_256 = _mm256_mul_pd(
+                GHI_256,
+                _mm256_add_pd(
+                    _mm256_div_pd(
+                        _mm256_mul_pd(beam_factor_256, cos_AOI_256),
+                        cos_zenith_256
+                    ),
+                    sky_ground_factor_256
+                )
+            );
+            
+            __m256d production_256 = _mm256_min_pd(
+                _mm256_mul_pd(production_factor_256, POA_256),
+                capacity_256
+            );
+            
+            production_256 = _mm256_and_pd(
+                production_256,
+                _mm256_cmp_pd(GHI_256, zero_256, _CMP_GT_OQ)
+            );
+            
+            _mm256_storeu_pd(production_kW_ptr + i, production_256);
+        }
+    #endif
+    
+    //  4. SSE2 (two timesteps at a time)
+    #if defined(__SSE2__) || defined(_M_X64)
+        __m128d aoi_cos_azimuth_factor_128 = _mm_set1_pd(aoi_cos_azimuth_factor);
+        __m128d aoi_sin_azimuth_factor_128 = _mm_set1_pd(aoi_sin_azimuth_factor);
+        __m128d cos_tilt_128 = _mm_set1_pd(cos_tilt);
+        __m128d beam_factor_128 = _mm_set1_pd(beam_factor);
+        __m128d sky_ground_factor_128 = _mm_set1_pd(sky_ground_factor);
+        __m128d production_factor_128 = _mm_set1_pd(production_factor);
+        __m128d capacity_128 = _mm_set1_pd(plane_capacity_kW);
+        __m128d one_128 = _mm_set1_pd(1);
+        __m128d minus_one_128 = _mm_set1_pd(-1);
+        __m128d zero_128 = _mm_setzero_pd();
+        
+        for ( ; i + 2 <= n_timesteps; i += 2) {
+            __m128d GHI_128 = _mm_loadu_pd(solar_resource_kWm2_ptr + i);
+            __m128d cos_zenith_128 = _mm_loadu_pd(cos_zenith_ptr + i);
+            
+            __m128d cos_AOI_128 = _mm_add_pd(
+                _mm_mul_pd(
+                    _mm_loadu_pd(sin_zenith_ptr + i),
+                    _mm_add_pd(
+                        _mm_mul_pd(
+                            _mm_loadu_pd(cos_azimuth_ptr + i),
+                            aoi_cos_azimuth_factor_128
+                        ),
+                        _mm_mul_pd(
+                            _mm_loadu_pd(sin_azimuth_ptr + i),
+                            aoi_sin_azimuth_factor_128
+                        )
+                    )
+                ),
+                _mm_mul_pd(cos_zenith_128, cos_tilt_128)
+            );
+            
+            cos_AOI_128 = _mm_min_pd(_mm_max_pd(cos_AOI_128, minus_one_128), one_128);
+            
+            __m128d POA_128 = _mm_mul_pd(
+                GHI_128,
+                _mm_add_pd(
+                    _mm_div_pd(_mm_mul_pd(beam_factor_128, cos_AOI_128), cos_zenith_128),
+                    sky_ground_factor_128
+                )
+            );
+            
+            __m128d production_128 = _mm_min_pd(
+                _mm_mul_pd(production_factor_128, POA_128),
+                capacity_128
+            );
+            
+            production_128 = _mm_and_pd(production_128, _mm_cmpgt_pd(GHI_128, zero_128));
+            
+            _mm_storeu_pd(production_kW_ptr + i, production_128);
+        }
+    #endif
+    
+    //  5. scalar (remainder, or no SIMD)
+    for ( ; i < n_timesteps; i++) {
+        double GHI = solar_resource_kWm2_ptr[i];
+        
+        if (GHI <= 0) {
+            production_kW_ptr[i] = 0;
+            continue;
+        }
+        
+        double cos_AOI = sin_zenith_ptr[i] * (
+                cos_azimuth_ptr[i] * aoi_cos_azimuth_factor +
+                sin_azimuth_ptr[i] * aoi_sin_azimuth_factor
+            ) +
+            cos_zenith_ptr[i] * cos_tilt;
+        
+        if (cos_AOI < -1) {
+            cos_AOI = -1;
+        }
+        
+        else if (cos_AOI > 1) {
+            cos_AOI = 1;
+        }
+        
+        double POA = GHI * ((beam_factor * cos_AOI) / cos_zenith_ptr[i] + sky_ground_factor);
+        
+        double production_kW = production_factor * POA;
+        
+        if (production_kW > plane_capacity_kW) {
+            production_kW = plane_capacity_kW;
+        }
+        
+        production_kW_ptr[i] = production_kW;
+    }
+    
+    return;
+}   /* __computeDetailedProductionBlockkW() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __splitProductionByCapacity(int timestep, double production_kW)
+///
+/// \brief Helper method to record the production of each panel plane at the given
+///     timestep, as the given (array) production split in proportion to plane
+///     capacity. Applies when production does not depend on plane orientation (i.e.,
+///     no resource, or a given production time series). Does nothing for a single
+///     plane array (whose production is that of the array).
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \param production_kW The production [kW] of the solar PV array.
+///
+
+void Solar :: __splitProductionByCapacity(int timestep, double production_kW)
+{
+    if (this->n_planes == 1) {
+        return;
+    }
+    
+    for (int plane = 0; plane < this->n_planes; plane++) {
+        this->plane_production_vec_kW[plane][timestep] = production_kW *
+            (this->plane_capacity_kW_vec[plane] / this->capacity_kW);
+    }
+    
+    return;
+}   /* __splitProductionByCapacity() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Solar.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Solar :: __writeSummary(std::string write_path)
+void Solar :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write summary results (markdown)
     ofs << "# ";
@@ -1282,6 +1893,20 @@ void Solar :: __writeSummary(std::string write_path)
     
     ofs << "Derating Factor: " << this->derating << "  \n";
     
+    ofs << "Panel Planes: " << this->n_planes << "  \n";
+    
+    if (this->n_planes > 1) {
+        ofs << "\n";
+        
+        for (int plane = 0; plane < this->n_planes; plane++) {
+            ofs << "Plane " << plane << ": azimuth "
+                << (180.0 / M_PI) * this->plane_azimuth_rad_vec[plane] << " deg, tilt "
+                << (180.0 / M_PI) * this->plane_tilt_rad_vec[plane] << " deg, capacity "
+                << this->plane_capacity_kW_vec[plane] << " kW, total production "
+                << this->plane_total_production_kWh[plane] << " kWh  \n";
+        }
+    }
+    
     ofs << "\n--------\n\n";
     
     //  2.4. Solar Results
@@ -1303,7 +1928,7 @@ void Solar :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeSummary() */
 
@@ -1319,7 +1944,8 @@ void Solar :: __writeSummary(std::string write_path)
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
 ///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Solar.
@@ -1335,19 +1961,22 @@ void Solar :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Solar :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
     std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -1358,6 +1987,13 @@ void Solar :: __writeTimeSeries(
     ofs << "Curtailment [kW],";
     ofs << "Capital Cost (actual),";
     ofs << "Operation and Maintenance Cost (actual),";
+    
+    if (this->n_planes > 1) {
+        for (int plane = 0; plane < this->n_planes; plane++) {
+            ofs << "Plane " << plane << " Production [kW],";
+        }
+    }
+    
     ofs << "\n";
     
     for (int i = 0; i < max_lines; i++) {
@@ -1377,10 +2013,17 @@ void Solar :: __writeTimeSeries(
         ofs << this->curtailment_vec_kW[i] << ",";
         ofs << this->capital_cost_vec[i] << ",";
         ofs << this->operation_maintenance_cost_vec[i] << ",";
+        
+        if (this->n_planes > 1) {
+            for (int plane = 0; plane < this->n_planes; plane++) {
+                ofs << this->plane_production_vec_kW[plane][i] << ",";
+            }
+        }
+        
         ofs << "\n";
     }
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeTimeSeries() */
 
@@ -1460,6 +2103,9 @@ Renewable(
     
     this->julian_day = solar_inputs.julian_day;
     
+    this->time_vec_hrs_ptr = time_vec_hrs_ptr;
+    this->init_time_hrs = time_vec_hrs_ptr->front();
+    
     this->latitude_deg = solar_inputs.latitude_deg;
     this->longitude_deg = solar_inputs.longitude_deg;
     
@@ -1469,9 +2115,47 @@ Renewable(
     this->panel_azimuth_deg = solar_inputs.panel_azimuth_deg;
     this->panel_tilt_deg = solar_inputs.panel_tilt_deg;
     
+    this->n_planes = 1;
+    
+    if (not solar_inputs.plane_azimuth_deg_vec.empty()) {
+        this->n_planes = solar_inputs.plane_azimuth_deg_vec.size();
+        
+        this->panel_azimuth_deg = solar_inputs.plane_azimuth_deg_vec[0];
+        this->panel_tilt_deg = solar_inputs.plane_tilt_deg_vec[0];
+    }
+    
     this->panel_azimuth_rad = (M_PI / 180.0) * this->panel_azimuth_deg;
     this->panel_tilt_rad = (M_PI / 180.0) * this->panel_tilt_deg;
     
+    this->plane_azimuth_rad_vec.resize(this->n_planes, this->panel_azimuth_rad);
+    this->plane_tilt_rad_vec.resize(this->n_planes, this->panel_tilt_rad);
+    this->plane_capacity_kW_vec.resize(this->n_planes, this->capacity_kW);
+    
+    if (this->n_planes > 1) {
+        for (int plane = 0; plane < this->n_planes; plane++) {
+            this->plane_azimuth_rad_vec[plane] =
+                (M_PI / 180.0) * solar_inputs.plane_azimuth_deg_vec[plane];
+            this->plane_tilt_rad_vec[plane] =
+                (M_PI / 180.0) * solar_inputs.plane_tilt_deg_vec[plane];
+            
+            this->plane_capacity_kW_vec[plane] = this->capacity_kW / this->n_planes;
+            
+            if (not solar_inputs.plane_capacity_fraction_vec.empty()) {
+                this->plane_capacity_kW_vec[plane] = this->capacity_kW *
+                    solar_inputs.plane_capacity_fraction_vec[plane];
+            }
+        }
+    }
+    
+    this->plane_total_production_kWh.resize(this->n_planes, 0);
+    
+    if (this->n_planes > 1) {
+        this->plane_production_vec_kW.resize(
+            this->n_planes,
+            std::vector<double>(this->n_points, 0)
+        );
+    }
+    
     this->albedo_ground_reflectance = solar_inputs.albedo_ground_reflectance;
     
     this->power_model = solar_inputs.power_model;
@@ -1562,6 +2246,62 @@ void Solar :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window. Resizes and zeros the modelling
+///     time series (including per-plane production), while all scalar state carries
+///     over.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void Solar :: resetWindow(int n_points)
+{
+    //  1. invoke base class method
+    Renewable :: resetWindow(n_points);
+    
+    //  2. reset per-plane production time series (multi-plane only)
+    for (size_t plane = 0; plane < this->plane_production_vec_kW.size(); plane++) {
+        this->plane_production_vec_kW[plane].assign(this->n_points, 0);
+    }
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Solar :: getJulianDay(int timestep)
+///
+/// \brief Method to compute the Julian day at the given timestep. This is a pure
+///     function of the modelling time series (and the Julian day at its start), so
+///     solar production may be computed for any timestep, in any order.
+///
+/// \param timestep The timestep (i.e., time series index) of interest.
+///
+/// \return The number of days (including partial days) since 12:00 on 1 Jan 2000, at
+///     the given timestep.
+///
+
+double Solar :: getJulianDay(int timestep)
+{
+    double julian_day = this->julian_day +
+        ((*(this->time_vec_hrs_ptr))[timestep] - this->init_time_hrs) / 24;
+    
+    return julian_day;
+}   /* getJulianDay() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1592,12 +2332,15 @@ double Solar :: computeProductionkW(
     //  given production time series override
     if (this->normalized_production_series_given) {
         double production_kW = Production :: getProductionkW(timestep);
+        this->__splitProductionByCapacity(timestep, production_kW);
         
         return production_kW;
     }
     
     // check if no resource
     if (solar_resource_kWm2 <= 0) {
+        this->__splitProductionByCapacity(timestep, 0);
+        
         return 0;
     }
     
@@ -1648,6 +2391,216 @@ double Solar :: computeProductionkW(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: computeProductionBlockkW(
+///         int start_timestep,
+///         std::vector<double>* solar_resource_vec_kWm2_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in the solar resource over a block of consecutive
+///     timesteps, and then writes the solar PV production over that block. Equivalent
+///     to calling computeProductionkW() at each timestep, but the detailed model is
+///     evaluated by a vectorized kernel. Its results agree with those of
+///     computeProductionkW() to within 1e-9 * capacity_kW (the kernel expands the
+///     angle of incidence algebraically, rather than through acos() and cos()).
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the block
+///     starts.
+///
+/// \param solar_resource_vec_kWm2_ptr A pointer to the solar resource (i.e. global
+///     horizontal irradiance) [kW/m2] over the block, one value per timestep.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the block is written (resized to match, if need be).
+///
+
+void Solar :: computeProductionBlockkW(
+    int start_timestep,
+    std::vector<double>* solar_resource_vec_kWm2_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    int n_timesteps = solar_resource_vec_kWm2_ptr->size();
+    production_vec_kW_ptr->resize(n_timesteps, 0);
+    
+    if (n_timesteps == 0) {
+        return;
+    }
+    
+    //  1. check block
+    if (
+        start_timestep < 0 or
+        start_timestep + n_timesteps > this->n_points
+    ) {
+        std::string error_str = "ERROR:  Solar::computeProductionBlockkW():  ";
+        error_str += "block [";
+        error_str += std::to_string(start_timestep);
+        error_str += ", ";
+        error_str += std::to_string(start_timestep + n_timesteps);
+        error_str += ") is outside of the modelling time series";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. given production time series override
+    if (this->normalized_production_series_given) {
+        for (int i = 0; i < n_timesteps; i++) {
+            (*production_vec_kW_ptr)[i] =
+                Production :: getProductionkW(start_timestep + i);
+            
+            this->__splitProductionByCapacity(
+                start_timestep + i,
+                (*production_vec_kW_ptr)[i]
+            );
+        }
+        
+        return;
+    }
+    
+    //  3. compute production
+    switch (this->power_model) {
+        case (SolarPowerProductionModel :: SOLAR_POWER_SIMPLE): {
+            for (int i = 0; i < n_timesteps; i++) {
+                double solar_resource_kWm2 = (*solar_resource_vec_kWm2_ptr)[i];
+                
+                if (solar_resource_kWm2 <= 0) {
+                    (*production_vec_kW_ptr)[i] = 0;
+                    this->__splitProductionByCapacity(start_timestep + i, 0);
+                    
+                    continue;
+                }
+                
+                (*production_vec_kW_ptr)[i] = this->__computeSimpleProductionkW(
+                    start_timestep + i,
+                    0,
+                    solar_resource_kWm2
+                );
+            }
+            
+            break;
+        }
+        
+        case (SolarPowerProductionModel :: SOLAR_POWER_DETAILED): {
+            production_vec_kW_ptr->assign(n_timesteps, 0);
+            
+            //  single plane, write straight into output
+            if (this->n_planes == 1) {
+                this->__computeDetailedProductionBlockkW(
+                    0,
+                    start_timestep,
+                    n_timesteps,
+                    solar_resource_vec_kWm2_ptr->data(),
+                    production_vec_kW_ptr->data()
+                );
+                
+                break;
+            }
+            
+            for (int plane = 0; plane < this->n_planes; plane++) {
+                double* plane_production_kW_ptr =
+                    this->plane_production_vec_kW[plane].data() + start_timestep;
+                
+                this->__computeDetailedProductionBlockkW(
+                    plane,
+                    start_timestep,
+                    n_timesteps,
+                    solar_resource_vec_kWm2_ptr->data(),
+                    plane_production_kW_ptr
+                );
+                
+                for (int i = 0; i < n_timesteps; i++) {
+                    (*production_vec_kW_ptr)[i] += plane_production_kW_ptr[i];
+                }
+            }
+            
+            break;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  Solar::computeProductionBlockkW():  ";
+            error_str += "power model ";
+            error_str += std::to_string(this->power_model);
+            error_str += " not recognized";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::runtime_error(error_str);
+            
+            break;
+        }
+    }
+    
+    return;
+}   /* computeProductionBlockkW() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Solar :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* solar_resource_vec_kWm2_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in the solar resource over a series of consecutive
+///     timesteps, and then writes the solar PV production over that series. By
+///     default, this is exactly the production given by computeProductionkW() at each
+///     timestep. In fast kernels mode, the block production kernel is used instead
+///     (see computeProductionBlockkW()), which agrees to within rounding but is not
+///     bit-identical.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param solar_resource_vec_kWm2_ptr A pointer to the solar resource (i.e. global
+///     horizontal irradiance) [kW/m2] over the series, one value per timestep.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Solar :: computeProductionSeries(
+    int start_timestep,
+    std::vector<double>* solar_resource_vec_kWm2_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    if (this->fast_kernels) {
+        this->computeProductionBlockkW(
+            start_timestep,
+            solar_resource_vec_kWm2_ptr,
+            production_vec_kW_ptr
+        );
+    }
+    
+    else {
+        Renewable :: computeProductionSeries(
+            start_timestep,
+            solar_resource_vec_kWm2_ptr,
+            production_vec_kW_ptr
+        );
+    }
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -1687,9 +2640,17 @@ double Solar :: commit(
         load_kW
     );
     
+    //  2. accumulate per-plane production (a single plane produces that of the array)
+    if (this->n_planes == 1) {
+        this->plane_total_production_kWh[0] += production_kW * dt_hrs;
+    }
     
-    //  2. increment julian day
-    this->julian_day += dt_hrs / 24;
+    else {
+        for (int plane = 0; plane < this->n_planes; plane++) {
+            this->plane_total_production_kWh[plane] +=
+                this->plane_production_vec_kW[plane][timestep] * dt_hrs;
+        }
+    }
     
     return load_kW;
 }   /* commit() */
@@ -83,7 +83,39 @@ void Tidal :: __checkInputs(TidalInputs tidal_inputs)
         std::cout << warning_str << std::endl;
     }
     
-    //  2. check firmness_factor
+    //  2. if TIDAL_POWER_LOOKUP, check that path is given
+    if (
+        tidal_inputs.power_model == TidalPowerProductionModel :: TIDAL_POWER_LOOKUP and
+        tidal_inputs.path_2_normalized_power_curve.empty()
+    ) {
+        std::string error_str = "ERROR:  Tidal()  power model was set to ";
+        error_str += "TidalPowerProductionModel::TIDAL_POWER_LOOKUP, but no path to a ";
+        error_str += "normalized power curve was given";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. check power curve resample points
+    if (
+        tidal_inputs.power_curve_resample_points < 0 or
+        tidal_inputs.power_curve_resample_points == 1
+    ) {
+        std::string error_str = "ERROR:  Tidal():  ";
+        error_str += "TidalInputs::power_curve_resample_points must be 0 (automatic), or ";
+        error_str += ">= 2";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  4. check firmness_factor
     if (
         tidal_inputs.firmness_factor < 0 or
         tidal_inputs.firmness_factor > 1
@@ -161,7 +193,7 @@ double Tidal :: __getGenericOpMaintCost(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Tidal :: __computeCubicProductionkW(
+/// \fn double Tidal :: __computeCubicProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double tidal_resource_ms
@@ -181,10 +213,10 @@ double Tidal :: __getGenericOpMaintCost(void)
 ///
 /// \param tidal_resource_ms The available tidal stream resource [m/s].
 ///
-/// \return The production [kW] of the tidal turbine, under a cubic model.
+/// \return The normalized production of the tidal turbine, under a cubic model.
 ///
 
-double Tidal :: __computeCubicProductionkW(
+double Tidal :: __computeCubicProduction(
     int timestep,
     double dt_hrs,
     double tidal_resource_ms
@@ -210,8 +242,8 @@ double Tidal :: __computeCubicProductionkW(
         production = 1;
     }
     
-    return production * this->capacity_kW;
-}   /* __computeCubicProductionkW() */
+    return production;
+}   /* __computeCubicProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -220,7 +252,7 @@ double Tidal :: __computeCubicProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Tidal :: __computeExponentialProductionkW(
+/// \fn double Tidal :: __computeExponentialProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double tidal_resource_ms
@@ -237,10 +269,10 @@ double Tidal :: __computeCubicProductionkW(
 ///
 /// \param tidal_resource_ms The available tidal stream resource [m/s].
 ///
-/// \return The production [kW] of the tidal turbine, under an exponential model.
+/// \return The normalized production of the tidal turbine, under an exponential model.
 ///
 
-double Tidal :: __computeExponentialProductionkW(
+double Tidal :: __computeExponentialProduction(
     int timestep,
     double dt_hrs,
     double tidal_resource_ms
@@ -256,15 +288,18 @@ double Tidal :: __computeExponentialProductionkW(
     }
     
     else if (turbine_speed >= -0.71 and turbine_speed <= 0) {
-        production = 1.69215 * exp(1.25909 * turbine_speed) - 0.69215;
+        double exponent = 1.25909 * turbine_speed;
+        
+        production = 1.69215 *
+            (this->fast_kernels ? FastMath::exp(exponent) : exp(exponent)) - 0.69215;
     }
     
     else {
         production = 1;
     }
     
-    return production * this->capacity_kW;
-}   /* __computeExponentialProductionkW() */
+    return production;
+}   /* __computeExponentialProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -273,14 +308,15 @@ double Tidal :: __computeExponentialProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Tidal :: __computeLookupProductionkW(
+/// \fn double Tidal :: __computeLookupProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double tidal_resource_ms
 ///     )
 ///
-/// \brief Helper method to compute tidal turbine production by way of
-///     looking up using given power curve data.
+/// \brief Helper method to compute tidal turbine production by way of looking up using
+///     the given (pre-sampled) normalized power curve. Outside of the curve (i.e.,
+///     below cut-in or above cut-out), production is zero.
 ///
 /// \param timestep The current time step of the Model run.
 ///
@@ -288,19 +324,33 @@ double Tidal :: __computeExponentialProductionkW(
 ///
 /// \param tidal_resource_ms The available tidal stream resource [m/s].
 ///
-/// \return The interpolated production [kW] of the tidal tubrine.
+/// \return The interpolated normalized production of the tidal tubrine.
 ///
 
-double Tidal :: __computeLookupProductionkW(
+double Tidal :: __computeLookupProduction(
     int timestep,
     double dt_hrs,
     double tidal_resource_ms
 )
 {
-    // *** WORK IN PROGRESS *** //
+    const InterpolatorStruct1D* power_curve_ptr =
+        this->power_curve_handle.interp_struct_1D_ptr;
     
-    return 0;
-}   /* __computeLookupProductionkW() */
+    // outside of the given power curve (i.e., below cut-in or above cut-out)
+    if (
+        tidal_resource_ms < power_curve_ptr->min_x or
+        tidal_resource_ms > power_curve_ptr->max_x
+    ) {
+        return 0;
+    }
+    
+    double production = this->interpolator.interp1DUnchecked(
+        this->power_curve_handle,
+        tidal_resource_ms
+    );
+    
+    return production;
+}   /* __computeLookupProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -309,20 +359,28 @@ double Tidal :: __computeLookupProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Tidal :: __writeSummary(std::string write_path)
+/// \fn void Tidal :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Tidal.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Tidal :: __writeSummary(std::string write_path)
+void Tidal :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write summary results (markdown)
     ofs << "# ";
@@ -375,6 +433,15 @@ void Tidal :: __writeSummary(std::string write_path)
     ofs << "Power Production Model: " << this->power_model_string << "  \n";
     ofs << "Design Speed: " << this->design_speed_ms << " m/s  \n";
     
+    if (this->power_model == TidalPowerProductionModel :: TIDAL_POWER_LOOKUP) {
+        ofs << "Normalized Power Curve: "
+            << this->interpolator.path_map_1D[
+                RenewableInterpKeys :: POWER_CURVE_INTERP_KEY
+            ] << "  \n";
+        ofs << "Power Curve Resample Points: "
+            << this->power_curve_resample_points << "  \n";
+    }
+    
     ofs << "\n--------\n\n";
     
     //  2.4. Tidal Results
@@ -396,7 +463,7 @@ void Tidal :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     
     return;
 }   /* __writeSummary() */
@@ -413,7 +480,8 @@ void Tidal :: __writeSummary(std::string write_path)
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
 ///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Tidal.
@@ -429,19 +497,22 @@ void Tidal :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Tidal :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
     std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -474,6 +545,8 @@ void Tidal :: __writeTimeSeries(
         ofs << "\n";
     }
     
+    results_manifest_ptr->writeFile(write_path, ofs.str());
+    
     return;
 }   /* __writeTimeSeries() */
 
@@ -567,6 +640,11 @@ Renewable(
         case (TidalPowerProductionModel :: TIDAL_POWER_LOOKUP): {
             this->power_model_string = "LOOKUP";
             
+            this->initPowerCurve(
+                tidal_inputs.path_2_normalized_power_curve,
+                tidal_inputs.power_curve_resample_points
+            );
+            
             break;
         }
         
@@ -646,14 +724,55 @@ void Tidal :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Tidal :: computeProductionkW(
+/// \fn std::string Tidal :: getNormalizedResponseKey(void)
+///
+/// \brief Method which constructs a key that identifies the normalized response of the
+///     tidal turbine (i.e., the resource it sees and everything which shapes its power
+///     curve, but not its size). Assets with equal keys produce identical normalized
+///     production, so the Controller evaluates it once for all of them. Returns an
+///     empty key if a production time series override was given.
+///
+/// \return A key which identifies the normalized response of the tidal turbine.
+///
+
+std::string Tidal :: getNormalizedResponseKey(void)
+{
+    if (this->normalized_production_series_given) {
+        return "";
+    }
+    
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "Tidal::normalized_response";
+    key_stream << "::" << this->resource_key;
+    key_stream << "::" << this->power_model;
+    key_stream << "::" << this->fast_kernels;
+    key_stream << "::" << this->design_speed_ms;
+    
+    if (this->power_model == TidalPowerProductionModel :: TIDAL_POWER_LOOKUP) {
+        key_stream << "::" << this->power_curve_key;
+    }
+    
+    return key_stream.str();
+}   /* getNormalizedResponseKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Tidal :: computeNormalizedProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double tidal_resource_ms
 ///     )
 ///
 /// \brief Method which takes in the tidal resource at a particular point in time, and
-///     then returns the tidal turbine production at that point in time.
+///     then returns the normalized production (i.e., production per unit of capacity)
+///     of the tidal turbine at that point in time.
 ///
 /// \param timestep The timestep (i.e., time series index) for the request.
 ///
@@ -661,33 +780,26 @@ void Tidal :: handleReplacement(int timestep)
 ///
 /// \param tidal_resource_ms Tidal resource (i.e. tidal stream speed) [m/s].
 ///
-/// \return The production [kW] of the tidal turbine.
+/// \return The normalized production of the tidal turbine.
 ///
 
-double Tidal :: computeProductionkW(
+double Tidal :: computeNormalizedProduction(
     int timestep,
     double dt_hrs,
     double tidal_resource_ms
 )
 {
-    //  given production time series override
-    if (this->normalized_production_series_given) {
-        double production_kW = Production :: getProductionkW(timestep);
-        
-        return production_kW;
-    }
-    
     // check if no resource
     if (tidal_resource_ms <= 0) {
         return 0;
     }
     
-    // compute production
-    double production_kW = 0;
+    // compute normalized production
+    double production = 0;
     
     switch (this->power_model) {
         case (TidalPowerProductionModel :: TIDAL_POWER_CUBIC): {
-            production_kW = this->__computeCubicProductionkW(
+            production = this->__computeCubicProduction(
                 timestep,
                 dt_hrs,
                 tidal_resource_ms
@@ -698,7 +810,7 @@ double Tidal :: computeProductionkW(
         
         
         case (TidalPowerProductionModel :: TIDAL_POWER_EXPONENTIAL): {
-            production_kW = this->__computeExponentialProductionkW(
+            production = this->__computeExponentialProduction(
                 timestep,
                 dt_hrs,
                 tidal_resource_ms
@@ -708,7 +820,7 @@ double Tidal :: computeProductionkW(
         }
         
         case (TidalPowerProductionModel :: TIDAL_POWER_LOOKUP): {
-            production_kW = this->__computeLookupProductionkW(
+            production = this->__computeLookupProduction(
                 timestep,
                 dt_hrs,
                 tidal_resource_ms
@@ -718,7 +830,7 @@ double Tidal :: computeProductionkW(
         }
         
         default: {
-            std::string error_str = "ERROR:  Tidal::computeProductionkW():  ";
+            std::string error_str = "ERROR:  Tidal::computeNormalizedProduction():  ";
             error_str += "power model ";
             error_str += std::to_string(this->power_model);
             error_str += " not recognized";
@@ -733,13 +845,232 @@ double Tidal :: computeProductionkW(
         }
     }
     
-    return production_kW;
+    return production;
+}   /* computeNormalizedProduction() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Tidal :: computeProductionkW(
+///         int timestep,
+///         double dt_hrs,
+///         double tidal_resource_ms
+///     )
+///
+/// \brief Method which takes in the tidal resource at a particular point in time, and
+///     then returns the tidal turbine production at that point in time.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \param dt_hrs The interval of time [hrs] associated with the timestep.
+///
+/// \param tidal_resource_ms Tidal resource (i.e. tidal stream speed) [m/s].
+///
+/// \return The production [kW] of the tidal turbine.
+///
+
+double Tidal :: computeProductionkW(
+    int timestep,
+    double dt_hrs,
+    double tidal_resource_ms
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        double production_kW = Production :: getProductionkW(timestep);
+        
+        return production_kW;
+    }
+    
+    // compute normalized production, then scale by capacity
+    double normalized_production = this->computeNormalizedProduction(
+        timestep,
+        dt_hrs,
+        tidal_resource_ms
+    );
+    
+    return this->scaleNormalizedProductionkW(normalized_production);
 }   /* computeProductionkW() */
 
 // ---------------------------------------------------------------------------------- //
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Tidal :: computeNormalizedProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* tidal_resource_vec_ms_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Method which takes in the tidal resource (i.e. tidal stream speed) [m/s]
+///     over a series of consecutive timesteps, and then writes the normalized
+///     production of the tidal turbine over that series. Equivalent to calling
+///     computeNormalizedProduction() at each timestep, but the power model is selected
+///     once, and then applied in a tight loop.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param tidal_resource_vec_ms_ptr A pointer to the resource over the series.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production over the series is written (resized to match, if need
+///     be).
+///
+
+void Tidal :: computeNormalizedProductionSeries(
+    int start_timestep,
+    std::vector<double>* tidal_resource_vec_ms_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    int n_timesteps = tidal_resource_vec_ms_ptr->size();
+    normalized_production_vec_ptr->resize(n_timesteps, 0);
+    
+    double* tidal_resource_ms_ptr = tidal_resource_vec_ms_ptr->data();
+    double* normalized_production_ptr = normalized_production_vec_ptr->data();
+    
+    switch (this->power_model) {
+        case (TidalPowerProductionModel :: TIDAL_POWER_CUBIC): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (tidal_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeCubicProduction(
+                    start_timestep + i,
+                    0,
+                    tidal_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        case (TidalPowerProductionModel :: TIDAL_POWER_EXPONENTIAL): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (tidal_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeExponentialProduction(
+                    start_timestep + i,
+                    0,
+                    tidal_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        case (TidalPowerProductionModel :: TIDAL_POWER_LOOKUP): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (tidal_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeLookupProduction(
+                    start_timestep + i,
+                    0,
+                    tidal_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  ";
+            error_str += "Tidal::computeNormalizedProductionSeries():  ";
+            error_str += "power model ";
+            error_str += std::to_string(this->power_model);
+            error_str += " not recognized";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::runtime_error(error_str);
+            
+            break;
+        }
+    }
+    
+    return;
+}   /* computeNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Tidal :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* tidal_resource_vec_ms_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in the tidal resource (i.e. tidal stream speed) [m/s]
+///     over a series of consecutive timesteps, and then writes the production of the
+///     tidal turbine over that series. Gives exactly the same production as calling
+///     computeProductionkW() at each timestep.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param tidal_resource_vec_ms_ptr A pointer to the resource over the series.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Tidal :: computeProductionSeries(
+    int start_timestep,
+    std::vector<double>* tidal_resource_vec_ms_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        int n_timesteps = tidal_resource_vec_ms_ptr->size();
+        production_vec_kW_ptr->resize(n_timesteps, 0);
+        
+        for (int i = 0; i < n_timesteps; i++) {
+            (*production_vec_kW_ptr)[i] =
+                Production :: getProductionkW(start_timestep + i);
+        }
+        
+        return;
+    }
+    
+    // compute normalized production series, then scale by capacity
+    this->computeNormalizedProductionSeries(
+        start_timestep,
+        tidal_resource_vec_ms_ptr,
+        production_vec_kW_ptr
+    );
+    
+    this->scaleNormalizedProductionSeries(production_vec_kW_ptr, production_vec_kW_ptr);
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
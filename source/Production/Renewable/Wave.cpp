@@ -102,7 +102,26 @@ void Wave :: __checkInputs(WaveInputs wave_inputs)
         throw std::invalid_argument(error_str);
     }
     
-    //  4. check firmness_factor
+    //  4. if using the sea state memo, check resolution
+    if (
+        wave_inputs.use_sea_state_memo and
+        (
+            wave_inputs.memo_resolution_significant_wave_height_m <= 0 or
+            wave_inputs.memo_resolution_energy_period_s <= 0
+        )
+    ) {
+        std::string error_str = "ERROR:  Wave():  ";
+        error_str += "WaveInputs::memo_resolution_significant_wave_height_m and ";
+        error_str += "WaveInputs::memo_resolution_energy_period_s must be > 0";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  5. check firmness_factor
     if (
         wave_inputs.firmness_factor < 0 or
         wave_inputs.firmness_factor > 1
@@ -181,7 +200,245 @@ double Wave :: __getGenericOpMaintCost(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wave:: __computeGaussianProductionkW(
+/// \fn void Wave :: __initSeaStateMemo(WaveInputs wave_inputs)
+///
+/// \brief Helper method to borrow (or build) the quantized sea state memo for the
+///     normalized performance matrix. The memo is a direct indexed grid over the domain
+///     of the matrix, at the given resource resolution, and is shared (via the
+///     DataCache) by every Wave asset using the same matrix and resolution.
+///
+/// \param wave_inputs A structure of Wave constructor inputs.
+///
+
+void Wave :: __initSeaStateMemo(WaveInputs wave_inputs)
+{
+    const InterpolatorStruct2D* matrix_ptr =
+        this->lookup_handle.interp_struct_2D_ptr;
+    
+    //  1. get memo grid (i.e., multiples of the resolution within the matrix domain)
+    double resolution_x = wave_inputs.memo_resolution_significant_wave_height_m;
+    double resolution_y = wave_inputs.memo_resolution_energy_period_s;
+    
+    int min_idx_x = int(ceil(matrix_ptr->min_x / resolution_x - 1e-9));
+    int max_idx_x = int(floor(matrix_ptr->max_x / resolution_x + 1e-9));
+    
+    int min_idx_y = int(ceil(matrix_ptr->min_y / resolution_y - 1e-9));
+    int max_idx_y = int(floor(matrix_ptr->max_y / resolution_y + 1e-9));
+    
+    int n_x = std::max(max_idx_x - min_idx_x + 1, 0);
+    int n_y = std::max(max_idx_y - min_idx_y + 1, 0);
+    
+    //  2. check memo size
+    if (double(n_x) * double(n_y) > WAVE_SEA_STATE_MEMO_MAX_CELLS) {
+        std::string error_str = "ERROR:  Wave():  ";
+        error_str += "the sea state memo resolution is too fine for the domain of the ";
+        error_str += "normalized performance matrix (the memo would exceed ";
+        error_str += std::to_string(WAVE_SEA_STATE_MEMO_MAX_CELLS);
+        error_str += " cells)";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. borrow (or build) memo
+    this->sea_state_memo_ptr = DataCache::getSeaStateMemo(
+        this->__getSeaStateMemoKey(resolution_x, resolution_y),
+        [resolution_x, resolution_y, min_idx_x, min_idx_y, n_x, n_y]() {
+            SeaStateMemoData memo;
+            
+            memo.resolution_x = resolution_x;
+            memo.resolution_y = resolution_y;
+            
+            memo.inv_resolution_x = 1 / resolution_x;
+            memo.inv_resolution_y = 1 / resolution_y;
+            
+            memo.min_idx_x = min_idx_x;
+            memo.min_idx_y = min_idx_y;
+            
+            memo.n_x = n_x;
+            memo.n_y = n_y;
+            
+            memo.value_vec = std::vector<std::atomic<double>>(n_x * n_y);
+            
+            for (size_t i = 0; i < memo.value_vec.size(); i++) {
+                memo.value_vec[i].store(
+                    std::numeric_limits<double>::quiet_NaN(),
+                    std::memory_order_relaxed
+                );
+            }
+            
+            return memo;
+        }
+    );
+    
+    return;
+}   /* __initSeaStateMemo() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string Wave :: __getSeaStateMemoKey(
+///         double resolution_x,
+///         double resolution_y
+///     )
+///
+/// \brief Helper method to construct the DataCache key of the sea state memo. The key
+///     encodes the resolution and the full content of the normalized performance
+///     matrix, so that assets share a memo if and only if they would fill it alike.
+///
+/// \param resolution_x The memo resolution of the significant wave height [m].
+///
+/// \param resolution_y The memo resolution of the energy period [s].
+///
+/// \return The DataCache key of the sea state memo.
+///
+
+std::string Wave :: __getSeaStateMemoKey(double resolution_x, double resolution_y)
+{
+    const InterpolatorStruct2D* matrix_ptr =
+        this->lookup_handle.interp_struct_2D_ptr;
+    
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "Wave::sea_state_memo";
+    key_stream << "::" << resolution_x << "," << resolution_y;
+    
+    key_stream << "::";
+    for (int j = 0; j < matrix_ptr->n_cols; j++) {
+        key_stream << matrix_ptr->x_vec[j] << ",";
+    }
+    
+    key_stream << "::";
+    for (int i = 0; i < matrix_ptr->n_rows; i++) {
+        key_stream << matrix_ptr->y_vec[i] << ",";
+    }
+    
+    key_stream << "::";
+    for (size_t i = 0; i < matrix_ptr->z_vec.size(); i++) {
+        key_stream << matrix_ptr->z_vec[i] << ",";
+    }
+    
+    return key_stream.str();
+}   /* __getSeaStateMemoKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wave :: __getMemoizedNormalizedProduction(
+///         double significant_wave_height_m,
+///         double energy_period_s
+///     )
+///
+/// \brief Helper method to look up normalized production in the shared sea state memo.
+///     The sea state is quantized to the memo resolution; on a miss, the performance
+///     matrix is interpolated at the quantized sea state and the result is memoized.
+///     Sea states outside of the performance matrix are interpolated directly (before
+///     quantization, so that the bounds policy of the matrix always applies).
+///
+/// \param significant_wave_height_m The significant wave height [m].
+///
+/// \param energy_period_s The energy period [s].
+///
+/// \return The normalized production of the wave energy converter.
+///
+
+double Wave :: __getMemoizedNormalizedProduction(
+    double significant_wave_height_m,
+    double energy_period_s
+)
+{
+    SeaStateMemoData* memo_ptr = this->sea_state_memo_ptr.get();
+    
+    const InterpolatorStruct2D* matrix_ptr =
+        this->lookup_handle.interp_struct_2D_ptr;
+    
+    //  1. if outside of performance matrix (or memo), interpolate directly
+    long idx_x = 0;
+    long idx_y = 0;
+    
+    bool in_matrix =
+        significant_wave_height_m >= matrix_ptr->min_x and
+        significant_wave_height_m <= matrix_ptr->max_x and
+        energy_period_s >= matrix_ptr->min_y and
+        energy_period_s <= matrix_ptr->max_y;
+    
+    if (in_matrix) {
+        idx_x = std::lround(significant_wave_height_m * memo_ptr->inv_resolution_x) -
+            memo_ptr->min_idx_x;
+        idx_y = std::lround(energy_period_s * memo_ptr->inv_resolution_y) -
+            memo_ptr->min_idx_y;
+    }
+    
+    if (
+        not in_matrix or
+        idx_x < 0 or
+        idx_x >= memo_ptr->n_x or
+        idx_y < 0 or
+        idx_y >= memo_ptr->n_y
+    ) {
+        return this->interpolator.interp2D(
+            this->lookup_handle,
+            significant_wave_height_m,
+            energy_period_s,
+            &(this->lookup_cursor)
+        );
+    }
+    
+    //  2. serve from memo (or interpolate at quantized sea state and fill)
+    std::atomic<double>& memo_value = memo_ptr->value_vec[idx_y * memo_ptr->n_x + idx_x];
+    
+    double normalized_production = memo_value.load(std::memory_order_relaxed);
+    
+    if (std::isnan(normalized_production)) {
+        double quantized_x = std::min(
+            std::max(
+                (idx_x + memo_ptr->min_idx_x) * memo_ptr->resolution_x,
+                matrix_ptr->min_x
+            ),
+            matrix_ptr->max_x
+        );
+        
+        double quantized_y = std::min(
+            std::max(
+                (idx_y + memo_ptr->min_idx_y) * memo_ptr->resolution_y,
+                matrix_ptr->min_y
+            ),
+            matrix_ptr->max_y
+        );
+        
+        normalized_production = this->interpolator.interp2D(
+            this->lookup_handle,
+            quantized_x,
+            quantized_y,
+            &(this->lookup_cursor)
+        );
+        
+        memo_value.store(normalized_production, std::memory_order_relaxed);
+    }
+    
+    return normalized_production;
+}   /* __getMemoizedNormalizedProduction() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wave:: __computeGaussianProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double significant_wave_height_m,
@@ -203,11 +460,11 @@ double Wave :: __getGenericOpMaintCost(void)
 /// \param energy_period_s The energy period [s] in the vicinity of the wave energy
 ///     converter
 ///
-/// \return The production [kW] of the wave energy converter, under an exponential
+/// \return The normalized production of the wave energy converter, under an exponential
 ///     model.
 ///
 
-double Wave:: __computeGaussianProductionkW(
+double Wave:: __computeGaussianProduction(
     int timestep,
     double dt_hrs,
     double significant_wave_height_m,
@@ -222,14 +479,14 @@ double Wave:: __computeGaussianProductionkW(
         (energy_period_s - this->design_energy_period_s) / 
         this->design_energy_period_s;
         
-    double production = exp(
-        -2.25119 * pow(T_e_nondim, 2) +
+    double exponent = -2.25119 * pow(T_e_nondim, 2) +
         3.44570 * T_e_nondim * H_s_nondim -
-        4.01508 * pow(H_s_nondim, 2)
-    );
+        4.01508 * pow(H_s_nondim, 2);
     
-    return production * this->capacity_kW;
-}   /* __computeGaussianProductionkW() */
+    double production = this->fast_kernels ? FastMath::exp(exponent) : exp(exponent);
+    
+    return production;
+}   /* __computeGaussianProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -238,7 +495,7 @@ double Wave:: __computeGaussianProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wave:: __computeParaboloidProductionkW(
+/// \fn double Wave:: __computeParaboloidProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double significant_wave_height_m,
@@ -260,11 +517,11 @@ double Wave:: __computeGaussianProductionkW(
 /// \param energy_period_s The energy period [s] in the vicinity of the wave energy
 ///     converter
 ///
-/// \return The production [kW] of the wave energy converter, under a paraboloid
+/// \return The normalized production of the wave energy converter, under a paraboloid
 ///     model.
 ///
 
-double Wave:: __computeParaboloidProductionkW(
+double Wave:: __computeParaboloidProduction(
     int timestep,
     double dt_hrs,
     double significant_wave_height_m,
@@ -291,8 +548,8 @@ double Wave:: __computeParaboloidProductionkW(
         production = 1;
     }
     
-    return production * this->capacity_kW;
-}   /* __computeParaboloidProductionkW() */
+    return production;
+}   /* __computeParaboloidProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -301,7 +558,7 @@ double Wave:: __computeParaboloidProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wave:: __computeLookupProductionkW(
+/// \fn double Wave:: __computeLookupProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double significant_wave_height_m,
@@ -321,24 +578,36 @@ double Wave:: __computeParaboloidProductionkW(
 /// \param energy_period_s The energy period [s] in the vicinity of the wave energy
 ///     converter
 ///
-/// \return The interpolated production [kW] of the wave energy converter.
+/// \return The interpolated normalized production of the wave energy converter.
 ///
 
-double Wave:: __computeLookupProductionkW(
+double Wave:: __computeLookupProduction(
     int timestep,
     double dt_hrs,
     double significant_wave_height_m,
     double energy_period_s
 )
 {
-    double prod = this->interpolator.interp2D(
-        0,
-        significant_wave_height_m,
-        energy_period_s
-    );
+    double prod = 0;
+    
+    if (this->sea_state_memo_ptr != nullptr) {
+        prod = this->__getMemoizedNormalizedProduction(
+            significant_wave_height_m,
+            energy_period_s
+        );
+    }
     
-    return prod * this->capacity_kW;
-}   /* __computeLookupProductionkW() */
+    else {
+        prod = this->interpolator.interp2D(
+            this->lookup_handle,
+            significant_wave_height_m,
+            energy_period_s,
+            &(this->lookup_cursor)
+        );
+    }
+    
+    return prod;
+}   /* __computeLookupProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -347,20 +616,28 @@ double Wave:: __computeLookupProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Wave :: __writeSummary(std::string write_path)
+/// \fn void Wave :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Wave.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Wave :: __writeSummary(std::string write_path)
+void Wave :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write summary results (markdown)
     ofs << "# ";
@@ -425,6 +702,14 @@ void Wave :: __writeSummary(std::string write_path)
             ofs << "Normalized Performance Matrix: "
                 << this->interpolator.path_map_2D[0] << "  \n";
             
+            ofs << "Sea State Memo (N = 0 / Y = 1): " << this->use_sea_state_memo
+                << "  \n";
+            if (this->use_sea_state_memo) {
+                ofs << "Sea State Memo Resolution: "
+                    << this->sea_state_memo_ptr->resolution_x << " m, "
+                    << this->sea_state_memo_ptr->resolution_y << " s  \n";
+            }
+            
             break;
         }
         
@@ -456,7 +741,7 @@ void Wave :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     
     return;
 }   /* __writeSummary() */
@@ -473,7 +758,8 @@ void Wave :: __writeSummary(std::string write_path)
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
 ///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Wave.
@@ -489,19 +775,22 @@ void Wave :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Wave :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
     std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -537,6 +826,8 @@ void Wave :: __writeTimeSeries(
         ofs << "\n";
     }
     
+    results_manifest_ptr->writeFile(write_path, ofs.str());
+    
     return;
 }   /* __writeTimeSeries() */
 
@@ -614,6 +905,7 @@ Renewable(
     this->design_energy_period_s = wave_inputs.design_energy_period_s;
     
     this->power_model = wave_inputs.power_model;
+    this->use_sea_state_memo = false;
     
     switch (this->power_model) {
         case (WavePowerProductionModel :: WAVE_POWER_GAUSSIAN): {
@@ -631,11 +923,16 @@ Renewable(
         case (WavePowerProductionModel :: WAVE_POWER_LOOKUP): {
             this->power_model_string = "LOOKUP";
             
-            this->interpolator.addData2D(
+            this->lookup_handle = this->interpolator.borrowData2D(
                 0,
                 wave_inputs.path_2_normalized_performance_matrix
             );
             
+            if (wave_inputs.use_sea_state_memo) {
+                this->__initSeaStateMemo(wave_inputs);
+                this->use_sea_state_memo = true;
+            }
+            
             break;
         }
         
@@ -715,7 +1012,58 @@ void Wave :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wave :: computeProductionkW(
+/// \fn std::string Wave :: getNormalizedResponseKey(void)
+///
+/// \brief Method which constructs a key that identifies the normalized response of the
+///     wave energy converter (i.e., the resource it sees and everything which shapes
+///     its performance, but not its size). Assets with equal keys produce identical
+///     normalized production, so the Controller evaluates it once for all of them.
+///     Returns an empty key if a production time series override was given.
+///
+/// \return A key which identifies the normalized response of the wave energy
+///     converter.
+///
+
+std::string Wave :: getNormalizedResponseKey(void)
+{
+    if (this->normalized_production_series_given) {
+        return "";
+    }
+    
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "Wave::normalized_response";
+    key_stream << "::" << this->resource_key;
+    key_stream << "::" << this->power_model;
+    key_stream << "::" << this->fast_kernels;
+    key_stream << "::" << this->design_significant_wave_height_m;
+    key_stream << "," << this->design_energy_period_s;
+    
+    if (this->power_model == WavePowerProductionModel :: WAVE_POWER_LOOKUP) {
+        //  the memo quantizes the sea state, so memoized and direct lookups differ
+        double resolution_x = 0;
+        double resolution_y = 0;
+        
+        if (this->sea_state_memo_ptr != nullptr) {
+            resolution_x = this->sea_state_memo_ptr->resolution_x;
+            resolution_y = this->sea_state_memo_ptr->resolution_y;
+        }
+        
+        key_stream << "::" << this->__getSeaStateMemoKey(resolution_x, resolution_y);
+    }
+    
+    return key_stream.str();
+}   /* getNormalizedResponseKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wave :: computeNormalizedProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double significant_wave_height_m,
@@ -723,7 +1071,8 @@ void Wave :: handleReplacement(int timestep)
 ///     )
 ///
 /// \brief Method which takes in the wave resource at a particular point in time, and
-///     then returns the wave turbine production at that point in time.
+///     then returns the normalized production (i.e., production per unit of capacity)
+///     of the wave turbine at that point in time.
 ///
 /// \param timestep The timestep (i.e., time series index) for the request.
 ///
@@ -733,34 +1082,27 @@ void Wave :: handleReplacement(int timestep)
 ///
 /// \param energy_period_s The energy period (wave statistic) [s].
 ///
-/// \return The production [kW] of the wave turbine.
+/// \return The normalized production of the wave turbine.
 ///
 
-double Wave :: computeProductionkW(
+double Wave :: computeNormalizedProduction(
     int timestep,
     double dt_hrs,
     double significant_wave_height_m,
     double energy_period_s
 )
 {
-    //  given production time series override
-    if (this->normalized_production_series_given) {
-        double production_kW = Production :: getProductionkW(timestep);
-        
-        return production_kW;
-    }
-    
     // check if no resource
     if (significant_wave_height_m <= 0 or energy_period_s <= 0) {
         return 0;
     }
     
-    // compute production
-    double production_kW = 0;
+    // compute normalized production
+    double production = 0;
     
     switch (this->power_model) {
         case (WavePowerProductionModel :: WAVE_POWER_PARABOLOID): {
-            production_kW = this->__computeParaboloidProductionkW(
+            production = this->__computeParaboloidProduction(
                 timestep,
                 dt_hrs,
                 significant_wave_height_m,
@@ -771,7 +1113,7 @@ double Wave :: computeProductionkW(
         }
         
         case (WavePowerProductionModel :: WAVE_POWER_GAUSSIAN): {
-            production_kW = this->__computeGaussianProductionkW(
+            production = this->__computeGaussianProduction(
                 timestep,
                 dt_hrs,
                 significant_wave_height_m,
@@ -782,7 +1124,7 @@ double Wave :: computeProductionkW(
         }
         
         case (WavePowerProductionModel :: WAVE_POWER_LOOKUP): {
-            production_kW = this->__computeLookupProductionkW(
+            production = this->__computeLookupProduction(
                 timestep,
                 dt_hrs,
                 significant_wave_height_m,
@@ -793,7 +1135,7 @@ double Wave :: computeProductionkW(
         }
         
         default: {
-            std::string error_str = "ERROR:  Wave::computeProductionkW():  ";
+            std::string error_str = "ERROR:  Wave::computeNormalizedProduction():  ";
             error_str += "power model ";
             error_str += std::to_string(this->power_model);
             error_str += " not recognized";
@@ -808,13 +1150,248 @@ double Wave :: computeProductionkW(
         }
     }
     
-    return production_kW;
+    return production;
+}   /* computeNormalizedProduction() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wave :: computeProductionkW(
+///         int timestep,
+///         double dt_hrs,
+///         double significant_wave_height_m,
+///         double energy_period_s
+///     )
+///
+/// \brief Method which takes in the wave resource at a particular point in time, and
+///     then returns the wave turbine production at that point in time.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \param dt_hrs The interval of time [hrs] associated with the timestep.
+///
+/// \param signficiant_wave_height_m The significant wave height (wave statistic) [m].
+///
+/// \param energy_period_s The energy period (wave statistic) [s].
+///
+/// \return The production [kW] of the wave turbine.
+///
+
+double Wave :: computeProductionkW(
+    int timestep,
+    double dt_hrs,
+    double significant_wave_height_m,
+    double energy_period_s
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        double production_kW = Production :: getProductionkW(timestep);
+        
+        return production_kW;
+    }
+    
+    // compute normalized production, then scale by capacity
+    double normalized_production = this->computeNormalizedProduction(
+        timestep,
+        dt_hrs,
+        significant_wave_height_m,
+        energy_period_s
+    );
+    
+    return this->scaleNormalizedProductionkW(normalized_production);
 }   /* computeProductionkW() */
 
 // ---------------------------------------------------------------------------------- //
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wave :: computeNormalizedProductionSeries(
+///         int start_timestep,
+///         std::vector<std::vector<double>>* wave_resource_vec_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Method which takes in the wave resource (i.e. significant wave height [m] and energy period [s])
+///     over a series of consecutive timesteps, and then writes the normalized
+///     production of the wave energy converter over that series. Equivalent to calling
+///     computeNormalizedProduction() at each timestep, but the power model is selected
+///     once, and then applied in a tight loop.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param wave_resource_vec_ptr A pointer to the resource over the series.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production over the series is written (resized to match, if need
+///     be).
+///
+
+void Wave :: computeNormalizedProductionSeries(
+    int start_timestep,
+    std::vector<std::vector<double>>* wave_resource_vec_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    int n_timesteps = wave_resource_vec_ptr->size();
+    normalized_production_vec_ptr->resize(n_timesteps, 0);
+    
+    double* normalized_production_ptr = normalized_production_vec_ptr->data();
+    
+    switch (this->power_model) {
+        case (WavePowerProductionModel :: WAVE_POWER_PARABOLOID): {
+            for (int i = 0; i < n_timesteps; i++) {
+                double significant_wave_height_m = (*wave_resource_vec_ptr)[i][0];
+                double energy_period_s = (*wave_resource_vec_ptr)[i][1];
+                
+                if (significant_wave_height_m <= 0 or energy_period_s <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeParaboloidProduction(
+                    start_timestep + i,
+                    0,
+                    significant_wave_height_m,
+                    energy_period_s
+                );
+            }
+            
+            break;
+        }
+        
+        case (WavePowerProductionModel :: WAVE_POWER_GAUSSIAN): {
+            for (int i = 0; i < n_timesteps; i++) {
+                double significant_wave_height_m = (*wave_resource_vec_ptr)[i][0];
+                double energy_period_s = (*wave_resource_vec_ptr)[i][1];
+                
+                if (significant_wave_height_m <= 0 or energy_period_s <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeGaussianProduction(
+                    start_timestep + i,
+                    0,
+                    significant_wave_height_m,
+                    energy_period_s
+                );
+            }
+            
+            break;
+        }
+        
+        case (WavePowerProductionModel :: WAVE_POWER_LOOKUP): {
+            for (int i = 0; i < n_timesteps; i++) {
+                double significant_wave_height_m = (*wave_resource_vec_ptr)[i][0];
+                double energy_period_s = (*wave_resource_vec_ptr)[i][1];
+                
+                if (significant_wave_height_m <= 0 or energy_period_s <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeLookupProduction(
+                    start_timestep + i,
+                    0,
+                    significant_wave_height_m,
+                    energy_period_s
+                );
+            }
+            
+            break;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  ";
+            error_str += "Wave::computeNormalizedProductionSeries():  ";
+            error_str += "power model ";
+            error_str += std::to_string(this->power_model);
+            error_str += " not recognized";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::runtime_error(error_str);
+            
+            break;
+        }
+    }
+    
+    return;
+}   /* computeNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wave :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<std::vector<double>>* wave_resource_vec_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in the wave resource (i.e. significant wave height [m] and energy period [s])
+///     over a series of consecutive timesteps, and then writes the production of the
+///     wave energy converter over that series. Gives exactly the same production as calling
+///     computeProductionkW() at each timestep.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param wave_resource_vec_ptr A pointer to the resource over the series.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Wave :: computeProductionSeries(
+    int start_timestep,
+    std::vector<std::vector<double>>* wave_resource_vec_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        int n_timesteps = wave_resource_vec_ptr->size();
+        production_vec_kW_ptr->resize(n_timesteps, 0);
+        
+        for (int i = 0; i < n_timesteps; i++) {
+            (*production_vec_kW_ptr)[i] =
+                Production :: getProductionkW(start_timestep + i);
+        }
+        
+        return;
+    }
+    
+    // compute normalized production series, then scale by capacity
+    this->computeNormalizedProductionSeries(
+        start_timestep,
+        wave_resource_vec_ptr,
+        production_vec_kW_ptr
+    );
+    
+    this->scaleNormalizedProductionSeries(production_vec_kW_ptr, production_vec_kW_ptr);
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -84,7 +84,83 @@ void Wind :: __checkInputs(WindInputs wind_inputs)
         std::cout << warning_str << std::endl;
     }
     
-    //  2. check firmness_factor
+    //  2. if WIND_POWER_LOOKUP, check that path is given
+    if (
+        wind_inputs.power_model == WindPowerProductionModel :: WIND_POWER_LOOKUP and
+        wind_inputs.path_2_normalized_power_curve.empty()
+    ) {
+        std::string error_str = "ERROR:  Wind()  power model was set to ";
+        error_str += "WindPowerProductionModel::WIND_POWER_LOOKUP, but no path to a ";
+        error_str += "normalized power curve was given";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. check power curve resample points
+    if (
+        wind_inputs.power_curve_resample_points < 0 or
+        wind_inputs.power_curve_resample_points == 1
+    ) {
+        std::string error_str = "ERROR:  Wind():  ";
+        error_str += "WindInputs::power_curve_resample_points must be 0 (automatic), or ";
+        error_str += ">= 2";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  4. check wind farm
+    if (wind_inputs.n_turbines < 1) {
+        std::string error_str = "ERROR:  Wind():  ";
+        error_str += "WindInputs::n_turbines must be >= 1";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    if (
+        not wind_inputs.turbine_factor_vec.empty() and
+        (int)wind_inputs.turbine_factor_vec.size() != wind_inputs.n_turbines
+    ) {
+        std::string error_str = "ERROR:  Wind():  ";
+        error_str += "WindInputs::turbine_factor_vec must be empty, or of length ";
+        error_str += "WindInputs::n_turbines";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    for (size_t i = 0; i < wind_inputs.turbine_factor_vec.size(); i++) {
+        if (
+            wind_inputs.turbine_factor_vec[i] < 0 or
+            wind_inputs.turbine_factor_vec[i] > 1
+        ) {
+            std::string error_str = "ERROR:  Wind():  ";
+            error_str += "WindInputs::turbine_factor_vec values must be in the closed ";
+            error_str += "interval [0, 1]";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::invalid_argument(error_str);
+        }
+    }
+    
+    //  5. check firmness_factor
     if (
         wind_inputs.firmness_factor < 0 or
         wind_inputs.firmness_factor > 1
@@ -116,14 +192,15 @@ void Wind :: __checkInputs(WindInputs wind_inputs)
 ///
 /// This model was obtained by way of surveying an assortment of published wind
 /// turbine costs, and then constructing a best fit model. Note that this model
-/// expresses cost in terms of Canadian dollars [CAD].
+/// expresses cost in terms of Canadian dollars [CAD]. For a wind farm, the cost per kW
+/// is that of a single turbine.
 ///
-/// \return A generic capital cost for the wind turbine [CAD].
+/// \return A generic capital cost for the wind turbine (or farm) [CAD].
 ///
 
 double Wind :: __getGenericCapitalCost(void)
 {
-    double capital_cost_per_kW = 3000 * pow(this->capacity_kW, -0.15) + 3000;
+    double capital_cost_per_kW = 3000 * pow(this->turbine_capacity_kW, -0.15) + 3000;
     
     return capital_cost_per_kW * this->capacity_kW;
 }   /* __getGenericCapitalCost() */
@@ -142,15 +219,17 @@ double Wind :: __getGenericCapitalCost(void)
 ///
 /// This model was obtained by way of surveying an assortment of published wind
 /// turbine costs, and then constructing a best fit model. Note that this model
-/// expresses cost in terms of Canadian dollars [CAD/kWh].
+/// expresses cost in terms of Canadian dollars [CAD/kWh]. For a wind farm, the cost is
+/// that of a single turbine.
 ///
 /// \return A generic operation and maintenance cost, per unit energy produced, for the
-///     wind turbine [CAD/kWh].
+///     wind turbine (or farm) [CAD/kWh].
 ///
 
 double Wind :: __getGenericOpMaintCost(void)
 {
-    double operation_maintenance_cost_kWh = 0.025 * pow(this->capacity_kW, -0.2) + 0.025;
+    double operation_maintenance_cost_kWh =
+        0.025 * pow(this->turbine_capacity_kW, -0.2) + 0.025;
     
     return operation_maintenance_cost_kWh;
 }   /* __getGenericOpMaintCost() */
@@ -162,7 +241,7 @@ double Wind :: __getGenericOpMaintCost(void)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wind :: __computeCubicProductionkW(
+/// \fn double Wind :: __computeCubicProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double wind_resource_ms
@@ -180,10 +259,10 @@ double Wind :: __getGenericOpMaintCost(void)
 ///
 /// \param wind_resource_ms The available wind resource [m/s].
 ///
-/// \return The production [kW] of the wind turbine, under an exponential model.
+/// \return The normalized production of the wind turbine, under an exponential model.
 ///
 
-double Wind :: __computeCubicProductionkW(
+double Wind :: __computeCubicProduction(
     int timestep,
     double dt_hrs,
     double wind_resource_ms
@@ -206,8 +285,8 @@ double Wind :: __computeCubicProductionkW(
         production = 1;
     }
     
-    return production * this->capacity_kW;
-}   /* __computeCubicProductionkW() */
+    return production;
+}   /* __computeCubicProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -216,7 +295,7 @@ double Wind :: __computeCubicProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wind :: __computeExponentialProductionkW(
+/// \fn double Wind :: __computeExponentialProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double wind_resource_ms
@@ -233,10 +312,10 @@ double Wind :: __computeCubicProductionkW(
 ///
 /// \param wind_resource_ms The available wind resource [m/s].
 ///
-/// \return The production [kW] of the wind turbine, under an exponential model.
+/// \return The normalized production of the wind turbine, under an exponential model.
 ///
 
-double Wind :: __computeExponentialProductionkW(
+double Wind :: __computeExponentialProduction(
     int timestep,
     double dt_hrs,
     double wind_resource_ms
@@ -252,15 +331,21 @@ double Wind :: __computeExponentialProductionkW(
     }
     
     else if (turbine_speed >= -0.76 and turbine_speed <= 0) {
-        production = 1.03273 * exp(-5.97588 * pow(turbine_speed, 2)) - 0.03273;
+        double exponent = -5.97588 * pow(turbine_speed, 2);
+        
+        production = 1.03273 *
+            (this->fast_kernels ? FastMath::exp(exponent) : exp(exponent)) - 0.03273;
     }
     
     else {
-        production = 0.16154 * exp(-9.30254 * pow(turbine_speed, 2)) + 0.83846;
+        double exponent = -9.30254 * pow(turbine_speed, 2);
+        
+        production = 0.16154 *
+            (this->fast_kernels ? FastMath::exp(exponent) : exp(exponent)) + 0.83846;
     }
     
-    return production * this->capacity_kW;
-}   /* __computeExponentialProductionkW() */
+    return production;
+}   /* __computeExponentialProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -269,14 +354,15 @@ double Wind :: __computeExponentialProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wind :: __computeLookupProductionkW(
+/// \fn double Wind :: __computeLookupProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double wind_resource_ms
 ///     )
 ///
 /// \brief Helper method to compute wind turbine production by way of looking up using
-///     given power curve data.
+///     the given (pre-sampled) normalized power curve. Outside of the curve (i.e.,
+///     below cut-in or above cut-out), production is zero.
 ///
 /// \param timestep The current time step of the Model run.
 ///
@@ -284,19 +370,33 @@ double Wind :: __computeExponentialProductionkW(
 ///
 /// \param wind_resource_ms The available wind resource [m/s].
 ///
-/// \return The interpolated production [kW] of the wind turbine.
+/// \return The interpolated normalized production of the wind turbine.
 ///
 
-double Wind :: __computeLookupProductionkW(
+double Wind :: __computeLookupProduction(
     int timestep,
     double dt_hrs,
     double wind_resource_ms
 )
 {
-    // *** WORK IN PROGRESS *** //
+    const InterpolatorStruct1D* power_curve_ptr =
+        this->power_curve_handle.interp_struct_1D_ptr;
+    
+    // outside of the given power curve (i.e., below cut-in or above cut-out)
+    if (
+        wind_resource_ms < power_curve_ptr->min_x or
+        wind_resource_ms > power_curve_ptr->max_x
+    ) {
+        return 0;
+    }
+    
+    double production = this->interpolator.interp1DUnchecked(
+        this->power_curve_handle,
+        wind_resource_ms
+    );
     
-    return 0;
-}   /* __computeLookupProductionkW() */
+    return production;
+}   /* __computeLookupProduction() */
 
 // ---------------------------------------------------------------------------------- //
 
@@ -305,20 +405,28 @@ double Wind :: __computeLookupProductionkW(
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void Wind :: __writeSummary(std::string write_path)
+/// \fn void Wind :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for Wind.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void Wind :: __writeSummary(std::string write_path)
+void Wind :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write summary results (markdown)
     ofs << "# ";
@@ -369,6 +477,11 @@ void Wind :: __writeSummary(std::string write_path)
     ofs << "## Wind Attributes\n";
     ofs << "\n";
     
+    ofs << "Turbines: " << this->n_turbines << "  \n";
+    ofs << "Turbine Capacity: " << this->turbine_capacity_kW << " kW  \n";
+    ofs << "Mean Turbine Factor: " << this->mean_turbine_factor << "  \n";
+    ofs << "\n";
+    
     ofs << "Power Production Model: " << this->power_model_string << "  \n";
     switch (this->power_model) {
         case (WindPowerProductionModel :: WIND_POWER_CUBIC): {
@@ -384,7 +497,12 @@ void Wind :: __writeSummary(std::string write_path)
         }
         
         case (WindPowerProductionModel :: WIND_POWER_LOOKUP): {
-            //...
+            ofs << "Normalized Power Curve: "
+                << this->interpolator.path_map_1D[
+                    RenewableInterpKeys :: POWER_CURVE_INTERP_KEY
+                ] << "  \n";
+            ofs << "Power Curve Resample Points: "
+                << this->power_curve_resample_points << "  \n";
             
             break;
         }
@@ -417,7 +535,7 @@ void Wind :: __writeSummary(std::string write_path)
     
     ofs << "\n--------\n\n";
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     
     return;
 }   /* __writeSummary() */
@@ -434,7 +552,8 @@ void Wind :: __writeSummary(std::string write_path)
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         std::map<int, std::vector<double>>* resource_map_1D_ptr,
 ///         std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for Wind.
@@ -450,19 +569,22 @@ void Wind :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void Wind :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     std::map<int, std::vector<double>>* resource_map_1D_ptr,
     std::map<int, std::vector<std::vector<double>>>* resource_map_2D_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -495,6 +617,8 @@ void Wind :: __writeTimeSeries(
         ofs << "\n";
     }
     
+    results_manifest_ptr->writeFile(write_path, ofs.str());
+    
     return;
 }   /* __writeTimeSeries() */
 
@@ -569,6 +693,23 @@ Renewable(
     
     this->design_speed_ms = wind_inputs.design_speed_ms;
     
+    this->n_turbines = wind_inputs.n_turbines;
+    this->turbine_capacity_kW = this->capacity_kW / this->n_turbines;
+    
+    this->turbine_factor_vec = wind_inputs.turbine_factor_vec;
+    
+    if (this->turbine_factor_vec.empty()) {
+        this->turbine_factor_vec.resize(this->n_turbines, 1);
+    }
+    
+    this->mean_turbine_factor = 0;
+    
+    for (int i = 0; i < this->n_turbines; i++) {
+        this->mean_turbine_factor += this->turbine_factor_vec[i];
+    }
+    
+    this->mean_turbine_factor /= this->n_turbines;
+    
     this->power_model = wind_inputs.power_model;
     
     switch (this->power_model) {
@@ -587,6 +728,11 @@ Renewable(
         case (WindPowerProductionModel :: WIND_POWER_LOOKUP): {
             this->power_model_string = "LOOKUP";
             
+            this->initPowerCurve(
+                wind_inputs.path_2_normalized_power_curve,
+                wind_inputs.power_curve_resample_points
+            );
+            
             break;
         }
         
@@ -666,14 +812,55 @@ void Wind :: handleReplacement(int timestep)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn double Wind :: computeProductionkW(
+/// \fn std::string Wind :: getNormalizedResponseKey(void)
+///
+/// \brief Method which constructs a key that identifies the normalized response of the
+///     wind turbine (i.e., the resource it sees and everything which shapes its power
+///     curve, but not its size). Assets with equal keys produce identical normalized
+///     production, so the Controller evaluates it once for all of them. Returns an
+///     empty key if a production time series override was given.
+///
+/// \return A key which identifies the normalized response of the wind turbine.
+///
+
+std::string Wind :: getNormalizedResponseKey(void)
+{
+    if (this->normalized_production_series_given) {
+        return "";
+    }
+    
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "Wind::normalized_response";
+    key_stream << "::" << this->resource_key;
+    key_stream << "::" << this->power_model;
+    key_stream << "::" << this->fast_kernels;
+    key_stream << "::" << this->design_speed_ms;
+    
+    if (this->power_model == WindPowerProductionModel :: WIND_POWER_LOOKUP) {
+        key_stream << "::" << this->power_curve_key;
+    }
+    
+    return key_stream.str();
+}   /* getNormalizedResponseKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wind :: computeNormalizedProduction(
 ///         int timestep,
 ///         double dt_hrs,
 ///         double wind_resource_ms
 ///     )
 ///
 /// \brief Method which takes in the wind resource at a particular point in time, and
-///     then returns the wind turbine production at that point in time.
+///     then returns the normalized production (i.e., production per unit of capacity)
+///     of the wind turbine at that point in time.
 ///
 /// \param timestep The timestep (i.e., time series index) for the request.
 ///
@@ -681,33 +868,26 @@ void Wind :: handleReplacement(int timestep)
 ///
 /// \param wind_resource_ms Wind resource (i.e. wind speed) [m/s].
 ///
-/// \return The production [kW] of the wind turbine.
+/// \return The normalized production of the wind turbine.
 ///
 
-double Wind :: computeProductionkW(
+double Wind :: computeNormalizedProduction(
     int timestep,
     double dt_hrs,
     double wind_resource_ms
 )
 {
-    //  given production time series override
-    if (this->normalized_production_series_given) {
-        double production_kW = Production :: getProductionkW(timestep);
-        
-        return production_kW;
-    }
-    
     // check if no resource
     if (wind_resource_ms <= 0) {
         return 0;
     }
     
-    // compute production
-    double production_kW = 0;
+    // compute normalized production
+    double production = 0;
     
     switch (this->power_model) {
         case (WindPowerProductionModel :: WIND_POWER_CUBIC): {
-            production_kW = this->__computeCubicProductionkW(
+            production = this->__computeCubicProduction(
                 timestep,
                 dt_hrs,
                 wind_resource_ms
@@ -717,7 +897,7 @@ double Wind :: computeProductionkW(
         }
         
         case (WindPowerProductionModel :: WIND_POWER_EXPONENTIAL): {
-            production_kW = this->__computeExponentialProductionkW(
+            production = this->__computeExponentialProduction(
                 timestep,
                 dt_hrs,
                 wind_resource_ms
@@ -727,7 +907,7 @@ double Wind :: computeProductionkW(
         }
         
         case (WindPowerProductionModel :: WIND_POWER_LOOKUP): {
-            production_kW = this->__computeLookupProductionkW(
+            production = this->__computeLookupProduction(
                 timestep,
                 dt_hrs,
                 wind_resource_ms
@@ -737,7 +917,7 @@ double Wind :: computeProductionkW(
         }
         
         default: {
-            std::string error_str = "ERROR:  Wind::computeProductionkW():  ";
+            std::string error_str = "ERROR:  Wind::computeNormalizedProduction():  ";
             error_str += "power model ";
             error_str += std::to_string(this->power_model);
             error_str += " not recognized";
@@ -752,13 +932,369 @@ double Wind :: computeProductionkW(
         }
     }
     
+    return production;
+}   /* computeNormalizedProduction() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wind :: scaleNormalizedProductionkW(double normalized_production)
+///
+/// \brief Method which scales a normalized production up to the production of the wind
+///     turbine (or farm), including the turbine factors (i.e., the power curve is
+///     evaluated once for the whole farm).
+///
+/// \param normalized_production The normalized production [ ].
+///
+/// \return The production [kW] of the wind turbine (or farm).
+///
+
+double Wind :: scaleNormalizedProductionkW(double normalized_production)
+{
+    double production_kW = normalized_production * this->capacity_kW;
+    
+    // apply turbine factors
+    production_kW *= this->mean_turbine_factor;
+    
     return production_kW;
+}   /* scaleNormalizedProductionkW() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wind :: computeProductionkW(
+///         int timestep,
+///         double dt_hrs,
+///         double wind_resource_ms
+///     )
+///
+/// \brief Method which takes in the wind resource at a particular point in time, and
+///     then returns the wind turbine production at that point in time.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \param dt_hrs The interval of time [hrs] associated with the timestep.
+///
+/// \param wind_resource_ms Wind resource (i.e. wind speed) [m/s].
+///
+/// \return The production [kW] of the wind turbine.
+///
+
+double Wind :: computeProductionkW(
+    int timestep,
+    double dt_hrs,
+    double wind_resource_ms
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        double production_kW = Production :: getProductionkW(timestep);
+        
+        return production_kW;
+    }
+    
+    // compute normalized production, then scale by capacity
+    double normalized_production = this->computeNormalizedProduction(
+        timestep,
+        dt_hrs,
+        wind_resource_ms
+    );
+    
+    return this->scaleNormalizedProductionkW(normalized_production);
 }   /* computeProductionkW() */
 
 // ---------------------------------------------------------------------------------- //
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wind :: computeNormalizedProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* wind_resource_vec_ms_ptr,
+///         std::vector<double>* normalized_production_vec_ptr
+///     )
+///
+/// \brief Method which takes in the wind resource (i.e. wind speed) [m/s]
+///     over a series of consecutive timesteps, and then writes the normalized
+///     production of the wind turbine over that series. Equivalent to calling
+///     computeNormalizedProduction() at each timestep, but the power model is selected
+///     once, and then applied in a tight loop.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param wind_resource_vec_ms_ptr A pointer to the resource over the series.
+///
+/// \param normalized_production_vec_ptr A pointer to the vector to which the
+///     normalized production over the series is written (resized to match, if need
+///     be).
+///
+
+void Wind :: computeNormalizedProductionSeries(
+    int start_timestep,
+    std::vector<double>* wind_resource_vec_ms_ptr,
+    std::vector<double>* normalized_production_vec_ptr
+)
+{
+    int n_timesteps = wind_resource_vec_ms_ptr->size();
+    normalized_production_vec_ptr->resize(n_timesteps, 0);
+    
+    double* wind_resource_ms_ptr = wind_resource_vec_ms_ptr->data();
+    double* normalized_production_ptr = normalized_production_vec_ptr->data();
+    
+    switch (this->power_model) {
+        case (WindPowerProductionModel :: WIND_POWER_CUBIC): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (wind_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeCubicProduction(
+                    start_timestep + i,
+                    0,
+                    wind_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        case (WindPowerProductionModel :: WIND_POWER_EXPONENTIAL): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (wind_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeExponentialProduction(
+                    start_timestep + i,
+                    0,
+                    wind_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        case (WindPowerProductionModel :: WIND_POWER_LOOKUP): {
+            for (int i = 0; i < n_timesteps; i++) {
+                if (wind_resource_ms_ptr[i] <= 0) {
+                    normalized_production_ptr[i] = 0;
+                    continue;
+                }
+                
+                normalized_production_ptr[i] = this->__computeLookupProduction(
+                    start_timestep + i,
+                    0,
+                    wind_resource_ms_ptr[i]
+                );
+            }
+            
+            break;
+        }
+        
+        default: {
+            std::string error_str = "ERROR:  ";
+            error_str += "Wind::computeNormalizedProductionSeries():  ";
+            error_str += "power model ";
+            error_str += std::to_string(this->power_model);
+            error_str += " not recognized";
+            
+            #ifdef _WIN32
+                std::cout << error_str << std::endl;
+            #endif
+
+            throw std::runtime_error(error_str);
+            
+            break;
+        }
+    }
+    
+    return;
+}   /* computeNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wind :: scaleNormalizedProductionSeries(
+///         std::vector<double>* normalized_production_vec_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which scales a normalized production series up to the production
+///     series of the wind turbine (or farm), including the turbine factors (see
+///     scaleNormalizedProductionkW()).
+///
+/// \param normalized_production_vec_ptr A pointer to the normalized production series.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     series is written (resized to match, if need be, and may be the same vector as
+///     the normalized production series).
+///
+
+void Wind :: scaleNormalizedProductionSeries(
+    std::vector<double>* normalized_production_vec_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    int n_timesteps = normalized_production_vec_ptr->size();
+    production_vec_kW_ptr->resize(n_timesteps, 0);
+    
+    for (int i = 0; i < n_timesteps; i++) {
+        double production_kW = (*normalized_production_vec_ptr)[i] * this->capacity_kW;
+        
+        // apply turbine factors
+        production_kW *= this->mean_turbine_factor;
+        
+        (*production_vec_kW_ptr)[i] = production_kW;
+    }
+    
+    return;
+}   /* scaleNormalizedProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Wind :: computeProductionSeries(
+///         int start_timestep,
+///         std::vector<double>* wind_resource_vec_ms_ptr,
+///         std::vector<double>* production_vec_kW_ptr
+///     )
+///
+/// \brief Method which takes in the wind resource (i.e. wind speed) [m/s]
+///     over a series of consecutive timesteps, and then writes the production of the
+///     wind turbine over that series. Gives exactly the same production as calling
+///     computeProductionkW() at each timestep.
+///
+/// \param start_timestep The timestep (i.e., time series index) at which the series
+///     starts.
+///
+/// \param wind_resource_vec_ms_ptr A pointer to the resource over the series.
+///
+/// \param production_vec_kW_ptr A pointer to the vector to which the production [kW]
+///     over the series is written (resized to match, if need be).
+///
+
+void Wind :: computeProductionSeries(
+    int start_timestep,
+    std::vector<double>* wind_resource_vec_ms_ptr,
+    std::vector<double>* production_vec_kW_ptr
+)
+{
+    //  given production time series override
+    if (this->normalized_production_series_given) {
+        int n_timesteps = wind_resource_vec_ms_ptr->size();
+        production_vec_kW_ptr->resize(n_timesteps, 0);
+        
+        for (int i = 0; i < n_timesteps; i++) {
+            (*production_vec_kW_ptr)[i] =
+                Production :: getProductionkW(start_timestep + i);
+        }
+        
+        return;
+    }
+    
+    // compute normalized production series, then scale by capacity
+    this->computeNormalizedProductionSeries(
+        start_timestep,
+        wind_resource_vec_ms_ptr,
+        production_vec_kW_ptr
+    );
+    
+    this->scaleNormalizedProductionSeries(production_vec_kW_ptr, production_vec_kW_ptr);
+    
+    return;
+}   /* computeProductionSeries() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn double Wind :: getTurbineProductionkW(int turbine, int timestep)
+///
+/// \brief Method to get the share of a single turbine in the production of the wind
+///     farm at the given timestep (i.e., of production_vec_kW, which is the production
+///     of the farm before dispatch, storage, and curtailment). Per-turbine production
+///     is not stored, but rather recovered on demand from the farm production and the
+///     turbine factors.
+///
+/// \param turbine The index of the turbine.
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \return The share of the given turbine in the production [kW] of the wind farm at
+///     the given timestep.
+///
+
+double Wind :: getTurbineProductionkW(int turbine, int timestep)
+{
+    //  1. check turbine
+    if (turbine < 0 or turbine >= this->n_turbines) {
+        std::string error_str = "ERROR:  Wind::getTurbineProductionkW():  ";
+        error_str += "turbine ";
+        error_str += std::to_string(turbine);
+        error_str += " is not in the wind farm";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  2. check timestep
+    if (timestep < 0 or timestep >= this->n_points) {
+        std::string error_str = "ERROR:  Wind::getTurbineProductionkW():  ";
+        error_str += "timestep ";
+        error_str += std::to_string(timestep);
+        error_str += " is not in the modelling time series";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
+    //  3. split farm production by turbine factor
+    double total_turbine_factor = this->n_turbines * this->mean_turbine_factor;
+    
+    if (total_turbine_factor <= 0) {
+        return 0;
+    }
+    
+    double production_kW = this->production_vec_kW[timestep] *
+        (this->turbine_factor_vec[turbine] / total_turbine_factor);
+    
+    return production_kW;
+}   /* getTurbineProductionkW() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -70,7 +70,10 @@ void Resources :: __checkResourceKey1D(
     RenewableType renewable_type
 )
 {
-    if (this->resource_map_1D.count(resource_key) > 0) {
+    if (
+        this->resource_map_1D.count(resource_key) > 0 or
+        this->registration_map_1D.count(resource_key) > 0
+    ) {
         std::string error_str = "ERROR:  Resources::addResource(";
         
         switch (renewable_type) {
@@ -137,7 +140,10 @@ void Resources :: __checkResourceKey1D(
     NoncombustionType noncombustion_type
 )
 {
-    if (this->resource_map_1D.count(resource_key) > 0) {
+    if (
+        this->resource_map_1D.count(resource_key) > 0 or
+        this->registration_map_1D.count(resource_key) > 0
+    ) {
         std::string error_str = "ERROR:  Resources::addResource(";
         
         switch (noncombustion_type) {
@@ -190,7 +196,10 @@ void Resources :: __checkResourceKey2D(
     RenewableType renewable_type
 )
 {
-    if (this->resource_map_2D.count(resource_key) > 0) {
+    if (
+        this->resource_map_2D.count(resource_key) > 0 or
+        this->registration_map_2D.count(resource_key) > 0
+    ) {
         std::string error_str = "ERROR:  Resources::addResource(";
         
         switch (renewable_type) {
@@ -737,6 +746,273 @@ void Resources :: __readWindResource(
 
 // ---------------------------------------------------------------------------------- //
 
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: __registerResource(
+///         int resource_key,
+///         std::string type_str,
+///         ResourceRegistration resource_registration
+///     )
+///
+/// \brief Helper method to register (but not read) a resource time series. The path
+///     and type are recorded immediately, but the data itself is only read once the
+///     resource is loaded.
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \param type_str A string describing the type of the given renewable resource.
+///
+/// \param resource_registration A structure describing the registered resource.
+///
+
+void Resources :: __registerResource(
+    int resource_key,
+    std::string type_str,
+    ResourceRegistration resource_registration
+)
+{
+    //  1. WAVE resources are 2D, all others 1D
+    if (
+        not resource_registration.is_noncombustion and
+        resource_registration.renewable_type == RenewableType :: WAVE
+    ) {
+        this->path_map_2D.insert(
+            std::pair<int, std::string>(
+                resource_key,
+                resource_registration.path_2_resource_data
+            )
+        );
+        
+        this->string_map_2D.insert(std::pair<int, std::string>(resource_key, type_str));
+        
+        this->registration_map_2D.insert(
+            std::pair<int, ResourceRegistration>(resource_key, resource_registration)
+        );
+    }
+    
+    else {
+        this->path_map_1D.insert(
+            std::pair<int, std::string>(
+                resource_key,
+                resource_registration.path_2_resource_data
+            )
+        );
+        
+        this->string_map_1D.insert(std::pair<int, std::string>(resource_key, type_str));
+        
+        this->registration_map_1D.insert(
+            std::pair<int, ResourceRegistration>(resource_key, resource_registration)
+        );
+    }
+    
+    return;
+}   /* __registerResource() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string Resources :: __getResourceHeader1D(
+///         ResourceRegistration resource_registration
+///     )
+///
+/// \brief Helper method to get the header of the data column of a registered 1D
+///     resource time series.
+///
+/// \param resource_registration A structure describing the registered resource.
+///
+/// \return The header of the data column.
+///
+
+std::string Resources :: __getResourceHeader1D(
+    ResourceRegistration resource_registration
+)
+{
+    if (resource_registration.is_noncombustion) {
+        switch (resource_registration.noncombustion_type) {
+            case (NoncombustionType :: HYDRO): {
+                return "Hydro Inflow [m3/hr]";
+            }
+            
+            default: {
+                // do nothing!
+                
+                break;
+            }
+        }
+    }
+    
+    else {
+        switch (resource_registration.renewable_type) {
+            case (RenewableType :: SOLAR): {
+                return "Solar GHI [kW/m2]";
+            }
+            
+            case (RenewableType :: TIDAL): {
+                return "Tidal Speed (hub depth) [m/s]";
+            }
+            
+            case (RenewableType :: WIND): {
+                return "Wind Speed (hub height) [m/s]";
+            }
+            
+            default: {
+                // do nothing!
+                
+                break;
+            }
+        }
+    }
+    
+    std::string error_str = "ERROR:  Resources::openResourceStreams():  ";
+    error_str += "resource type not recognized for the given resource time series at ";
+    error_str += resource_registration.path_2_resource_data;
+    
+    #ifdef _WIN32
+        std::cout << error_str << std::endl;
+    #endif
+
+    throw std::runtime_error(error_str);
+    
+    return "";
+}   /* __getResourceHeader1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: __readResourceWindow1D(
+///         int resource_key,
+///         ElectricalLoad* electrical_load_ptr
+///     )
+///
+/// \brief Helper method to read the current window of a streamed 1D resource time
+///     series, checking against the current window of the electrical load time series
+///     (point-wise, and in length once the final window is reached).
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+
+void Resources :: __readResourceWindow1D(
+    int resource_key,
+    ElectricalLoad* electrical_load_ptr
+)
+{
+    io::CSVReader<2>* CSV_ptr = this->stream_map_1D[resource_key].get();
+    std::string path_2_resource_data = this->path_map_1D[resource_key];
+    
+    //  1. size window
+    this->resource_map_1D[resource_key].resize(electrical_load_ptr->n_points, 0);
+    
+    //  2. read in window, check against time series (point-wise and length)
+    double time_hrs = 0;
+    double resource_value = 0;
+    
+    for (int i = 0; i < electrical_load_ptr->n_points; i++) {
+        if (not CSV_ptr->read_row(time_hrs, resource_value)) {
+            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+        }
+        
+        this->__checkTimePoint(
+            time_hrs,
+            electrical_load_ptr->time_vec_hrs[i],
+            path_2_resource_data,
+            electrical_load_ptr
+        );
+        
+        this->resource_map_1D[resource_key][i] = resource_value;
+    }
+    
+    //  3. if final window, check that no data remains
+    if (
+        electrical_load_ptr->window_start + electrical_load_ptr->n_points >=
+            electrical_load_ptr->n_points_total and
+        CSV_ptr->read_row(time_hrs, resource_value)
+    ) {
+        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+    }
+    
+    return;
+}   /* __readResourceWindow1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: __readResourceWindow2D(
+///         int resource_key,
+///         ElectricalLoad* electrical_load_ptr
+///     )
+///
+/// \brief Helper method to read the current window of a streamed 2D resource time
+///     series, checking against the current window of the electrical load time series
+///     (point-wise, and in length once the final window is reached).
+///
+/// \param resource_key The key associated with the given renewable resource.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+
+void Resources :: __readResourceWindow2D(
+    int resource_key,
+    ElectricalLoad* electrical_load_ptr
+)
+{
+    io::CSVReader<3>* CSV_ptr = this->stream_map_2D[resource_key].get();
+    std::string path_2_resource_data = this->path_map_2D[resource_key];
+    
+    //  1. size window
+    this->resource_map_2D[resource_key].resize(electrical_load_ptr->n_points, {0, 0});
+    
+    //  2. read in window, check against time series (point-wise and length)
+    double time_hrs = 0;
+    double resource_value_0 = 0;
+    double resource_value_1 = 0;
+    
+    for (int i = 0; i < electrical_load_ptr->n_points; i++) {
+        if (not CSV_ptr->read_row(time_hrs, resource_value_0, resource_value_1)) {
+            this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+        }
+        
+        this->__checkTimePoint(
+            time_hrs,
+            electrical_load_ptr->time_vec_hrs[i],
+            path_2_resource_data,
+            electrical_load_ptr
+        );
+        
+        this->resource_map_2D[resource_key][i][0] = resource_value_0;
+        this->resource_map_2D[resource_key][i][1] = resource_value_1;
+    }
+    
+    //  3. if final window, check that no data remains
+    if (
+        electrical_load_ptr->window_start + electrical_load_ptr->n_points >=
+            electrical_load_ptr->n_points_total and
+        CSV_ptr->read_row(time_hrs, resource_value_0, resource_value_1)
+    ) {
+        this->__throwLengthError(path_2_resource_data, electrical_load_ptr);
+    }
+    
+    return;
+}   /* __readResourceWindow2D() */
+
+// ---------------------------------------------------------------------------------- //
+
 // ======== END PRIVATE ============================================================= //
 
 
@@ -753,6 +1029,9 @@ void Resources :: __readWindResource(
 
 Resources :: Resources(void)
 {
+    this->is_streaming = false;
+    this->lazy_loading = false;
+    
     return;
 }   /* Resources() */
 
@@ -774,7 +1053,8 @@ Resources :: Resources(void)
 ///     given resource key is already in use. The associated helper methods also
 ///     check against ElectricalLoad to ensure that all added time series align with the
 ///     electrical load time series (both in terms of length and which points in time
-///     are included).
+///     are included). If lazy_loading, then the resource is only registered here, and
+///     is read (and checked) once loaded.
 ///
 /// \param noncombustion_type The type of renewable resource being added to Resources.
 ///
@@ -796,6 +1076,17 @@ void Resources :: addResource(
         case (NoncombustionType :: HYDRO): {
             this->__checkResourceKey1D(resource_key, noncombustion_type);
             
+            if (this->lazy_loading) {
+                ResourceRegistration resource_registration;
+                resource_registration.is_noncombustion = true;
+                resource_registration.noncombustion_type = noncombustion_type;
+                resource_registration.path_2_resource_data = path_2_resource_data;
+                
+                this->__registerResource(resource_key, "HYDRO", resource_registration);
+                
+                break;
+            }
+            
             this->__readHydroResource(
                 path_2_resource_data,
                 resource_key,
@@ -842,7 +1133,8 @@ void Resources :: addResource(
 ///     given resource key is already in use. The associated helper methods also
 ///     check against ElectricalLoad to ensure that all added time series align with the
 ///     electrical load time series (both in terms of length and which points in time
-///     are included).
+///     are included). If lazy_loading, then the resource is only registered here, and
+///     is read (and checked) once loaded.
 ///
 /// \param renewable_type The type of renewable resource being added to Resources.
 ///
@@ -864,6 +1156,16 @@ void Resources :: addResource(
         case (RenewableType :: SOLAR): {
             this->__checkResourceKey1D(resource_key, renewable_type);
             
+            if (this->lazy_loading) {
+                ResourceRegistration resource_registration;
+                resource_registration.renewable_type = renewable_type;
+                resource_registration.path_2_resource_data = path_2_resource_data;
+                
+                this->__registerResource(resource_key, "SOLAR", resource_registration);
+                
+                break;
+            }
+            
             this->__readSolarResource(
                 path_2_resource_data,
                 resource_key,
@@ -876,6 +1178,16 @@ void Resources :: addResource(
         case (RenewableType :: TIDAL): {
             this->__checkResourceKey1D(resource_key, renewable_type);
             
+            if (this->lazy_loading) {
+                ResourceRegistration resource_registration;
+                resource_registration.renewable_type = renewable_type;
+                resource_registration.path_2_resource_data = path_2_resource_data;
+                
+                this->__registerResource(resource_key, "TIDAL", resource_registration);
+                
+                break;
+            }
+            
             this->__readTidalResource(
                 path_2_resource_data,
                 resource_key,
@@ -888,6 +1200,16 @@ void Resources :: addResource(
         case (RenewableType :: WAVE): {
             this->__checkResourceKey2D(resource_key, renewable_type);
             
+            if (this->lazy_loading) {
+                ResourceRegistration resource_registration;
+                resource_registration.renewable_type = renewable_type;
+                resource_registration.path_2_resource_data = path_2_resource_data;
+                
+                this->__registerResource(resource_key, "WAVE", resource_registration);
+                
+                break;
+            }
+            
             this->__readWaveResource(
                 path_2_resource_data,
                 resource_key,
@@ -900,6 +1222,16 @@ void Resources :: addResource(
         case (RenewableType :: WIND): {
             this->__checkResourceKey1D(resource_key, renewable_type);
             
+            if (this->lazy_loading) {
+                ResourceRegistration resource_registration;
+                resource_registration.renewable_type = renewable_type;
+                resource_registration.path_2_resource_data = path_2_resource_data;
+                
+                this->__registerResource(resource_key, "WIND", resource_registration);
+                
+                break;
+            }
+            
             this->__readWindResource(
                 path_2_resource_data,
                 resource_key,
@@ -931,6 +1263,359 @@ void Resources :: addResource(
 // ---------------------------------------------------------------------------------- //
 
 
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: loadResource1D(
+///         int resource_key,
+///         ElectricalLoad* electrical_load_ptr
+///     )
+///
+/// \brief A method to load (i.e., read in) a registered 1D resource time series. Does
+///     nothing if the resource is already loaded, if no resource is registered under
+///     the given key, or if streaming.
+///
+/// \param resource_key A key used to index into the Resources object.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+
+void Resources :: loadResource1D(int resource_key, ElectricalLoad* electrical_load_ptr)
+{
+    //  1. check for registration (streamed resources are read window by window instead)
+    if (this->is_streaming or this->registration_map_1D.count(resource_key) == 0) {
+        return;
+    }
+    
+    ResourceRegistration resource_registration =
+        this->registration_map_1D[resource_key];
+    
+    std::string path_2_resource_data = resource_registration.path_2_resource_data;
+    
+    //  2. read in resource data
+    if (resource_registration.is_noncombustion) {
+        switch (resource_registration.noncombustion_type) {
+            case (NoncombustionType :: HYDRO): {
+                this->__readHydroResource(
+                    path_2_resource_data,
+                    resource_key,
+                    electrical_load_ptr
+                );
+                
+                break;
+            }
+            
+            default: {
+                // do nothing!
+                
+                break;
+            }
+        }
+    }
+    
+    else {
+        switch (resource_registration.renewable_type) {
+            case (RenewableType :: SOLAR): {
+                this->__readSolarResource(
+                    path_2_resource_data,
+                    resource_key,
+                    electrical_load_ptr
+                );
+                
+                break;
+            }
+            
+            case (RenewableType :: TIDAL): {
+                this->__readTidalResource(
+                    path_2_resource_data,
+                    resource_key,
+                    electrical_load_ptr
+                );
+                
+                break;
+            }
+            
+            case (RenewableType :: WIND): {
+                this->__readWindResource(
+                    path_2_resource_data,
+                    resource_key,
+                    electrical_load_ptr
+                );
+                
+                break;
+            }
+            
+            default: {
+                // do nothing!
+                
+                break;
+            }
+        }
+    }
+    
+    //  3. resource now loaded, so drop registration
+    this->registration_map_1D.erase(resource_key);
+    
+    return;
+}   /* loadResource1D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: loadResource2D(
+///         int resource_key,
+///         ElectricalLoad* electrical_load_ptr
+///     )
+///
+/// \brief A method to load (i.e., read in) a registered 2D resource time series. Does
+///     nothing if the resource is already loaded, if no resource is registered under
+///     the given key, or if streaming.
+///
+/// \param resource_key A key used to index into the Resources object.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+
+void Resources :: loadResource2D(int resource_key, ElectricalLoad* electrical_load_ptr)
+{
+    //  1. check for registration (streamed resources are read window by window instead)
+    if (this->is_streaming or this->registration_map_2D.count(resource_key) == 0) {
+        return;
+    }
+    
+    ResourceRegistration resource_registration =
+        this->registration_map_2D[resource_key];
+    
+    //  2. read in resource data
+    switch (resource_registration.renewable_type) {
+        case (RenewableType :: WAVE): {
+            this->__readWaveResource(
+                resource_registration.path_2_resource_data,
+                resource_key,
+                electrical_load_ptr
+            );
+            
+            break;
+        }
+        
+        default: {
+            // do nothing!
+            
+            break;
+        }
+    }
+    
+    //  3. resource now loaded, so drop registration
+    this->registration_map_2D.erase(resource_key);
+    
+    return;
+}   /* loadResource2D() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: openResourceStreams(
+///         ElectricalLoad* electrical_load_ptr,
+///         std::vector<int>* resource_keys_1D_ptr,
+///         std::vector<int>* resource_keys_2D_ptr
+///     )
+///
+/// \brief A method to open the given registered resource time series for streaming, in
+///     windows aligned with those of the given (streaming) electrical load. Only the
+///     given keys are streamed (typically, those bound to an asset; see
+///     Controller::getBoundResourceKeys()), so that resources which are registered but
+///     never used are never read. If no keys are given, every registered resource is
+///     streamed. Any open streams are first closed. Registrations are kept, so that
+///     streams can be re-opened. Reads in the window matching the current electrical
+///     load window.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+/// \param resource_keys_1D_ptr A pointer to the vector of 1D resource keys to stream
+///     (if null, every registered 1D resource is streamed).
+///
+/// \param resource_keys_2D_ptr A pointer to the vector of 2D resource keys to stream
+///     (if null, every registered 2D resource is streamed).
+///
+
+void Resources :: openResourceStreams(
+    ElectricalLoad* electrical_load_ptr,
+    std::vector<int>* resource_keys_1D_ptr,
+    std::vector<int>* resource_keys_2D_ptr
+)
+{
+    //  1. close any open streams
+    this->closeResourceStreams();
+    
+    //  2. get keys to stream (if not given, every registered key)
+    std::vector<int> resource_keys_1D;
+    std::vector<int> resource_keys_2D;
+    
+    std::map<int, ResourceRegistration>::iterator iter;
+    
+    if (resource_keys_1D_ptr == nullptr) {
+        for (
+            iter = this->registration_map_1D.begin();
+            iter != this->registration_map_1D.end();
+            iter++
+        ) {
+            resource_keys_1D.push_back(iter->first);
+        }
+        
+        resource_keys_1D_ptr = &resource_keys_1D;
+    }
+    
+    if (resource_keys_2D_ptr == nullptr) {
+        for (
+            iter = this->registration_map_2D.begin();
+            iter != this->registration_map_2D.end();
+            iter++
+        ) {
+            resource_keys_2D.push_back(iter->first);
+        }
+        
+        resource_keys_2D_ptr = &resource_keys_2D;
+    }
+    
+    //  3. open 1D streams (for registered keys only)
+    for (size_t i = 0; i < resource_keys_1D_ptr->size(); i++) {
+        int resource_key = resource_keys_1D_ptr->at(i);
+        
+        iter = this->registration_map_1D.find(resource_key);
+        
+        if (
+            iter == this->registration_map_1D.end() or
+            this->stream_map_1D.count(resource_key) > 0
+        ) {
+            continue;
+        }
+        
+        std::shared_ptr<io::CSVReader<2>> CSV_ptr =
+            std::make_shared<io::CSVReader<2>>(iter->second.path_2_resource_data);
+        
+        CSV_ptr->read_header(
+            io::ignore_extra_column,
+            "Time (since start of data) [hrs]",
+            this->__getResourceHeader1D(iter->second)
+        );
+        
+        this->stream_map_1D.insert(
+            std::pair<int, std::shared_ptr<io::CSVReader<2>>>(resource_key, CSV_ptr)
+        );
+    }
+    
+    //  4. open 2D streams (for registered keys only)
+    for (size_t i = 0; i < resource_keys_2D_ptr->size(); i++) {
+        int resource_key = resource_keys_2D_ptr->at(i);
+        
+        iter = this->registration_map_2D.find(resource_key);
+        
+        if (
+            iter == this->registration_map_2D.end() or
+            this->stream_map_2D.count(resource_key) > 0
+        ) {
+            continue;
+        }
+        
+        std::shared_ptr<io::CSVReader<3>> CSV_ptr =
+            std::make_shared<io::CSVReader<3>>(iter->second.path_2_resource_data);
+        
+        CSV_ptr->read_header(
+            io::ignore_extra_column,
+            "Time (since start of data) [hrs]",
+            "Significant Wave Height [m]",
+            "Energy Period [s]"
+        );
+        
+        this->stream_map_2D.insert(
+            std::pair<int, std::shared_ptr<io::CSVReader<3>>>(resource_key, CSV_ptr)
+        );
+    }
+    
+    //  5. read in current window
+    this->is_streaming = true;
+    this->readResourceWindows(electrical_load_ptr);
+    
+    return;
+}   /* openResourceStreams() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: readResourceWindows(ElectricalLoad* electrical_load_ptr)
+///
+/// \brief A method to read, for every open resource stream, the window matching the
+///     current electrical load window. Streams must be advanced in step with the
+///     electrical load.
+///
+/// \param electrical_load_ptr A pointer to the Model's ElectricalLoad object.
+///
+
+void Resources :: readResourceWindows(ElectricalLoad* electrical_load_ptr)
+{
+    //  1. read 1D windows
+    std::map<int, std::shared_ptr<io::CSVReader<2>>>::iterator iter_1D;
+    
+    for (
+        iter_1D = this->stream_map_1D.begin();
+        iter_1D != this->stream_map_1D.end();
+        iter_1D++
+    ) {
+        this->__readResourceWindow1D(iter_1D->first, electrical_load_ptr);
+    }
+    
+    //  2. read 2D windows
+    std::map<int, std::shared_ptr<io::CSVReader<3>>>::iterator iter_2D;
+    
+    for (
+        iter_2D = this->stream_map_2D.begin();
+        iter_2D != this->stream_map_2D.end();
+        iter_2D++
+    ) {
+        this->__readResourceWindow2D(iter_2D->first, electrical_load_ptr);
+    }
+    
+    return;
+}   /* readResourceWindows() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Resources :: closeResourceStreams(void)
+///
+/// \brief A method to close all open resource streams.
+///
+
+void Resources :: closeResourceStreams(void)
+{
+    this->stream_map_1D.clear();
+    this->stream_map_2D.clear();
+    
+    this->is_streaming = false;
+    
+    return;
+}   /* closeResourceStreams() */
+
+// ---------------------------------------------------------------------------------- //
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -941,6 +1626,11 @@ void Resources :: addResource(
 
 void Resources :: clear(void)
 {
+    this->closeResourceStreams();
+    
+    this->registration_map_1D.clear();
+    this->registration_map_2D.clear();
+    
     this->resource_map_1D.clear();
     this->string_map_1D.clear();
     this->path_map_1D.clear();
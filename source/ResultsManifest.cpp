@@ -0,0 +1,397 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file ResultsManifest.cpp
+///
+/// \brief Implementation file for the ResultsManifest class.
+///
+/// A class which tracks a content hash for every results file written under a given
+/// output directory. Intended to support incremental writing of Model results.
+///
+
+
+#include "../header/ResultsManifest.h"
+
+
+// ======== PRIVATE ================================================================= //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string ResultsManifest :: __getRelativePath(std::string path)
+///
+/// \brief Helper method to express a given path relative to write_path (if path lies
+///     under write_path, otherwise path is returned unchanged).
+///
+/// \param path The path to be expressed relative to write_path.
+///
+/// \return The path relative to write_path.
+///
+
+std::string ResultsManifest :: __getRelativePath(std::string path)
+{
+    if (
+        not this->write_path.empty() and
+        path.compare(0, this->write_path.size(), this->write_path) == 0
+    ) {
+        return path.substr(this->write_path.size());
+    }
+    
+    return path;
+}   /* __getRelativePath() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PRIVATE ============================================================= //
+
+
+
+// ======== PUBLIC ================================================================== //
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ResultsManifest :: ResultsManifest(void)
+///
+/// \brief Constructor (dummy) for the ResultsManifest class. A default constructed
+///     ResultsManifest tracks nothing on disk, and so writes every file.
+///
+
+ResultsManifest :: ResultsManifest(void)
+{
+    this->clear();
+    return;
+}   /* ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ResultsManifest :: ResultsManifest(std::string write_path)
+///
+/// \brief Constructor (intended) for the ResultsManifest class. Reads in the manifest
+///     under write_path (if it exists).
+///
+/// \param write_path A path (either relative or absolute) to the root results
+///     directory.
+///
+
+ResultsManifest :: ResultsManifest(std::string write_path)
+{
+    //  1. clear, record path
+    this->clear();
+    
+    if (not write_path.empty() and write_path.back() != '/') {
+        write_path += '/';
+    }
+    
+    this->write_path = write_path;
+    
+    //  2. read in previous manifest (if any)
+    std::string path_2_manifest = this->write_path + "results_manifest.csv";
+    
+    if (not std::filesystem::is_regular_file(path_2_manifest)) {
+        return;
+    }
+    
+    std::ifstream ifs;
+    ifs.open(path_2_manifest, std::ifstream::in);
+    
+    std::string line_str;
+    std::getline(ifs, line_str);    // header
+    
+    while (std::getline(ifs, line_str)) {
+        size_t split_idx = line_str.rfind(',');
+        
+        if (split_idx == std::string::npos) {
+            continue;
+        }
+        
+        this->previous_hash_map.insert(
+            std::pair<std::string, std::string>(
+                line_str.substr(0, split_idx),
+                line_str.substr(split_idx + 1)
+            )
+        );
+    }
+    
+    ifs.close();
+    return;
+}   /* ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string ResultsManifest :: computeHash(const std::string& contents_str)
+///
+/// \brief Method to compute a (deterministic) content hash, using the 64-bit FNV-1a
+///     algorithm.
+///
+/// \param contents_str The contents to be hashed.
+///
+/// \return The content hash, as a hexadecimal string.
+///
+
+std::string ResultsManifest :: computeHash(const std::string& contents_str)
+{
+    //  1. FNV-1a (64-bit)
+    uint64_t hash = 14695981039346656037ULL;
+    
+    for (size_t i = 0; i < contents_str.size(); i++) {
+        hash ^= (unsigned char)(contents_str[i]);
+        hash *= 1099511628211ULL;
+    }
+    
+    //  2. format as hexadecimal
+    std::stringstream hash_ss;
+    hash_ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    
+    return hash_ss.str();
+}   /* computeHash() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn bool ResultsManifest :: writeFile(std::string path, const std::string& contents_str)
+///
+/// \brief Method to write the given contents to the given path, unless the manifest
+///     records identical contents at that path and the file still exists. Safe to call
+///     concurrently.
+///
+/// \param path A path (either relative or absolute) to the file to be written.
+///
+/// \param contents_str The contents to be written.
+///
+/// \return True if the file was written, false if it was skipped as unchanged.
+///
+
+bool ResultsManifest :: writeFile(std::string path, const std::string& contents_str)
+{
+    //  1. hash and record
+    std::string relative_path = this->__getRelativePath(path);
+    std::string hash = this->computeHash(contents_str);
+    
+    {
+        std::lock_guard<std::mutex> lock(this->manifest_mutex);
+        this->current_hash_map[relative_path] = hash;
+    }
+    
+    //  2. skip if unchanged
+    if (
+        this->previous_hash_map.count(relative_path) > 0 and
+        this->previous_hash_map.at(relative_path) == hash and
+        std::filesystem::is_regular_file(path)
+    ) {
+        std::lock_guard<std::mutex> lock(this->manifest_mutex);
+        this->n_files_skipped++;
+        
+        return false;
+    }
+    
+    //  3. write
+    std::ofstream ofs;
+    ofs.open(path, std::ofstream::out);
+    ofs << contents_str;
+    ofs.close();
+    
+    {
+        std::lock_guard<std::mutex> lock(this->manifest_mutex);
+        this->n_files_written++;
+    }
+    
+    return true;
+}   /* writeFile() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ResultsManifest :: prune(void)
+///
+/// \brief Method to remove every file recorded in the previous manifest but not
+///     written (or skipped) in the current pass. Any directories left empty as a
+///     result (e.g. those of removed assets) are also removed.
+///
+
+void ResultsManifest :: prune(void)
+{
+    if (this->write_path.empty()) {
+        return;
+    }
+    
+    std::map<std::string, std::string>::iterator iter;
+    for (
+        iter = this->previous_hash_map.begin();
+        iter != this->previous_hash_map.end();
+        iter++
+    ) {
+        //  1. skip if still current
+        if (this->current_hash_map.count(iter->first) > 0) {
+            continue;
+        }
+        
+        //  2. remove stale file
+        std::filesystem::path stale_path =
+            std::filesystem::path(this->write_path) / iter->first;
+        
+        if (std::filesystem::remove(stale_path)) {
+            this->n_files_pruned++;
+        }
+        
+        //  3. remove any directories left empty (up to, but not including, write_path)
+        std::filesystem::path relative_dir =
+            std::filesystem::path(iter->first).parent_path();
+        
+        while (not relative_dir.empty()) {
+            std::filesystem::path dir =
+                std::filesystem::path(this->write_path) / relative_dir;
+            
+            if (
+                not std::filesystem::is_directory(dir) or
+                not std::filesystem::is_empty(dir)
+            ) {
+                break;
+            }
+            
+            std::filesystem::remove(dir);
+            relative_dir = relative_dir.parent_path();
+        }
+    }
+    
+    return;
+}   /* prune() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ResultsManifest :: writeManifest(void)
+///
+/// \brief Method to write the current manifest (results_manifest.csv) under
+///     write_path.
+///
+
+void ResultsManifest :: writeManifest(void)
+{
+    if (this->write_path.empty()) {
+        return;
+    }
+    
+    std::ofstream ofs;
+    ofs.open(this->write_path + "results_manifest.csv", std::ofstream::out);
+    
+    ofs << "Path,Hash (FNV-1a 64)\n";
+    
+    std::map<std::string, std::string>::iterator iter;
+    for (
+        iter = this->current_hash_map.begin();
+        iter != this->current_hash_map.end();
+        iter++
+    ) {
+        ofs << iter->first << "," << iter->second << "\n";
+    }
+    
+    ofs.close();
+    return;
+}   /* writeManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void ResultsManifest :: clear(void)
+///
+/// \brief Method to clear all attributes of the ResultsManifest object.
+///
+
+void ResultsManifest :: clear(void)
+{
+    this->n_files_written = 0;
+    this->n_files_skipped = 0;
+    this->n_files_pruned = 0;
+    
+    this->write_path.clear();
+    
+    this->previous_hash_map.clear();
+    this->current_hash_map.clear();
+    
+    return;
+}   /* clear() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn ResultsManifest :: ~ResultsManifest(void)
+///
+/// \brief Destructor for the ResultsManifest class.
+///
+
+ResultsManifest :: ~ResultsManifest(void)
+{
+    this->clear();
+    return;
+}   /* ~ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+// ======== END PUBLIC ============================================================== //
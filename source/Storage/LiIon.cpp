@@ -248,6 +248,18 @@ void LiIon :: __checkInputs(LiIonInputs liion_inputs)
         throw std::invalid_argument(error_str);
     }
     
+    //  17. check degradation_eval_interval_hrs
+    if (liion_inputs.degradation_eval_interval_hrs < 0) {
+        std::string error_str = "ERROR:  LiIon():  degradation_eval_interval_hrs must be ";
+        error_str += ">= 0";
+        
+        #ifdef _WIN32
+            std::cout << error_str << std::endl;
+        #endif
+
+        throw std::invalid_argument(error_str);
+    }
+    
     return;
 }   /* __checkInputs() */
 
@@ -372,7 +384,13 @@ void LiIon :: __handleDegradation(
 )
 {
     //  1. model degradation
-    this->__modelDegradation(dt_hrs, charging_discharging_kW);
+    if (this->fast_degradation) {
+        this->__modelDegradationFast(timestep, dt_hrs, charging_discharging_kW);
+    }
+    
+    else {
+        this->__modelDegradation(dt_hrs, charging_discharging_kW);
+    }
     
     //  2. update and record
     this->SOH_vec[timestep] = this->SOH;
@@ -413,15 +431,20 @@ void LiIon :: __modelDegradation(double dt_hrs, double charging_discharging_kW)
     //  2. compute C-rate and corresponding acceleration factor
     double C_rate = charging_discharging_kW / this->power_capacity_kW;
     
-    double C_acceleration_factor =
-        1 + this->degradation_alpha * pow(C_rate, this->degradation_beta);
+    double C_acceleration_factor = 1 + this->degradation_alpha * (
+        this->fast_kernels ?
+        FastMath::pow(C_rate, this->degradation_beta) :
+        pow(C_rate, this->degradation_beta)
+    );
     
     //  3. compute dSOH / dt
     double B_cal = __getBcal(SOC);
     double Ea_cal = __getEacal(SOC);
     
+    double exponent = (-1 * Ea_cal) / (this->gas_constant_JmolK * this->temperature_K);
+    
     double dSOH_dt = B_cal *
-        exp((-1 * Ea_cal) / (this->gas_constant_JmolK * this->temperature_K));
+        (this->fast_kernels ? FastMath::exp(exponent) : exp(exponent));
     
     dSOH_dt *= dSOH_dt;
     dSOH_dt *= 1 / (2 * this->SOH);
@@ -454,8 +477,10 @@ void LiIon :: __modelDegradation(double dt_hrs, double charging_discharging_kW)
 
 double LiIon :: __getBcal(double SOC)
 {
+    double exponent = this->degradation_r_cal * SOC;
+    
     double B_cal = this->degradation_B_hat_cal_0 *
-        exp(this->degradation_r_cal * SOC);
+        (this->fast_kernels ? FastMath::exp(exponent) : exp(exponent));
     
     return B_cal;
 }   /* __getBcal() */
@@ -483,8 +508,10 @@ double LiIon :: __getEacal(double SOC)
 {
     double Ea_cal = this->degradation_Ea_cal_0;
     
+    double exponent = this->degradation_s_cal * SOC;
+    
     Ea_cal -= this->degradation_a_cal *
-        (exp(this->degradation_s_cal * SOC) - 1);
+        ((this->fast_kernels ? FastMath::exp(exponent) : exp(exponent)) - 1);
     
     return Ea_cal;
 }   /* __getEacal( */
@@ -496,20 +523,237 @@ double LiIon :: __getEacal(double SOC)
 // ---------------------------------------------------------------------------------- //
 
 ///
-/// \fn void LiIon :: __writeSummary(std::string write_path)
+/// \fn InterpolatorStruct1D LiIon :: __buildDegradationTable(void)
+///
+/// \brief Helper method to tabulate the calendar degradation rate over state of charge,
+///     on a uniform grid of LIION_DEGRADATION_TABLE_POINTS points spanning [0, 1]. The
+///     rate is the square of B_cal * exp(-Ea_cal / (R * T)), so that
+///     d(SOH^2) / dt = -rate * C_acceleration_factor (see __modelDegradation()). The
+///     Arrhenius factor 1 / (R * T) is constant, and so is computed once. The table is
+///     returned complete (see Interpolator::addData1D()), so that it can be borrowed.
+///
+/// Ref: \cite BatteryDegradation_2023\n
+///
+/// \return A (complete) 1D interpolation struct holding the tabulated calendar
+///     degradation rate [1/hrs].
+///
+
+InterpolatorStruct1D LiIon :: __buildDegradationTable(void)
+{
+    InterpolatorStruct1D degradation_table;
+    
+    degradation_table.x_vec.resize(LIION_DEGRADATION_TABLE_POINTS, 0);
+    degradation_table.y_vec.resize(LIION_DEGRADATION_TABLE_POINTS, 0);
+    
+    double inv_RT = 1 / (this->gas_constant_JmolK * this->temperature_K);
+    
+    for (int i = 0; i < LIION_DEGRADATION_TABLE_POINTS; i++) {
+        double SOC = (double)i / (LIION_DEGRADATION_TABLE_POINTS - 1);
+        
+        double B_cal = this->degradation_B_hat_cal_0 *
+            exp(this->degradation_r_cal * SOC);
+        
+        double Ea_cal = this->degradation_Ea_cal_0 -
+            this->degradation_a_cal * (exp(this->degradation_s_cal * SOC) - 1);
+        
+        double rate = B_cal * exp(-1 * Ea_cal * inv_RT);
+        
+        degradation_table.x_vec[i] = SOC;
+        degradation_table.y_vec[i] = rate * rate;
+    }
+    
+    Interpolator interpolator;
+    interpolator.addData1D(0, degradation_table);
+    
+    return interpolator.interp_map_1D[0];
+}   /* __buildDegradationTable() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn std::string LiIon :: __getDegradationTableKey(void)
+///
+/// \brief Helper method to construct the DataCache key of the calendar degradation rate
+///     table. The key encodes every parameter the table depends on, so that assets
+///     share a table if and only if they would build it alike.
+///
+/// \return The DataCache key of the calendar degradation rate table.
+///
+
+std::string LiIon :: __getDegradationTableKey(void)
+{
+    std::ostringstream key_stream;
+    
+    key_stream << std::hexfloat;
+    key_stream << "LiIon::degradation_rate";
+    key_stream << "::" << LIION_DEGRADATION_TABLE_POINTS;
+    key_stream << "::" << this->degradation_B_hat_cal_0;
+    key_stream << "," << this->degradation_r_cal;
+    key_stream << "," << this->degradation_Ea_cal_0;
+    key_stream << "," << this->degradation_a_cal;
+    key_stream << "," << this->degradation_s_cal;
+    key_stream << "," << this->gas_constant_JmolK;
+    key_stream << "," << this->temperature_K;
+    
+    return key_stream.str();
+}   /* __getDegradationTableKey() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void LiIon :: __initDegradationTable(void)
+///
+/// \brief Helper method to set up the calendar degradation rate table (see
+///     LiIonInputs::fast_degradation). The table is built once per distinct set of
+///     degradation parameters, and shared by all assets with that set (see
+///     DataCache::getDerivedData1D()).
+///
+
+void LiIon :: __initDegradationTable(void)
+{
+    std::shared_ptr<const InterpolatorStruct1D> degradation_table_ptr =
+        DataCache::getDerivedData1D(
+            this->__getDegradationTableKey(),
+            [this](void) {
+                return this->__buildDegradationTable();
+            }
+        );
+    
+    this->degradation_rate_handle = this->interpolator.borrowData1D(
+        0,
+        degradation_table_ptr
+    );
+    
+    return;
+}   /* __initDegradationTable() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void LiIon :: __modelDegradationFast(
+///         int timestep,
+///         double dt_hrs,
+///         double charging_discharging_kW
+///     )
+///
+/// \brief Helper method to model energy capacity degradation as a function of operating
+///     state, by way of the fast degradation engine (see LiIonInputs::fast_degradation).
+///
+/// The model of __modelDegradation() can be written as
+/// d(SOH^2) / dt = -rate(SOC) * C_acceleration_factor, which does not depend on SOH.
+/// So, the loss of SOH^2 over a commit integrates exactly, and can be accumulated over
+/// any number of commits before being applied (it is always applied at the last
+/// timestep, so that none is left pending at the end of the run). The calendar
+/// degradation rate is looked up in a table over state of charge, which replaces three
+/// exp() calls per commit (and the pow() of the C-rate, if degradation_beta is 1).
+///
+/// Ref: \cite BatteryDegradation_2023\n
+///
+/// \param timestep The timestep (i.e., time series index) for the request.
+///
+/// \param dt_hrs The interval of time [hrs] associated with the timestep.
+///
+/// \param charging_discharging_kW The charging/discharging power [kw] being sent to
+///     the asset.
+///
+
+void LiIon :: __modelDegradationFast(
+    int timestep,
+    double dt_hrs,
+    double charging_discharging_kW
+)
+{
+    //  1. compute SOC (clamped to the tabulated range) and look up calendar rate
+    double SOC = this->charge_kWh / this->energy_capacity_kWh;
+    
+    if (SOC < 0) {
+        SOC = 0;
+    }
+    
+    else if (SOC > 1) {
+        SOC = 1;
+    }
+    
+    double rate = this->interpolator.interp1DUnchecked(
+        this->degradation_rate_handle,
+        SOC
+    );
+    
+    //  2. compute C-rate and corresponding acceleration factor
+    double C_rate = charging_discharging_kW / this->power_capacity_kW;
+    
+    double C_acceleration = C_rate;
+    
+    if (this->degradation_beta != 1) {
+        C_acceleration = this->fast_kernels ?
+            FastMath::pow(C_rate, this->degradation_beta) :
+            pow(C_rate, this->degradation_beta);
+    }
+    
+    double C_acceleration_factor = 1 + this->degradation_alpha * C_acceleration;
+    
+    //  3. accumulate loss of SOH^2
+    this->pending_degradation += rate * C_acceleration_factor * dt_hrs;
+    this->pending_degradation_hrs += dt_hrs;
+    
+    //  4. apply to state of health (at the end of each evaluation interval, and at the
+    //     last timestep)
+    if (
+        this->pending_degradation_hrs >= this->degradation_eval_interval_hrs or
+        timestep == this->n_points - 1
+    ) {
+        double SOH_squared = this->SOH * this->SOH - this->pending_degradation;
+        
+        this->SOH = SOH_squared > 0 ? sqrt(SOH_squared) : 0;
+        
+        this->pending_degradation = 0;
+        this->pending_degradation_hrs = 0;
+    }
+    
+    return;
+}   /* __modelDegradationFast() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void LiIon :: __writeSummary(
+///         std::string write_path,
+///         ResultsManifest* results_manifest_ptr
+///     )
 ///
 /// \brief Helper method to write summary results for LiIon.
 ///
 /// \param write_path A path (either relative or absolute) to the directory location 
 ///     where results are to be written. If already exists, will overwrite.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
-void LiIon :: __writeSummary(std::string write_path)
+void LiIon :: __writeSummary(
+    std::string write_path,
+    ResultsManifest* results_manifest_ptr
+)
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "summary_results.md";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write summary results (markdown)
     ofs << "# ";
@@ -570,6 +814,14 @@ void LiIon :: __writeSummary(std::string write_path)
     ofs << "Universal Gas Constant: " << this->gas_constant_JmolK
         << " J/mol.K  \n";
     ofs << "Absolute Environmental Temperature: " << this->temperature_K << " K  \n";
+    ofs << "\n";
+    
+    ofs << "Fast Degradation (N = 0 / Y = 1): " << this->fast_degradation << "  \n";
+    
+    if (this->fast_degradation) {
+        ofs << "Degradation Evaluation Interval: "
+            << this->degradation_eval_interval_hrs << " hrs  \n";
+    }
     
     ofs << "\n--------\n\n";
     
@@ -590,7 +842,7 @@ void LiIon :: __writeSummary(std::string write_path)
     ofs << "Replacements: " << this->n_replacements << "  \n";
     
     ofs << "\n--------\n\n";
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeSummary() */
 
@@ -604,7 +856,8 @@ void LiIon :: __writeSummary(std::string write_path)
 /// \fn void LiIon :: __writeTimeSeries(
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Helper method to write time series results for LiIon.
@@ -617,17 +870,20 @@ void LiIon :: __writeSummary(std::string write_path)
 ///
 /// \param max_lines The maximum number of lines of output to write.
 ///
+/// \param results_manifest_ptr A pointer to the ResultsManifest through which output
+///     files are written (unchanged files are skipped).
+///
 
 void LiIon :: __writeTimeSeries(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. create filestream
+    //  1. create output stream (buffered, written out via results manifest)
     write_path += "time_series_results.csv";
-    std::ofstream ofs;
-    ofs.open(write_path, std::ofstream::out);
+    std::ostringstream ofs;
     
     //  2. write time series results (comma separated value)
     ofs << "Time (since start of data) [hrs],";
@@ -650,7 +906,7 @@ void LiIon :: __writeTimeSeries(
         ofs << "\n";
     }
     
-    ofs.close();
+    results_manifest_ptr->writeFile(write_path, ofs.str());
     return;
 }   /* __writeTimeSeries() */
 
@@ -732,6 +988,16 @@ Storage(
     this->gas_constant_JmolK = liion_inputs.gas_constant_JmolK;
     this->temperature_K = liion_inputs.temperature_K;
     
+    this->fast_degradation = liion_inputs.fast_degradation;
+    this->degradation_eval_interval_hrs = liion_inputs.degradation_eval_interval_hrs;
+    
+    this->pending_degradation = 0;
+    this->pending_degradation_hrs = 0;
+    
+    if (this->fast_degradation) {
+        this->__initDegradationTable();
+    }
+    
     this->init_SOC = liion_inputs.init_SOC;
     this->charge_kWh = this->init_SOC * this->energy_capacity_kWh;
 
@@ -793,6 +1059,9 @@ void LiIon :: handleReplacement(int timestep)
     this->dynamic_power_capacity_kW = this->power_capacity_kW;
     this->SOH = 1;
     
+    this->pending_degradation = 0;
+    this->pending_degradation_hrs = 0;
+    
     // 2. invoke base class method
     Storage::handleReplacement(timestep);
     
@@ -807,6 +1076,32 @@ void LiIon :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void LiIon :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window. Resizes and zeros the modelling
+///     time series, while all scalar state carries over.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void LiIon :: resetWindow(int n_points)
+{
+    //  1. invoke base class method
+    Storage :: resetWindow(n_points);
+    
+    //  2. reset time series (state of health carries over)
+    this->SOH_vec.assign(this->n_points, 0);
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
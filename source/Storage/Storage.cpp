@@ -212,6 +212,7 @@ Storage :: Storage(
     this->print_flag = storage_inputs.print_flag;
     this->is_depleted = false;
     this->is_sunk = storage_inputs.is_sunk;
+    this->fast_kernels = false;
     
     this->n_points = n_points;
     this->n_replacements = 0;
@@ -287,6 +288,38 @@ void Storage :: handleReplacement(int timestep)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void Storage :: resetWindow(int n_points)
+///
+/// \brief Method to begin a new streaming window (see ElectricalLoad::openLoadStream()).
+///     Resizes and zeros the modelling time series, while all scalar state (charge,
+///     replacements, totals, etc.) carries over.
+///
+/// \param n_points The number of points in the new window.
+///
+
+void Storage :: resetWindow(int n_points)
+{
+    //  1. set number of points
+    this->n_points = n_points;
+    
+    //  2. reset time series (all scalar state carries over)
+    this->charge_vec_kWh.assign(this->n_points, 0);
+    this->charging_power_vec_kW.assign(this->n_points, 0);
+    this->discharging_power_vec_kW.assign(this->n_points, 0);
+    
+    this->capital_cost_vec.assign(this->n_points, 0);
+    this->operation_maintenance_cost_vec.assign(this->n_points, 0);
+    
+    return;
+}   /* resetWindow() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -308,14 +341,25 @@ void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
     //  1. compute net present cost
     double t_hrs = 0;
     double real_discount_scalar = 0;
+    double log_real_discount = 0;
+    
+    if (this->fast_kernels) {
+        log_real_discount = FastMath::log(1 + this->real_discount_annual);
+    }
     
     for (int i = 0; i < this->n_points; i++) {
         t_hrs = time_vec_hrs_ptr->at(i);
         
-        real_discount_scalar = 1.0 / pow(
-            1 + this->real_discount_annual,
-            t_hrs / 8760
-        );
+        if (this->fast_kernels) {
+            real_discount_scalar = FastMath::exp(-log_real_discount * t_hrs / 8760);
+        }
+        
+        else {
+            real_discount_scalar = 1.0 / pow(
+                1 + this->real_discount_annual,
+                t_hrs / 8760
+            );
+        }
         
         this->net_present_cost += real_discount_scalar * this->capital_cost_vec[i];
         
@@ -358,7 +402,8 @@ void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 ///         std::string write_path,
 ///         std::vector<double>* time_vec_hrs_ptr,
 ///         int storage_index,
-///         int max_lines
+///         int max_lines,
+///         ResultsManifest* results_manifest_ptr
 ///     )
 ///
 /// \brief Method which writes Storage results to an output directory.
@@ -375,19 +420,28 @@ void Storage :: computeEconomics(std::vector<double>* time_vec_hrs_ptr)
 /// \param max_lines The maximum number of lines of output to write. If <0, then all
 ///     available lines are written. If =0, then only summary results are written.
 ///
+/// \param results_manifest_ptr A pointer to a ResultsManifest through which output files
+///     are written (unchanged files are skipped). If null, all files are written.
+///
 
 void Storage :: writeResults(
     std::string write_path,
     std::vector<double>* time_vec_hrs_ptr,
     int storage_index,
-    int max_lines
+    int max_lines,
+    ResultsManifest* results_manifest_ptr
 )
 {
-    //  1. handle sentinel
+    //  1. handle sentinels
     if (max_lines < 0) {
         max_lines = this->n_points;
     }
     
+    ResultsManifest local_results_manifest;
+    if (results_manifest_ptr == nullptr) {
+        results_manifest_ptr = &local_results_manifest;
+    }
+    
     //  2. create subdirectories
     write_path += "Storage/";
     if (not std::filesystem::is_directory(write_path)) {
@@ -405,7 +459,7 @@ void Storage :: writeResults(
     std::filesystem::create_directory(write_path);
     
     //  3. write summary
-    this->__writeSummary(write_path);
+    this->__writeSummary(write_path, results_manifest_ptr);
     
     //  4. write time series
     if (max_lines > this->n_points) {
@@ -416,7 +470,8 @@ void Storage :: writeResults(
         this->__writeTimeSeries(
             write_path,
             time_vec_hrs_ptr,
-            max_lines
+            max_lines,
+            results_manifest_ptr
         );
     }
     
@@ -129,9 +129,9 @@ Noncombustion* testConstruct_Hydro(
 ///
 /// \fn void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
 ///
-/// \brief Function to test that the generator and turbine efficiency maps are being
-///     initialized as expected, and that efficiency interpolation is returning the
-///     expected values.
+/// \brief Function to test that the generator and turbine efficiency curves are as
+///     expected, and that (absent resampling) they are evaluated directly, rather than
+///     registered with the Interpolator.
 ///
 /// \param test_hydro_ptr A Noncombustion pointer to the test Hydro object.
 ///
@@ -152,18 +152,14 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
     double query = 0;
     for (size_t i = 0; i < expected_gen_power_ratios.size(); i++) {
         testFloatEquals(
-            test_hydro_ptr->interpolator.interp_map_1D[
-                HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
-            ].x_vec[i],
+            HYDRO_GENERATOR_POWER_RATIOS[i],
             expected_gen_power_ratios[i],
             __FILE__,
             __LINE__
         );
         
         testFloatEquals(
-            test_hydro_ptr->interpolator.interp_map_1D[
-                HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
-            ].y_vec[i],
+            HYDRO_GENERATOR_EFFICIENCIES[i],
             expected_gen_efficiencies[i],
             __FILE__,
             __LINE__
@@ -173,9 +169,15 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
             query = expected_gen_power_ratios[i] + ((double)rand() / RAND_MAX) *
                 (expected_gen_power_ratios[i + 1] - expected_gen_power_ratios[i]);
             
-            test_hydro_ptr->interpolator.interp1D(
-                HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
-                query
+            testLessThanOrEqualTo(
+                hydroEfficiencyLookup(
+                    HYDRO_GENERATOR_POWER_RATIOS,
+                    HYDRO_GENERATOR_EFFICIENCIES,
+                    query
+                ),
+                expected_gen_efficiencies[i + 1],
+                __FILE__,
+                __LINE__
             );
         }
     }
@@ -194,32 +196,38 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
 
     for (size_t i = 0; i < expected_turb_power_ratios.size(); i++) {
         testFloatEquals(
-            test_hydro_ptr->interpolator.interp_map_1D[
-                HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY
-            ].x_vec[i],
+            HYDRO_TURBINE_POWER_RATIOS[i],
             expected_turb_power_ratios[i],
             __FILE__,
             __LINE__
         );
         
         testFloatEquals(
-            test_hydro_ptr->interpolator.interp_map_1D[
-                HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY
-            ].y_vec[i],
+            HYDRO_TURBINE_EFFICIENCIES[HydroTurbineType :: HYDRO_TURBINE_PELTON][i],
             expected_turb_efficiencies[i],
             __FILE__,
             __LINE__
         );
-        
-        if (i < expected_turb_power_ratios.size() - 1) {
-            query = expected_turb_power_ratios[i] + ((double)rand() / RAND_MAX) *
-                (expected_turb_power_ratios[i + 1] - expected_turb_power_ratios[i]);
-            
-            test_hydro_ptr->interpolator.interp1D(
-                HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
-                query
-            );
-        }
+    }
+    
+    //  constant curves are not registered (only the flow to power table is)
+    testTruth(
+        test_hydro_ptr->interpolator.interp_map_1D.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    bool error_flag = true;
+    try {
+        test_hydro_ptr->interpolator.getHandle1D(
+            HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
     }
 
     return;
@@ -229,6 +237,129 @@ void testEfficiencyInterpolation_Hydro(Noncombustion* test_hydro_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSharedTables_Hydro(
+///         Noncombustion* test_hydro_ptr,
+///         HydroInputs hydro_inputs,
+///         std::vector<double>* time_vec_hrs_ptr
+///     )
+///
+/// \brief Function to test that the constant efficiency curves agree with the
+///     resampled efficiency interpolation, and that the flow to power table is built
+///     once and shared (not copied) between Hydro objects with the same parameters.
+///
+/// \param test_hydro_ptr A Noncombustion pointer to the test Hydro object.
+///
+/// \param hydro_inputs The inputs used to construct the test Hydro object.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testSharedTables_Hydro(
+    Noncombustion* test_hydro_ptr,
+    HydroInputs hydro_inputs,
+    std::vector<double>* time_vec_hrs_ptr
+)
+{
+    //  1. constant curves (may be evaluated at compile time)
+    constexpr double zero_load_efficiency = hydroEfficiencyLookup(
+        HYDRO_GENERATOR_POWER_RATIOS,
+        HYDRO_GENERATOR_EFFICIENCIES,
+        0
+    );
+    
+    testFloatEquals(zero_load_efficiency, 0, __FILE__, __LINE__);
+    
+    //  (21 points reproduces the constant curves exactly)
+    HydroInputs resampled_hydro_inputs = hydro_inputs;
+    resampled_hydro_inputs.efficiency_interp_resample_points = 21;
+    
+    Hydro resampled_hydro(8760, 1, resampled_hydro_inputs, time_vec_hrs_ptr);
+    
+    for (int i = 0; i < 1000; i++) {
+        double power_ratio = (double)rand() / RAND_MAX;
+        
+        testFloatEquals(
+            hydroEfficiencyLookup(
+                HYDRO_GENERATOR_POWER_RATIOS,
+                HYDRO_GENERATOR_EFFICIENCIES,
+                power_ratio
+            ),
+            resampled_hydro.interpolator.interp1D(
+                HydroInterpKeys :: GENERATOR_EFFICIENCY_INTERP_KEY,
+                power_ratio
+            ),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            hydroEfficiencyLookup(
+                HYDRO_TURBINE_POWER_RATIOS,
+                HYDRO_TURBINE_EFFICIENCIES[HydroTurbineType :: HYDRO_TURBINE_PELTON],
+                power_ratio
+            ),
+            resampled_hydro.interpolator.interp1D(
+                HydroInterpKeys :: TURBINE_EFFICIENCY_INTERP_KEY,
+                power_ratio
+            ),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  2. flow to power table is shared
+    int n_cache_hits = DataCache::n_cache_hits;
+    int n_derived_builds = DataCache::n_derived_builds;
+    
+    Hydro same_hydro(8760, 1, hydro_inputs, time_vec_hrs_ptr);
+    
+    testFloatEquals(DataCache::n_cache_hits, n_cache_hits + 1, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_derived_builds, n_derived_builds, __FILE__, __LINE__);
+    
+    const InterpolatorStruct1D* flow_to_power_ptr =
+        test_hydro_ptr->interpolator.getHandle1D(
+            HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY
+        ).interp_struct_1D_ptr;
+    
+    testTruth(
+        same_hydro.interpolator.getHandle1D(
+            HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY
+        ).interp_struct_1D_ptr == flow_to_power_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  3. a different parameter set builds its own table
+    hydro_inputs.net_head_m *= 2;
+    
+    Hydro other_hydro(8760, 1, hydro_inputs, time_vec_hrs_ptr);
+    
+    testFloatEquals(
+        DataCache::n_derived_builds,
+        n_derived_builds + 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testLessThan(
+        other_hydro.interpolator.getHandle1D(
+            HydroInterpKeys :: FLOW_TO_POWER_INTERP_KEY
+        ).interp_struct_1D_ptr->x_vec.back(),
+        flow_to_power_ptr->x_vec.back(),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testSharedTables_Hydro() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -375,6 +506,7 @@ int main(int argc, char** argv)
     
     try {
         testEfficiencyInterpolation_Hydro(test_hydro_ptr);
+        testSharedTables_Hydro(test_hydro_ptr, hydro_inputs, &time_vec_hrs);
         testCommit_Hydro(test_hydro_ptr, test_resources_ptr);
     }
 
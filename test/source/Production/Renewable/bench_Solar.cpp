@@ -0,0 +1,160 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+/// \file bench_Solar.cpp
+///
+/// \brief Microbenchmark for the detailed Solar production model.
+///
+/// Times (single core) per-timestep detailed production (computeProductionkW()) against
+/// the block production kernel (computeProductionBlockkW()) over one year of hourly
+/// data, and reports throughput in points per second, along with the largest absolute
+/// difference between the two. Not part of the testing suite; build with
+/// `make bench_Solar`.
+///
+
+
+#include <chrono>
+
+#include "../../../utils/testing_utils.h"
+#include "../../../../header/Production/Renewable/Solar.h"
+
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Production <-- Renewable <-- Solar");
+    std::cout << std::endl;
+    
+    //  1. init time and solar resource vectors (one year, hourly)
+    int n_points = 8760;
+    int n_reps = 200;
+    
+    std::vector<double> time_vec_hrs (n_points, 0);
+    std::vector<double> solar_resource_vec_kWm2 (n_points, 0);
+    
+    for (int i = 0; i < n_points; i++) {
+        time_vec_hrs[i] = i;
+        
+        double hour_of_day = i % 24;
+        
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            0.9 * sin(M_PI * (hour_of_day - 6) / 12)
+        );
+    }
+    
+    //  2. init Solar (detailed), and build the site ephemeris outside of the timing
+    SolarInputs solar_inputs;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    solar_inputs.panel_tilt_deg = 30;
+    
+    Solar bench_solar(n_points, 1, solar_inputs, &time_vec_hrs);
+    
+    std::vector<double> scalar_production_vec_kW (n_points, 0);
+    std::vector<double> block_production_vec_kW (n_points, 0);
+    
+    bench_solar.computeProductionkW(0, 1, 1);
+    
+    //  3. time per-timestep production
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
+    for (int rep = 0; rep < n_reps; rep++) {
+        for (int i = 0; i < n_points; i++) {
+            scalar_production_vec_kW[i] = bench_solar.computeProductionkW(
+                i,
+                1,
+                solar_resource_vec_kWm2[i]
+            );
+        }
+    }
+    
+    double scalar_time_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    
+    //  4. time block production
+    start = std::chrono::steady_clock::now();
+    
+    for (int rep = 0; rep < n_reps; rep++) {
+        bench_solar.computeProductionBlockkW(
+            0,
+            &solar_resource_vec_kWm2,
+            &block_production_vec_kW
+        );
+    }
+    
+    double block_time_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    
+    //  5. report
+    double max_abs_diff_kW = 0;
+    
+    for (int i = 0; i < n_points; i++) {
+        max_abs_diff_kW = std::max(
+            max_abs_diff_kW,
+            fabs(block_production_vec_kW[i] - scalar_production_vec_kW[i])
+        );
+    }
+    
+    double n_evaluations = (double)n_points * n_reps;
+    
+    std::cout << "\tSIMD path:  ";
+    #if defined(__AVX__)
+        std::cout << "AVX" << std::endl;
+    #elif defined(__SSE2__) || defined(_M_X64)
+        std::cout << "SSE2" << std::endl;
+    #else
+        std::cout << "scalar" << std::endl;
+    #endif
+    
+    std::cout << "\tper-timestep:  " << n_evaluations / scalar_time_s <<
+        " points/s" << std::endl;
+    std::cout << "\tblock:         " << n_evaluations / block_time_s <<
+        " points/s" << std::endl;
+    std::cout << "\tspeedup:       " << scalar_time_s / block_time_s << std::endl;
+    std::cout << "\tmax |block - per-timestep|:  " << max_abs_diff_kW << " kW" <<
+        std::endl;
+    std::cout << std::endl;
+    
+    return 0;
+}   /* main() */
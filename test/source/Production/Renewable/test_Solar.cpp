@@ -472,6 +472,536 @@ void testDetailed_Solar(void)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testStateless_Solar(void)
+///
+/// \brief Function to test that (detailed) solar production is a pure function of the
+///     timestep, i.e., that it does not depend on call order or on commit().
+///
+
+void testStateless_Solar(void)
+{
+    // init time and solar resource vectors (two days, starting mid-series)
+    std::vector<double> time_vec_hrs (48, 0);
+    std::vector<double> solar_resource_vec_kWm2 (48, 0);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] = 100 + i;
+        
+        double hour_of_day = (int)time_vec_hrs[i] % 24;
+        
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            0.8 * sin(M_PI * (hour_of_day - 6) / 12)
+        );
+    }
+    
+    // init Solar (detailed)
+    SolarInputs solar_inputs;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    solar_inputs.panel_azimuth_deg = 180;
+    solar_inputs.panel_tilt_deg = 30;
+    
+    Solar test_solar(
+        time_vec_hrs.size(),
+        1,
+        solar_inputs,
+        &time_vec_hrs
+    );
+    
+    // check Julian day
+    testFloatEquals(test_solar.getJulianDay(0), 8766, __FILE__, __LINE__);
+    testFloatEquals(test_solar.getJulianDay(24), 8767, __FILE__, __LINE__);
+    
+    // in order, with commit
+    std::vector<double> production_vec_kW (time_vec_hrs.size(), 0);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        production_vec_kW[i] = test_solar.computeProductionkW(
+            i, 1, solar_resource_vec_kWm2[i]
+        );
+        
+        test_solar.commit(i, 1, production_vec_kW[i], 100);
+    }
+    
+    testGreaterThan(
+        *std::max_element(production_vec_kW.begin(), production_vec_kW.end()),
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    // in reverse order, without commit (same results)
+    for (int i = time_vec_hrs.size() - 1; i >= 0; i--) {
+        testFloatEquals(
+            test_solar.computeProductionkW(i, 1, solar_resource_vec_kWm2[i]),
+            production_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testStateless_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSharedEphemeris_Solar(void)
+///
+/// \brief Function to test that detailed Solar assets at the same site share one solar
+///     ephemeris (built once), and that sharing does not change production.
+///
+
+void testSharedEphemeris_Solar(void)
+{
+    // init time and solar resource vectors
+    std::vector<double> time_vec_hrs (48, 0);
+    std::vector<double> solar_resource_vec_kWm2 (48, 0);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] = i;
+        
+        double hour_of_day = (int)time_vec_hrs[i] % 24;
+        
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            0.8 * sin(M_PI * (hour_of_day - 6) / 12)
+        );
+    }
+    
+    // init Solar (detailed), three at one site (different orientations) and one at
+    // another site
+    SolarInputs solar_inputs;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    solar_inputs.panel_tilt_deg = 30;
+    
+    std::vector<Solar*> solar_ptr_vec;
+    
+    for (int i = 0; i < 3; i++) {
+        solar_inputs.panel_azimuth_deg = 90 + 90 * i;
+        
+        solar_ptr_vec.push_back(
+            new Solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs)
+        );
+    }
+    
+    solar_inputs.latitude_deg = 60;
+    
+    solar_ptr_vec.push_back(
+        new Solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs)
+    );
+    
+    // compute production, ephemeris built once per site
+    DataCache::clear();
+    
+    std::vector<std::vector<double>> production_vec_kW (
+        solar_ptr_vec.size(),
+        std::vector<double>(time_vec_hrs.size(), 0)
+    );
+    
+    for (size_t j = 0; j < solar_ptr_vec.size(); j++) {
+        for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+            production_vec_kW[j][i] = solar_ptr_vec[j]->computeProductionkW(
+                i, 1, solar_resource_vec_kWm2[i]
+            );
+        }
+    }
+    
+    testFloatEquals(DataCache::n_derived_builds, 2, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_cache_hits, 2, __FILE__, __LINE__);
+    
+    // new time series (e.g., next streaming window), stale ephemeris replaced rather
+    // than accumulated
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] += 48;
+    }
+    
+    solar_ptr_vec[0]->computeProductionkW(12, 1, solar_resource_vec_kWm2[12]);
+    
+    testFloatEquals(DataCache::n_derived_builds, 3, __FILE__, __LINE__);
+    testFloatEquals(DataCache::getNumEntries(), 2, __FILE__, __LINE__);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] -= 48;
+    }
+    
+    // with sharing disabled, same production
+    DataCache::enabled = false;
+    
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.panel_azimuth_deg = 180;
+    
+    Solar unshared_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        testFloatEquals(
+            unshared_solar.computeProductionkW(i, 1, solar_resource_vec_kWm2[i]),
+            production_vec_kW[1][i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    DataCache::enabled = true;
+    DataCache::clear();
+    
+    for (size_t j = 0; j < solar_ptr_vec.size(); j++) {
+        delete solar_ptr_vec[j];
+    }
+    
+    return;
+}   /* testSharedEphemeris_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBlockKernel_Solar(void)
+///
+/// \brief Function to test that the block production kernel agrees with per-timestep
+///     production (to within 1e-9 * capacity_kW) for both production models and for
+///     several array orientations.
+///
+
+void testBlockKernel_Solar(void)
+{
+    // init time and solar resource vectors (one year, hourly, odd block sizes)
+    std::vector<double> time_vec_hrs (8760, 0);
+    std::vector<double> solar_resource_vec_kWm2 (8760, 0);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] = i;
+        
+        double hour_of_day = (int)time_vec_hrs[i] % 24;
+        
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            0.9 * sin(M_PI * (hour_of_day - 6) / 12)
+        );
+    }
+    
+    SolarInputs solar_inputs;
+    
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    
+    std::vector<double> production_vec_kW;
+    
+    for (int power_model = 0; power_model < 2; power_model++) {
+        solar_inputs.power_model = (SolarPowerProductionModel)power_model;
+        
+        for (int k = 0; k < 4; k++) {
+            solar_inputs.panel_tilt_deg = 15 * k;
+            solar_inputs.panel_azimuth_deg = 90 + 60 * k;
+            
+            Solar test_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+            
+            // whole series, then an odd block starting mid-series
+            test_solar.computeProductionBlockkW(
+                0,
+                &solar_resource_vec_kWm2,
+                &production_vec_kW
+            );
+            
+            testFloatEquals(
+                production_vec_kW.size(),
+                time_vec_hrs.size(),
+                __FILE__,
+                __LINE__
+            );
+            
+            for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+                testLessThanOrEqualTo(
+                    fabs(
+                        production_vec_kW[i] -
+                        test_solar.computeProductionkW(i, 1, solar_resource_vec_kWm2[i])
+                    ),
+                    1e-9 * test_solar.capacity_kW,
+                    __FILE__,
+                    __LINE__
+                );
+            }
+            
+            std::vector<double> block_resource_vec_kWm2 (
+                solar_resource_vec_kWm2.begin() + 4001,
+                solar_resource_vec_kWm2.begin() + 4008
+            );
+            
+            test_solar.computeProductionBlockkW(
+                4001,
+                &block_resource_vec_kWm2,
+                &production_vec_kW
+            );
+            
+            for (size_t i = 0; i < block_resource_vec_kWm2.size(); i++) {
+                testLessThanOrEqualTo(
+                    fabs(
+                        production_vec_kW[i] -
+                        test_solar.computeProductionkW(
+                            4001 + i,
+                            1,
+                            block_resource_vec_kWm2[i]
+                        )
+                    ),
+                    1e-9 * test_solar.capacity_kW,
+                    __FILE__,
+                    __LINE__
+                );
+            }
+        }
+    }
+    
+    // block outside of the modelling time series
+    Solar test_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+    
+    try {
+        test_solar.computeProductionBlockkW(
+            8000,
+            &solar_resource_vec_kWm2,
+            &production_vec_kW
+        );
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    catch (...) {
+        // Task failed successfully! =P
+    }
+    
+    return;
+}   /* testBlockKernel_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testMultiPlane_Solar(void)
+///
+/// \brief Function to test that a multi-plane Solar asset reproduces the production of
+///     equivalent single-plane assets (per plane, and in total), and that bad plane
+///     inputs are handled as expected.
+///
+
+void testMultiPlane_Solar(void)
+{
+    // init time and solar resource vectors
+    std::vector<double> time_vec_hrs (72, 0);
+    std::vector<double> solar_resource_vec_kWm2 (72, 0);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        time_vec_hrs[i] = i;
+        
+        double hour_of_day = (int)time_vec_hrs[i] % 24;
+        
+        solar_resource_vec_kWm2[i] = std::max(
+            0.0,
+            1.1 * sin(M_PI * (hour_of_day - 6) / 12)
+        );
+    }
+    
+    // init Solar (detailed), east/west racking (60/40 capacity split)
+    SolarInputs solar_inputs;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    solar_inputs.julian_day = 8766;
+    solar_inputs.latitude_deg = 50;
+    solar_inputs.longitude_deg = -125;
+    solar_inputs.renewable_inputs.production_inputs.capacity_kW = 100;
+    
+    solar_inputs.plane_azimuth_deg_vec = {90, 270};
+    solar_inputs.plane_tilt_deg_vec = {10, 25};
+    solar_inputs.plane_capacity_fraction_vec = {0.6, 0.4};
+    
+    Solar test_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+    
+    testFloatEquals(test_solar.n_planes, 2, __FILE__, __LINE__);
+    testFloatEquals(test_solar.plane_capacity_kW_vec[0], 60, __FILE__, __LINE__);
+    testFloatEquals(test_solar.plane_capacity_kW_vec[1], 40, __FILE__, __LINE__);
+    
+    // equivalent single-plane assets
+    solar_inputs.plane_azimuth_deg_vec.clear();
+    solar_inputs.plane_tilt_deg_vec.clear();
+    solar_inputs.plane_capacity_fraction_vec.clear();
+    
+    solar_inputs.panel_azimuth_deg = 90;
+    solar_inputs.panel_tilt_deg = 10;
+    solar_inputs.renewable_inputs.production_inputs.capacity_kW = 60;
+    
+    Solar east_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+    
+    solar_inputs.panel_azimuth_deg = 270;
+    solar_inputs.panel_tilt_deg = 25;
+    solar_inputs.renewable_inputs.production_inputs.capacity_kW = 40;
+    
+    Solar west_solar(time_vec_hrs.size(), 1, solar_inputs, &time_vec_hrs);
+    
+    testFloatEquals(east_solar.n_planes, 1, __FILE__, __LINE__);
+    testTruth(east_solar.plane_production_vec_kW.empty(), __FILE__, __LINE__);
+    
+    // per-timestep production, per plane and in total
+    double total_production_kWh = 0;
+    double east_total_production_kWh = 0;
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        double production_kW = test_solar.computeProductionkW(
+            i,
+            1,
+            solar_resource_vec_kWm2[i]
+        );
+        
+        double east_production_kW = east_solar.computeProductionkW(
+            i,
+            1,
+            solar_resource_vec_kWm2[i]
+        );
+        
+        double west_production_kW = west_solar.computeProductionkW(
+            i,
+            1,
+            solar_resource_vec_kWm2[i]
+        );
+        
+        testFloatEquals(
+            test_solar.plane_production_vec_kW[0][i],
+            east_production_kW,
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            test_solar.plane_production_vec_kW[1][i],
+            west_production_kW,
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            production_kW,
+            east_production_kW + west_production_kW,
+            __FILE__,
+            __LINE__
+        );
+        
+        test_solar.commit(i, 1, production_kW, 1000);
+        total_production_kWh += production_kW;
+        
+        east_solar.commit(i, 1, east_production_kW, 1000);
+        east_total_production_kWh += east_production_kW;
+    }
+    
+    testGreaterThan(total_production_kWh, 0, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        test_solar.plane_total_production_kWh[0] +
+        test_solar.plane_total_production_kWh[1],
+        total_production_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        east_solar.plane_total_production_kWh[0],
+        east_total_production_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    // block production
+    std::vector<double> production_vec_kW;
+    
+    test_solar.computeProductionBlockkW(0, &solar_resource_vec_kWm2, &production_vec_kW);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        testLessThanOrEqualTo(
+            fabs(
+                production_vec_kW[i] -
+                test_solar.computeProductionkW(i, 1, solar_resource_vec_kWm2[i])
+            ),
+            1e-9 * test_solar.capacity_kW,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    east_solar.computeProductionBlockkW(0, &solar_resource_vec_kWm2, &production_vec_kW);
+    
+    for (size_t i = 0; i < time_vec_hrs.size(); i++) {
+        testLessThanOrEqualTo(
+            fabs(
+                production_vec_kW[i] -
+                east_solar.computeProductionkW(i, 1, solar_resource_vec_kWm2[i])
+            ),
+            1e-9 * east_solar.capacity_kW,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    // bad plane inputs (mismatched sizes, fractions not summing to 1)
+    bool error_flag = true;
+    
+    try {
+        SolarInputs bad_solar_inputs;
+        
+        bad_solar_inputs.plane_azimuth_deg_vec = {90, 270};
+        bad_solar_inputs.plane_tilt_deg_vec = {10};
+        
+        Solar bad_solar(time_vec_hrs.size(), 1, bad_solar_inputs, &time_vec_hrs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        SolarInputs bad_solar_inputs;
+        
+        bad_solar_inputs.plane_azimuth_deg_vec = {90, 270};
+        bad_solar_inputs.plane_tilt_deg_vec = {10, 10};
+        bad_solar_inputs.plane_capacity_fraction_vec = {0.5, 0.6};
+        
+        Solar bad_solar(time_vec_hrs.size(), 1, bad_solar_inputs, &time_vec_hrs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testMultiPlane_Solar() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -704,6 +1234,10 @@ int main(int argc, char** argv)
         );
         
         testDetailed_Solar();
+        testStateless_Solar();
+        testSharedEphemeris_Solar();
+        testBlockKernel_Solar();
+        testMultiPlane_Solar();
         
         testProductionConstraint_Solar(test_solar_ptr);
         
@@ -157,6 +157,119 @@ void testBadConstruct_Tidal(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testLookup_Tidal(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that the LOOKUP power production model is behaving as
+///     expected (a non-uniformly tabulated power curve is pre-sampled onto a uniform
+///     grid, once, and shared between turbines).
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testLookup_Tidal(std::vector<double>* time_vec_hrs_ptr)
+{
+    TidalInputs tidal_inputs;
+    
+    tidal_inputs.power_model = TidalPowerProductionModel :: TIDAL_POWER_LOOKUP;
+    tidal_inputs.path_2_normalized_power_curve =
+        "data/test/interpolation/tidal_turbine_normalized_power_curve.csv";
+    
+    DataCache::clear();
+    
+    Tidal test_tidal(8760, 1, tidal_inputs, time_vec_hrs_ptr);
+    Tidal other_tidal(8760, 1, tidal_inputs, time_vec_hrs_ptr);
+    
+    testTruth(test_tidal.power_model_string == "LOOKUP", __FILE__, __LINE__);
+    
+    // pre-sampled at the resolution of the narrowest interval (0.25 m/s), once
+    testFloatEquals(test_tidal.power_curve_resample_points, 17, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_derived_builds, 1, __FILE__, __LINE__);
+    
+    testTruth(
+        test_tidal.power_curve_handle.interp_struct_1D_ptr ==
+            other_tidal.power_curve_handle.interp_struct_1D_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    // every power curve point lies on the grid
+    testFloatEquals(
+        test_tidal.power_curve_handle.interp_struct_1D_ptr->max_resample_deviation,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    // on, and between, power curve points (pre-sampling is exact here)
+    testFloatEquals(
+        test_tidal.computeProductionkW(0, 1, 1.5),
+        0.2 * test_tidal.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_tidal.computeProductionkW(0, 1, 1.75),
+        0.325 * test_tidal.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        other_tidal.computeProductionkW(0, 1, 2.2),
+        0.59 * other_tidal.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    // above cut-out
+    testFloatEquals(test_tidal.computeProductionkW(0, 1, 4.5), 0, __FILE__, __LINE__);
+    
+    // a coarse (given) resolution moves power curve points off the grid
+    TidalInputs coarse_tidal_inputs = tidal_inputs;
+    coarse_tidal_inputs.power_curve_resample_points = 6;
+    
+    Tidal coarse_tidal(8760, 1, coarse_tidal_inputs, time_vec_hrs_ptr);
+    
+    testFloatEquals(coarse_tidal.power_curve_resample_points, 6, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_derived_builds, 2, __FILE__, __LINE__);
+    
+    testGreaterThan(
+        coarse_tidal.power_curve_handle.interp_struct_1D_ptr->max_resample_deviation,
+        RENEWABLE_POWER_CURVE_MAX_RESAMPLE_DEVIATION,
+        __FILE__,
+        __LINE__
+    );
+    
+    DataCache::clear();
+    
+    // bad resample points
+    bool error_flag = true;
+    
+    try {
+        TidalInputs bad_tidal_inputs = tidal_inputs;
+        bad_tidal_inputs.power_curve_resample_points = 1;
+        
+        Tidal bad_tidal(8760, 1, bad_tidal_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testLookup_Tidal() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -380,6 +493,7 @@ int main(int argc, char** argv)
     
     try {
         testBadConstruct_Tidal(&time_vec_hrs);
+        testLookup_Tidal(&time_vec_hrs);
         
         testProductionConstraint_Tidal(test_tidal_ptr);
         
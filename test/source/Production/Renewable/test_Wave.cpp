@@ -468,6 +468,154 @@ void testProductionLookup_Wave(Renewable* test_wave_lookup_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSeaStateMemo_Wave(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that the quantized sea state memo is shared between Wave
+///     objects using the same performance matrix, and is returning the expected
+///     values.
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testSeaStateMemo_Wave(std::vector<double>* time_vec_hrs_ptr)
+{
+    WaveInputs wave_inputs;
+    
+    wave_inputs.power_model = WavePowerProductionModel :: WAVE_POWER_LOOKUP;
+    wave_inputs.path_2_normalized_performance_matrix =
+        "data/test/interpolation/wave_energy_converter_normalized_performance_matrix.csv";
+    
+    Wave test_wave_direct(8760, 1, wave_inputs, time_vec_hrs_ptr);
+    
+    wave_inputs.use_sea_state_memo = true;
+    
+    int n_derived_builds = DataCache::n_derived_builds;
+    
+    Wave test_wave_memo_1(8760, 1, wave_inputs, time_vec_hrs_ptr);
+    Wave test_wave_memo_2(8760, 1, wave_inputs, time_vec_hrs_ptr);
+    
+    // memo built once, and shared
+    testFloatEquals(
+        DataCache::n_derived_builds,
+        n_derived_builds + 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(test_wave_memo_1.use_sea_state_memo, __FILE__, __LINE__);
+    testTruth(not test_wave_direct.use_sea_state_memo, __FILE__, __LINE__);
+    
+    // sea states at the memo resolution are as interpolated
+    std::vector<double> significant_wave_height_vec_m = {0.39, 1.53, 3.72, 6.96, 7.75};
+    std::vector<double> energy_period_vec_s = {5.46, 9.45, 12.94, 17.18, 19.17};
+    
+    for (size_t i = 0; i < energy_period_vec_s.size(); i++) {
+        for (size_t j = 0; j < significant_wave_height_vec_m.size(); j++) {
+            double expected_production_kW = test_wave_direct.computeProductionkW(
+                0,
+                1,
+                significant_wave_height_vec_m[j],
+                energy_period_vec_s[i]
+            );
+            
+            testFloatEquals(
+                test_wave_memo_1.computeProductionkW(
+                    0,
+                    1,
+                    significant_wave_height_vec_m[j],
+                    energy_period_vec_s[i]
+                ),
+                expected_production_kW,
+                __FILE__,
+                __LINE__
+            );
+            
+            // second asset hits what the first filled
+            testFloatEquals(
+                test_wave_memo_2.computeProductionkW(
+                    0,
+                    1,
+                    significant_wave_height_vec_m[j],
+                    energy_period_vec_s[i]
+                ),
+                expected_production_kW,
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    // other sea states are quantized to the memo resolution
+    testFloatEquals(
+        test_wave_memo_1.computeProductionkW(0, 1, 3.7212, 12.9381),
+        test_wave_direct.computeProductionkW(0, 1, 3.72, 12.94),
+        __FILE__,
+        __LINE__
+    );
+    
+    // sea states outside of the performance matrix are handled as without memo
+    bool error_flag = true;
+    
+    try {
+        test_wave_memo_1.computeProductionkW(0, 1, 10, 10);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    // (including those which would quantize onto an edge of the memo)
+    std::vector<double> near_significant_wave_height_vec_m = {0.246, 7.754, 3.72, 3.72};
+    std::vector<double> near_energy_period_vec_s = {12.94, 12.94, 4.996, 20.004};
+    
+    for (size_t i = 0; i < near_energy_period_vec_s.size(); i++) {
+        error_flag = true;
+        
+        try {
+            test_wave_memo_1.computeProductionkW(
+                0,
+                1,
+                near_significant_wave_height_vec_m[i],
+                near_energy_period_vec_s[i]
+            );
+            
+            error_flag = false;
+        } catch (...) {
+            // Task failed successfully! =P
+        }
+        if (not error_flag) {
+            expectedErrorNotDetected(__FILE__, __LINE__);
+        }
+    }
+    
+    // bad memo resolution
+    try {
+        WaveInputs bad_wave_inputs = wave_inputs;
+        bad_wave_inputs.memo_resolution_energy_period_s = 0;
+        
+        Wave bad_wave(8760, 1, bad_wave_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testSeaStateMemo_Wave() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -503,6 +651,7 @@ int main(int argc, char** argv)
         testEconomics_Wave(test_wave_ptr);
         
         testProductionLookup_Wave(test_wave_lookup_ptr);
+        testSeaStateMemo_Wave(&time_vec_hrs);
     }
 
 
@@ -157,6 +157,268 @@ void testBadConstruct_Wind(std::vector<double>* time_vec_hrs_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testLookup_Wind(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that the LOOKUP power production model is behaving as
+///     expected (a uniformly tabulated power curve is used as given).
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testLookup_Wind(std::vector<double>* time_vec_hrs_ptr)
+{
+    WindInputs wind_inputs;
+    
+    wind_inputs.power_model = WindPowerProductionModel :: WIND_POWER_LOOKUP;
+    wind_inputs.path_2_normalized_power_curve =
+        "data/test/interpolation/wind_turbine_normalized_power_curve.csv";
+    
+    Wind test_wind(8760, 1, wind_inputs, time_vec_hrs_ptr);
+    
+    testTruth(test_wind.power_model_string == "LOOKUP", __FILE__, __LINE__);
+    testFloatEquals(test_wind.power_curve_resample_points, 0, __FILE__, __LINE__);
+    
+    // on, and between, power curve points
+    testFloatEquals(
+        test_wind.computeProductionkW(0, 1, 10),
+        0.75 * test_wind.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_wind.computeProductionkW(0, 1, 10.5),
+        0.815 * test_wind.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_wind.computeProductionkW(0, 1, 25),
+        test_wind.capacity_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    // above cut-out, and no resource
+    testFloatEquals(test_wind.computeProductionkW(0, 1, 25.01), 0, __FILE__, __LINE__);
+    testFloatEquals(test_wind.computeProductionkW(0, 1, -1), 0, __FILE__, __LINE__);
+    
+    // no power curve given
+    bool error_flag = true;
+    
+    try {
+        WindInputs bad_wind_inputs;
+        bad_wind_inputs.power_model = WindPowerProductionModel :: WIND_POWER_LOOKUP;
+        
+        Wind bad_wind(8760, 1, bad_wind_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testLookup_Wind() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testFarm_Wind(std::vector<double>* time_vec_hrs_ptr)
+///
+/// \brief Function to test that a wind farm of identical turbines is behaving as
+///     expected (i.e., is equivalent to the sum of its individual turbines).
+///
+/// \param time_vec_hrs_ptr A pointer to the vector containing the modelling time series.
+///
+
+void testFarm_Wind(std::vector<double>* time_vec_hrs_ptr)
+{
+    WindInputs farm_inputs;
+    
+    farm_inputs.renewable_inputs.production_inputs.capacity_kW = 3000;
+    farm_inputs.n_turbines = 3;
+    farm_inputs.turbine_factor_vec = {1, 0.9, 0.6};
+    
+    Wind test_farm(8760, 1, farm_inputs, time_vec_hrs_ptr);
+    
+    testFloatEquals(test_farm.n_turbines, 3, __FILE__, __LINE__);
+    testFloatEquals(test_farm.turbine_capacity_kW, 1000, __FILE__, __LINE__);
+    testFloatEquals(test_farm.mean_turbine_factor, 2.5 / 3, __FILE__, __LINE__);
+    
+    WindInputs turbine_inputs;
+    
+    turbine_inputs.renewable_inputs.production_inputs.capacity_kW = 1000;
+    
+    Wind test_turbine(8760, 1, turbine_inputs, time_vec_hrs_ptr);
+    
+    // generic costs are per turbine
+    testFloatEquals(
+        test_farm.capital_cost,
+        3 * test_turbine.capital_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_farm.operation_maintenance_cost_kWh,
+        test_turbine.operation_maintenance_cost_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    // farm production is the sum of turbine production
+    std::vector<double> wind_resource_vec_ms = {0, 3, 7.5, 12, 14, 20, 30};
+    
+    for (size_t i = 0; i < wind_resource_vec_ms.size(); i++) {
+        double turbine_production_kW = test_turbine.computeProductionkW(
+            i,
+            1,
+            wind_resource_vec_ms[i]
+        );
+        
+        double farm_production_kW = test_farm.computeProductionkW(
+            i,
+            1,
+            wind_resource_vec_ms[i]
+        );
+        
+        testFloatEquals(
+            farm_production_kW,
+            2.5 * turbine_production_kW,
+            __FILE__,
+            __LINE__
+        );
+        
+        test_farm.commit(i, 1, farm_production_kW, 1e6);
+        
+        //  per-turbine detail, on demand
+        double sum_kW = 0;
+        
+        for (int j = 0; j < test_farm.n_turbines; j++) {
+            testFloatEquals(
+                test_farm.getTurbineProductionkW(j, i),
+                test_farm.turbine_factor_vec[j] * turbine_production_kW,
+                __FILE__,
+                __LINE__
+            );
+            
+            sum_kW += test_farm.getTurbineProductionkW(j, i);
+        }
+        
+        testFloatEquals(
+            sum_kW,
+            test_farm.production_vec_kW[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    // turbine not in farm
+    bool error_flag = true;
+    
+    try {
+        test_farm.getTurbineProductionkW(3, 0);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    // timestep not in modelling time series
+    error_flag = true;
+    
+    try {
+        test_farm.getTurbineProductionkW(0, test_farm.n_points);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    error_flag = true;
+    
+    try {
+        test_farm.getTurbineProductionkW(0, -1);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    // turbine factors of wrong length
+    try {
+        WindInputs bad_wind_inputs;
+        bad_wind_inputs.n_turbines = 2;
+        bad_wind_inputs.turbine_factor_vec = {1, 1, 1};
+        
+        Wind bad_wind(8760, 1, bad_wind_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    // turbine factor out of bounds
+    try {
+        WindInputs bad_wind_inputs;
+        bad_wind_inputs.n_turbines = 2;
+        bad_wind_inputs.turbine_factor_vec = {1, 1.1};
+        
+        Wind bad_wind(8760, 1, bad_wind_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    // no turbines
+    try {
+        WindInputs bad_wind_inputs;
+        bad_wind_inputs.n_turbines = 0;
+        
+        Wind bad_wind(8760, 1, bad_wind_inputs, time_vec_hrs_ptr);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testFarm_Wind() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -202,6 +464,55 @@ void testProductionConstraint_Wind(Renewable* test_wind_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testProductionSeries_Wind(Renewable* test_wind_ptr)
+///
+/// \brief Function to test that computing production over a whole series gives
+///     exactly the same production as computing it timestep by timestep.
+///
+/// \param test_wind_ptr A Renewable pointer to the test Wind object.
+///
+
+void testProductionSeries_Wind(Renewable* test_wind_ptr)
+{
+    std::vector<double> wind_resource_vec_ms(48, 0);
+    
+    for (size_t i = 0; i < wind_resource_vec_ms.size(); i++) {
+        wind_resource_vec_ms[i] = 0.75 * i - 2;
+    }
+    
+    std::vector<double> production_vec_kW;
+    
+    test_wind_ptr->computeProductionSeries(
+        24,
+        &wind_resource_vec_ms,
+        &production_vec_kW
+    );
+    
+    testTruth(
+        production_vec_kW.size() == wind_resource_vec_ms.size(),
+        __FILE__,
+        __LINE__
+    );
+    
+    for (size_t i = 0; i < wind_resource_vec_ms.size(); i++) {
+        testTruth(
+            production_vec_kW[i] ==
+                test_wind_ptr->computeProductionkW(24 + i, 1, wind_resource_vec_ms[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testProductionSeries_Wind() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 ///
@@ -380,8 +691,11 @@ int main(int argc, char** argv)
     
     try {
         testBadConstruct_Wind(&time_vec_hrs);
+        testLookup_Wind(&time_vec_hrs);
+        testFarm_Wind(&time_vec_hrs);
         
         testProductionConstraint_Wind(test_wind_ptr);
+        testProductionSeries_Wind(test_wind_ptr);
         
         testCommit_Wind(test_wind_ptr);
         testEconomics_Wind(test_wind_ptr);
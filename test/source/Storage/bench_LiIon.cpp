@@ -0,0 +1,130 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file bench_LiIon.cpp
+///
+/// \brief Microbenchmark for the LiIon degradation model.
+///
+/// Times (single core) a battery heavy, one year, hourly cycle (repeated) of commits under the
+/// exact degradation model, the fast degradation engine, and the fast degradation
+/// engine with a 24 hour evaluation interval, and reports throughput in commits per
+/// second, along with the relative error in the loss of state of health. Not part of
+/// the testing suite; build with `make bench_LiIon`.
+///
+
+
+#include <chrono>
+
+#include "../../utils/testing_utils.h"
+#include "../../../header/Storage/LiIon.h"
+
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tBenchmarking Storage <-- LiIon");
+    std::cout << std::endl;
+    
+    //  1. init assets (replacement disabled, so that states of health are comparable)
+    int n_points = 8760;
+    int n_reps = 250;
+    double dt_hrs = 1;
+    
+    LiIonInputs liion_inputs;
+    liion_inputs.replace_SOH = 0;
+    
+    std::string label_array[3] = {"exact", "fast", "fast (24 hr)"};
+    double time_s_array[3] = {0, 0, 0};
+    double SOH_array[3] = {0, 0, 0};
+    
+    //  2. time cycling (charge for six hours, then discharge for six hours)
+    for (int j = 0; j < 3; j++) {
+        liion_inputs.fast_degradation = j > 0;
+        liion_inputs.degradation_eval_interval_hrs = j > 1 ? 24 : 0;
+        
+        for (int rep = 0; rep < n_reps; rep++) {
+            LiIon bench_liion(n_points, 1, liion_inputs);
+            
+            std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
+            
+            for (int i = 0; i < n_points; i++) {
+                if ((i / 6) % 2 == 0) {
+                    bench_liion.commitCharge(
+                        i,
+                        dt_hrs,
+                        bench_liion.getAcceptablekW(dt_hrs)
+                    );
+                }
+                
+                else {
+                    bench_liion.commitDischarge(
+                        i,
+                        dt_hrs,
+                        bench_liion.getAvailablekW(dt_hrs),
+                        1e6
+                    );
+                }
+            }
+            
+            time_s_array[j] += std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start
+            ).count();
+            
+            SOH_array[j] = bench_liion.SOH;
+        }
+    }
+    
+    //  3. report
+    double n_commits = (double)n_points * n_reps;
+    
+    for (int j = 0; j < 3; j++) {
+        std::cout << "\t" << label_array[j] << ":  " << n_commits / time_s_array[j] <<
+            " commits/s  (speedup " << time_s_array[0] / time_s_array[j] <<
+            ",  SOH " << SOH_array[j] << ",  relative SOH loss error " <<
+            (1 - SOH_array[j]) / (1 - SOH_array[0]) - 1 << ")" << std::endl;
+    }
+    
+    std::cout << std::endl;
+    
+    return 0;
+}   /* main() */
@@ -325,6 +325,130 @@ void testCommitDischarge_LiIon(Storage* test_liion_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testFastDegradation_LiIon(void)
+///
+/// \brief Function to test that the fast degradation engine (with and without an
+///     evaluation interval) reproduces the state of health of the exact degradation
+///     model over a battery heavy, one year, hourly run. The two differ by the time
+///     discretization error of the exact model only, since the fast degradation
+///     engine integrates the state of health analytically. Also tests that degradation
+///     which is still pending at the end of the run is applied at the last timestep.
+///
+
+void testFastDegradation_LiIon(void)
+{
+    //  1. bad evaluation interval
+    bool error_flag = true;
+    try {
+        LiIonInputs bad_liion_inputs;
+        bad_liion_inputs.fast_degradation = true;
+        bad_liion_inputs.degradation_eval_interval_hrs = -1;
+        
+        LiIon bad_liion(8760, 1, bad_liion_inputs);
+        
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  2. construct exact and fast assets (replacement disabled, so that states of
+    //     health are comparable throughout)
+    int n_points = 8760;
+    double dt_hrs = 1;
+    
+    LiIonInputs liion_inputs;
+    liion_inputs.replace_SOH = 0;
+    
+    LiIon exact_liion(n_points, 1, liion_inputs);
+    
+    liion_inputs.fast_degradation = true;
+    LiIon fast_liion(n_points, 1, liion_inputs);
+    
+    liion_inputs.degradation_eval_interval_hrs = 24;
+    LiIon interval_liion(n_points, 1, liion_inputs);
+    
+    liion_inputs.degradation_eval_interval_hrs = 2 * n_points * dt_hrs;
+    LiIon long_interval_liion(n_points, 1, liion_inputs);
+    
+    LiIon* liion_ptr_array[4] = {
+        &exact_liion,
+        &fast_liion,
+        &interval_liion,
+        &long_interval_liion
+    };
+    
+    //  3. cycle (charge for six hours, then discharge for six hours), at the power
+    //     the exact asset can accept/make available
+    for (int i = 0; i < n_points; i++) {
+        if ((i / 6) % 2 == 0) {
+            double charging_kW = exact_liion.getAcceptablekW(dt_hrs);
+            
+            for (int j = 0; j < 4; j++) {
+                liion_ptr_array[j]->commitCharge(i, dt_hrs, charging_kW);
+            }
+        }
+        
+        else {
+            double discharging_kW = exact_liion.getAvailablekW(dt_hrs);
+            
+            for (int j = 0; j < 4; j++) {
+                liion_ptr_array[j]->commitDischarge(i, dt_hrs, discharging_kW, 1e6);
+            }
+        }
+    }
+    
+    //  4. check states of health (relative to loss of state of health)
+    testLessThan(exact_liion.SOH, 0.9, __FILE__, __LINE__);
+    
+    for (int j = 1; j < 4; j++) {
+        testLessThanOrEqualTo(
+            fabs((1 - liion_ptr_array[j]->SOH) / (1 - exact_liion.SOH) - 1),
+            1e-4,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  5. check that the evaluation interval only ever delays degradation (up to
+    //     round-off)
+    for (int i = 0; i < n_points; i++) {
+        testLessThanOrEqualTo(
+            fast_liion.SOH_vec[i] - 1e-12,
+            interval_liion.SOH_vec[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  6. check that degradation still pending at the end of the run is applied at the
+    //     last timestep
+    testFloatEquals(
+        long_interval_liion.SOH_vec[n_points - 2],
+        1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        long_interval_liion.SOH_vec[n_points - 1],
+        fast_liion.SOH_vec[n_points - 1],
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testFastDegradation_LiIon() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -350,6 +474,8 @@ int main(int argc, char** argv)
         
         testCommitCharge_LiIon(test_liion_ptr);
         testCommitDischarge_LiIon(test_liion_ptr);
+        
+        testFastDegradation_LiIon();
     }
 
 
@@ -0,0 +1,274 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+///
+///
+/// \file bench_FastMath.cpp
+///
+/// \brief Validation report for fast kernels mode (see ModelInputs::fast_kernels).
+///
+/// Builds the same Model from the bundled test data twice (exact and fast kernels),
+/// with every analytic model that FastMath accelerates in use (exponential Wind and
+/// Tidal, Gaussian Wave, LiIon degradation, and economics), runs both, and reports the
+/// Model and per-asset summary outputs of each along with their relative differences
+/// and run times. Not part of the testing suite; build with `make bench_FastMath`.
+///
+/// Asset production, degradation, and economics agree with the exact path to within
+/// the kernel error (order 1e-9 on the bundled data). Dispatch level outputs (fuel,
+/// emissions, and hence Model net present cost) may differ by more (order 1e-4 on the
+/// bundled data), since dispatch decisions are discrete and so can be flipped by
+/// production differences at the level of the kernel error.
+///
+
+
+#include <chrono>
+
+#include "../utils/testing_utils.h"
+#include "../../header/Model.h"
+
+
+///
+/// \fn Model* buildValidationModel(bool fast_kernels)
+///
+/// \brief Function to build the validation Model from the bundled test data.
+///
+/// \param fast_kernels A boolean which indicates whether or not to use fast kernels.
+///
+/// \return A pointer to the validation Model.
+///
+
+Model* buildValidationModel(bool fast_kernels)
+{
+    ModelInputs model_inputs;
+    
+    model_inputs.path_2_electrical_load_time_series =
+        "data/test/electrical_load/electrical_load_generic_peak-500kW_1yr_dt-1hr.csv";
+    model_inputs.fast_kernels = fast_kernels;
+    
+    Model* model_ptr = new Model(model_inputs);
+    
+    model_ptr->addResource(
+        RenewableType :: TIDAL,
+        "data/test/resources/tidal_speed_peak-3ms_1yr_dt-1hr.csv",
+        0
+    );
+    
+    model_ptr->addResource(
+        RenewableType :: WAVE,
+        "data/test/resources/waves_H_s_peak-8m_T_e_peak-15s_1yr_dt-1hr.csv",
+        1
+    );
+    
+    model_ptr->addResource(
+        RenewableType :: WIND,
+        "data/test/resources/wind_speed_peak-25ms_1yr_dt-1hr.csv",
+        2
+    );
+    
+    DieselInputs diesel_inputs;
+    diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 400;
+    model_ptr->addDiesel(diesel_inputs);
+    
+    TidalInputs tidal_inputs;
+    tidal_inputs.resource_key = 0;
+    tidal_inputs.power_model = TidalPowerProductionModel :: TIDAL_POWER_EXPONENTIAL;
+    model_ptr->addTidal(tidal_inputs);
+    
+    WaveInputs wave_inputs;
+    wave_inputs.resource_key = 1;
+    wave_inputs.power_model = WavePowerProductionModel :: WAVE_POWER_GAUSSIAN;
+    model_ptr->addWave(wave_inputs);
+    
+    WindInputs wind_inputs;
+    wind_inputs.resource_key = 2;
+    wind_inputs.power_model = WindPowerProductionModel :: WIND_POWER_EXPONENTIAL;
+    model_ptr->addWind(wind_inputs);
+    
+    LiIonInputs liion_inputs;
+    model_ptr->addLiIon(liion_inputs);
+    
+    return model_ptr;
+}   /* buildValidationModel() */
+
+
+///
+/// \fn void reportRow(std::string label, double exact, double fast)
+///
+/// \brief Function to print one row of the validation report.
+///
+/// \param label A label for the summary output.
+///
+/// \param exact The summary output, under the exact path.
+///
+/// \param fast The summary output, under fast kernels.
+///
+
+void reportRow(std::string label, double exact, double fast)
+{
+    double relative_difference = 0;
+    
+    if (exact != 0) {
+        relative_difference = fabs(fast / exact - 1);
+    }
+    
+    else {
+        relative_difference = fabs(fast);
+    }
+    
+    std::cout << "\t" << std::left << std::setw(36) << label << std::right <<
+        std::setprecision(10) << std::setw(20) << exact << std::setw(20) << fast <<
+        std::setprecision(3) << std::setw(12) << relative_difference << std::endl;
+    
+    return;
+}   /* reportRow() */
+
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tValidating fast kernels mode (FastMath)");
+    std::cout << std::endl;
+    
+    //  1. build and run both models
+    Model* exact_model_ptr = buildValidationModel(false);
+    Model* fast_model_ptr = buildValidationModel(true);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    exact_model_ptr->run();
+    double exact_time_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    
+    start = std::chrono::steady_clock::now();
+    fast_model_ptr->run();
+    double fast_time_s = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    
+    //  2. report
+    std::cout << "\tdocumented max relative error (kernels):  " <<
+        FAST_MATH_MAX_RELATIVE_ERROR << std::endl << std::endl;
+    
+    std::cout << "\t" << std::left << std::setw(36) << "summary output" <<
+        std::right << std::setw(20) << "exact" << std::setw(20) << "fast" <<
+        std::setw(12) << "rel. diff" << std::endl;
+    
+    reportRow(
+        "Model net present cost",
+        exact_model_ptr->net_present_cost,
+        fast_model_ptr->net_present_cost
+    );
+    
+    reportRow(
+        "Model LCOE [1/kWh]",
+        exact_model_ptr->levellized_cost_of_energy_kWh,
+        fast_model_ptr->levellized_cost_of_energy_kWh
+    );
+    
+    reportRow(
+        "Model total dispatch [kWh]",
+        exact_model_ptr->total_dispatch_kWh,
+        fast_model_ptr->total_dispatch_kWh
+    );
+    
+    reportRow(
+        "Model renewable penetration",
+        exact_model_ptr->renewable_penetration,
+        fast_model_ptr->renewable_penetration
+    );
+    
+    reportRow(
+        "Model total fuel consumed [L]",
+        exact_model_ptr->total_fuel_consumed_L,
+        fast_model_ptr->total_fuel_consumed_L
+    );
+    
+    reportRow(
+        "Model total CO2 emissions [kg]",
+        exact_model_ptr->total_emissions.CO2_kg,
+        fast_model_ptr->total_emissions.CO2_kg
+    );
+    
+    for (size_t i = 0; i < exact_model_ptr->combustion_ptr_vec.size(); i++) {
+        reportRow(
+            exact_model_ptr->combustion_ptr_vec[i]->type_str + " net present cost",
+            exact_model_ptr->combustion_ptr_vec[i]->net_present_cost,
+            fast_model_ptr->combustion_ptr_vec[i]->net_present_cost
+        );
+    }
+    
+    for (size_t i = 0; i < exact_model_ptr->renewable_ptr_vec.size(); i++) {
+        reportRow(
+            exact_model_ptr->renewable_ptr_vec[i]->type_str + " total production [kWh]",
+            exact_model_ptr->renewable_ptr_vec[i]->total_production_kWh,
+            fast_model_ptr->renewable_ptr_vec[i]->total_production_kWh
+        );
+        
+        reportRow(
+            exact_model_ptr->renewable_ptr_vec[i]->type_str + " net present cost",
+            exact_model_ptr->renewable_ptr_vec[i]->net_present_cost,
+            fast_model_ptr->renewable_ptr_vec[i]->net_present_cost
+        );
+    }
+    
+    for (size_t i = 0; i < exact_model_ptr->storage_ptr_vec.size(); i++) {
+        reportRow(
+            exact_model_ptr->storage_ptr_vec[i]->type_str + " net present cost",
+            exact_model_ptr->storage_ptr_vec[i]->net_present_cost,
+            fast_model_ptr->storage_ptr_vec[i]->net_present_cost
+        );
+        
+        reportRow(
+            exact_model_ptr->storage_ptr_vec[i]->type_str + " final SOH",
+            ((LiIon*)(exact_model_ptr->storage_ptr_vec[i]))->SOH,
+            ((LiIon*)(fast_model_ptr->storage_ptr_vec[i]))->SOH
+        );
+    }
+    
+    std::cout << std::endl;
+    std::cout << "\texact run:  " << exact_time_s << " s" << std::endl;
+    std::cout << "\tfast run:   " << fast_time_s << " s" << std::endl;
+    std::cout << std::endl;
+    
+    delete exact_model_ptr;
+    delete fast_model_ptr;
+    
+    return 0;
+}   /* main() */
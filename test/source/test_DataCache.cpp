@@ -0,0 +1,290 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file test_DataCache.cpp
+///
+/// \brief Testing suite for DataCache class.
+///
+/// A suite of tests for the DataCache class.
+///
+
+
+#include "../utils/testing_utils.h"
+#include "../../header/DataCache.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCacheHit_DataCache(std::string path_2_interp_data)
+///
+/// \brief A function to check that a second Interpolator borrows cached 1D data rather
+///     than re-reading it from disk.
+///
+/// \param path_2_interp_data A path (either relative or absolute) to 1D interpolation
+///     data.
+///
+
+void testCacheHit_DataCache(std::string path_2_interp_data)
+{
+    DataCache::clear();
+    
+    Interpolator interpolator_0;
+    interpolator_0.addData1D(0, path_2_interp_data);
+    
+    testFloatEquals(DataCache::n_disk_reads, 1, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_cache_hits, 0, __FILE__, __LINE__);
+    
+    Interpolator interpolator_1;
+    interpolator_1.addData1D(0, path_2_interp_data);
+    
+    testFloatEquals(DataCache::n_disk_reads, 1, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_cache_hits, 1, __FILE__, __LINE__);
+    testFloatEquals(DataCache::getNumEntries(), 1, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        interpolator_1.interp_map_1D[0].n_points,
+        interpolator_0.interp_map_1D[0].n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    for (int i = 0; i < interpolator_0.interp_map_1D[0].n_points; i++) {
+        testFloatEquals(
+            interpolator_1.interp_map_1D[0].y_vec[i],
+            interpolator_0.interp_map_1D[0].y_vec[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(
+        interpolator_1.interp1D(0, 0.5),
+        interpolator_0.interp1D(0, 0.5),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testCacheHit_DataCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testInvalidation_DataCache(
+///         std::string path_2_interp_data,
+///         std::string write_path
+///     )
+///
+/// \brief A function to check that cached data is re-read once the underlying file
+///     changes on disk.
+///
+/// \param path_2_interp_data A path (either relative or absolute) to 1D interpolation
+///     data.
+///
+/// \param write_path A path (either relative or absolute) to the test results directory.
+///
+
+void testInvalidation_DataCache(
+    std::string path_2_interp_data,
+    std::string write_path
+)
+{
+    DataCache::clear();
+    
+    std::string path_2_copy = write_path + "interp_data.csv";
+    
+    std::filesystem::copy_file(
+        path_2_interp_data,
+        path_2_copy,
+        std::filesystem::copy_options::overwrite_existing
+    );
+    
+    Interpolator interpolator_0;
+    interpolator_0.addData1D(0, path_2_copy);
+    
+    testFloatEquals(DataCache::n_disk_reads, 1, __FILE__, __LINE__);
+    
+    //  change file on disk (append a data point)
+    std::ofstream ofs;
+    ofs.open(path_2_copy, std::ofstream::app);
+    ofs << "1.5,35,||,,\n";
+    ofs.close();
+    
+    Interpolator interpolator_1;
+    interpolator_1.addData1D(0, path_2_copy);
+    
+    testFloatEquals(DataCache::n_disk_reads, 2, __FILE__, __LINE__);
+    testFloatEquals(DataCache::n_cache_hits, 0, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        interpolator_1.interp_map_1D[0].n_points,
+        interpolator_0.interp_map_1D[0].n_points + 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testInvalidation_DataCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testNormalizedSeries_DataCache(std::string path_2_normalized_data)
+///
+/// \brief A function to check that normalized series are read once, and that borrowed
+///     entries survive pruning while unborrowed entries do not.
+///
+/// \param path_2_normalized_data A path (either relative or absolute) to normalized
+///     production data.
+///
+
+void testNormalizedSeries_DataCache(std::string path_2_normalized_data)
+{
+    DataCache::clear();
+    
+    int n_calls = 0;
+    
+    std::function<NormalizedSeriesData(void)> read_function = [&n_calls](void) {
+        n_calls++;
+        
+        NormalizedSeriesData normalized_series;
+        normalized_series.time_vec_hrs = {0, 1, 2};
+        normalized_series.normalized_vec = {0.1, 0.2, 0.3};
+        
+        return normalized_series;
+    };
+    
+    std::shared_ptr<const NormalizedSeriesData> normalized_series_ptr =
+        DataCache::getNormalizedSeries(path_2_normalized_data, read_function);
+    
+    DataCache::getNormalizedSeries(path_2_normalized_data, read_function);
+    
+    testFloatEquals(n_calls, 1, __FILE__, __LINE__);
+    testFloatEquals(normalized_series_ptr->normalized_vec[2], 0.3, __FILE__, __LINE__);
+    
+    //  borrowed, so survives pruning
+    DataCache::prune();
+    testFloatEquals(DataCache::getNumEntries(), 1, __FILE__, __LINE__);
+    
+    //  released, so pruned
+    normalized_series_ptr.reset();
+    DataCache::prune();
+    testFloatEquals(DataCache::getNumEntries(), 0, __FILE__, __LINE__);
+    
+    //  disabled, so always read and never stored
+    DataCache::enabled = false;
+    
+    DataCache::getNormalizedSeries(path_2_normalized_data, read_function);
+    DataCache::getNormalizedSeries(path_2_normalized_data, read_function);
+    
+    DataCache::enabled = true;
+    
+    testFloatEquals(n_calls, 3, __FILE__, __LINE__);
+    testFloatEquals(DataCache::getNumEntries(), 0, __FILE__, __LINE__);
+    
+    return;
+}   /* testNormalizedSeries_DataCache() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tTesting DataCache");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    std::string path_2_interp_data = "data/test/interpolation/diesel_fuel_curve.csv";
+    
+    std::string path_2_normalized_data =
+        "data/test/normalized_production/normalized_solar_production.csv";
+    
+    std::string write_path = "test/test_results/DataCache/";
+    
+    std::filesystem::remove_all(write_path);
+    std::filesystem::create_directories(write_path);
+    
+    
+    try {
+        testCacheHit_DataCache(path_2_interp_data);
+        testInvalidation_DataCache(path_2_interp_data, write_path);
+        testNormalizedSeries_DataCache(path_2_normalized_data);
+    }
+
+
+    catch (...) {
+        DataCache::clear();
+        
+        printGold(" ................................ ");
+        printRed("FAIL");
+        std::cout << std::endl;
+        throw;
+    }
+
+
+    DataCache::clear();
+    
+    printGold(" ................................ ");
+    printGreen("PASS");
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
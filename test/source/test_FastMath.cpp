@@ -0,0 +1,279 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+///
+/// \file test_FastMath.cpp
+///
+/// \brief Testing suite for FastMath class.
+///
+/// A suite of tests for the FastMath class. Doubles as the validation sweep for the
+/// documented maximum relative error (FAST_MATH_MAX_RELATIVE_ERROR).
+///
+
+
+#include "../utils/testing_utils.h"
+#include "../../header/FastMath.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testExp_FastMath(void)
+///
+/// \brief A function to check that FastMath::exp() is within the documented maximum
+///     relative error of std::exp(), over the whole (normal) range.
+///
+
+void testExp_FastMath(void)
+{
+    double max_relative_error = 0;
+    
+    int n_points = 1000000;
+    
+    for (int i = 0; i <= n_points; i++) {
+        double x = -707.9 + (1415.8 * i) / n_points;
+        
+        max_relative_error = std::max(
+            max_relative_error,
+            fabs(FastMath::exp(x) / std::exp(x) - 1)
+        );
+    }
+    
+    testLessThanOrEqualTo(
+        max_relative_error,
+        FAST_MATH_MAX_RELATIVE_ERROR,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(FastMath::exp(0), 1, __FILE__, __LINE__);
+    
+    return;
+}   /* testExp_FastMath() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testLog_FastMath(void)
+///
+/// \brief A function to check that FastMath::log() is within its documented relative
+///     error of std::log(), from the smallest to the largest normal double, and close
+///     to 1 (where ln(x) is small).
+///
+
+void testLog_FastMath(void)
+{
+    double max_relative_error = 0;
+    
+    int n_points = 1000000;
+    
+    for (int i = 0; i <= n_points; i++) {
+        double x_vec[3] = {
+            pow(10, -307.5 + (615.5 * i) / n_points),
+            1 + pow(10, -12 + (12.0 * i) / n_points),
+            1 - pow(10, -12 + (11.7 * i) / n_points)
+        };
+        
+        for (int j = 0; j < 3; j++) {
+            max_relative_error = std::max(
+                max_relative_error,
+                fabs(FastMath::log(x_vec[j]) / std::log(x_vec[j]) - 1)
+            );
+        }
+    }
+    
+    testLessThanOrEqualTo(max_relative_error, 1e-13, __FILE__, __LINE__);
+    
+    testFloatEquals(FastMath::log(1), 0, __FILE__, __LINE__);
+    
+    return;
+}   /* testLog_FastMath() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testPow_FastMath(void)
+///
+/// \brief A function to check that FastMath::pow() is within the documented maximum
+///     relative error of std::pow(), for |y * ln(x)| <= 700. This includes large |y|
+///     (i.e., bases close to 1), where the error of ln(x) is scaled by |y|.
+///
+
+void testPow_FastMath(void)
+{
+    double max_relative_error = 0;
+    
+    int n_points = 1000;
+    
+    //  1. moderate exponents
+    for (int i = 0; i <= n_points; i++) {
+        double x = pow(10, -6 + (12.0 * i) / n_points);
+        
+        for (int j = 0; j <= n_points; j++) {
+            double y = -50 + (100.0 * j) / n_points;
+            
+            if (fabs(y * std::log(x)) > 700) {
+                continue;
+            }
+            
+            max_relative_error = std::max(
+                max_relative_error,
+                fabs(FastMath::pow(x, y) / std::pow(x, y) - 1)
+            );
+        }
+    }
+    
+    //  2. exponents out to the |y * ln(x)| = 700 limit (up to |y| ~ 7e11)
+    for (int i = 0; i <= n_points; i++) {
+        double x = 1 + pow(10, -9 + (9.5 * i) / n_points);
+        
+        if (i % 2 == 1) {
+            x = 1 / x;
+        }
+        
+        double y_max = 700 / fabs(std::log(x));
+        
+        for (int j = 0; j <= n_points; j++) {
+            double y = y_max * (-1 + (2.0 * j) / n_points);
+            
+            max_relative_error = std::max(
+                max_relative_error,
+                fabs(FastMath::pow(x, y) / std::pow(x, y) - 1)
+            );
+        }
+    }
+    
+    max_relative_error = std::max(
+        max_relative_error,
+        fabs(FastMath::pow(1.414210, 2019.788) / std::pow(1.414210, 2019.788) - 1)
+    );
+    
+    testLessThanOrEqualTo(
+        max_relative_error,
+        FAST_MATH_MAX_RELATIVE_ERROR,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testPow_FastMath() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testPassThrough_FastMath(void)
+///
+/// \brief A function to check that arguments outside of the approximated domain are
+///     passed through to the standard library.
+///
+
+void testPassThrough_FastMath(void)
+{
+    double inf = std::numeric_limits<double>::infinity();
+    
+    testTruth(FastMath::exp(inf) == inf, __FILE__, __LINE__);
+    testTruth(FastMath::exp(-inf) == 0, __FILE__, __LINE__);
+    testTruth(FastMath::exp(-800) == std::exp(-800), __FILE__, __LINE__);
+    testTruth(std::isnan(FastMath::exp(std::nan(""))), __FILE__, __LINE__);
+    
+    testTruth(FastMath::log(0) == -inf, __FILE__, __LINE__);
+    testTruth(std::isnan(FastMath::log(-1)), __FILE__, __LINE__);
+    testTruth(FastMath::log(1e-310) == std::log(1e-310), __FILE__, __LINE__);
+    
+    testTruth(FastMath::pow(0, 2) == 0, __FILE__, __LINE__);
+    testTruth(FastMath::pow(-2, 3) == -8, __FILE__, __LINE__);
+    
+    return;
+}   /* testPassThrough_FastMath() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tTesting FastMath");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    try {
+        testExp_FastMath();
+        testLog_FastMath();
+        testPow_FastMath();
+        testPassThrough_FastMath();
+    }
+
+
+    catch (...) {
+        printGold(" ................................ ");
+        printRed("FAIL");
+        std::cout << std::endl;
+        throw;
+    }
+
+
+    printGold(" ................................ ");
+    printGreen("PASS");
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //
@@ -437,15 +437,22 @@ void testDataRead2D_Interpolator(
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix.size(),
-        16,
+        test_interpolator_ptr->interp_map_2D[data_key_2D].z_vec.size(),
+        16 * 16,
         __FILE__,
         __LINE__
     );
 
     testFloatEquals(
-        test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix[0].size(),
-        16,
+        test_interpolator_ptr->interp_map_2D[data_key_2D].inv_dx_vec.size(),
+        15,
+        __FILE__,
+        __LINE__
+    );
+
+    testFloatEquals(
+        test_interpolator_ptr->interp_map_2D[data_key_2D].inv_dy_vec[0],
+        1,
         __FILE__,
         __LINE__
     );
@@ -541,7 +548,9 @@ void testDataRead2D_Interpolator(
     for (int i = 0; i < test_interpolator_ptr->interp_map_2D[data_key_2D].n_rows; i++) {
         for (int j = 0; j < test_interpolator_ptr->interp_map_2D[data_key_2D].n_cols; j++) {
             testFloatEquals(
-                test_interpolator_ptr->interp_map_2D[data_key_2D].z_matrix[i][j],
+                test_interpolator_ptr->interp_map_2D[data_key_2D].z_vec[
+                    i * test_interpolator_ptr->interp_map_2D[data_key_2D].n_cols + j
+                ],
                 expected_z_matrix[i][j],
                 __FILE__,
                 __LINE__
@@ -721,42 +730,1025 @@ void testInterpolation2D_Interpolator(
 
 // ---------------------------------------------------------------------------------- //
 
-int main(int argc, char** argv)
+///
+/// \fn void testUniformGrid_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that uniformly spaced interpolation data is detected as
+///     such, and that direct (uniform) and binary search indexing agree with a brute
+///     force evaluation of the piecewise linear interpolant.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object (irregular 1D
+///     data).
+///
+/// \param data_key_2D A key used to index into the Interpolator object (uniform 2D
+///     data).
+///
+
+void testUniformGrid_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
 {
-    #ifdef _WIN32
-        activateVirtualTerminal();
-    #endif  /* _WIN32 */
+    //  1. check grid detection
+    testTruth(
+        not test_interpolator_ptr->interp_map_1D[data_key_1D].is_uniform_x,
+        __FILE__,
+        __LINE__
+    );
     
-    printGold("\n\tTesting Interpolator");
+    testTruth(
+        test_interpolator_ptr->interp_map_2D[data_key_2D].is_uniform_x,
+        __FILE__,
+        __LINE__
+    );
     
-    #ifdef _WIN32
-        std::cout << std::endl;
-    #endif
+    testTruth(
+        test_interpolator_ptr->interp_map_2D[data_key_2D].is_uniform_y,
+        __FILE__,
+        __LINE__
+    );
     
-    srand(time(NULL));
+    testFloatEquals(
+        test_interpolator_ptr->interp_map_2D[data_key_2D].inv_dx,
+        2,
+        __FILE__,
+        __LINE__
+    );
     
+    //  2. add uniform 1D data directly, check derived attributes
+    int data_key_uniform = data_key_1D + data_key_2D + 1;
     
-    Interpolator* test_interpolator_ptr = testConstruct_Interpolator();
+    InterpolatorStruct1D interp_struct_1D;
+    interp_struct_1D.x_vec = {0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1};
+    interp_struct_1D.y_vec = {0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100};
+    
+    test_interpolator_ptr->addData1D(data_key_uniform, interp_struct_1D);
+    
+    InterpolatorStruct1D* uniform_ptr =
+        &(test_interpolator_ptr->interp_map_1D[data_key_uniform]);
+    
+    testFloatEquals(uniform_ptr->n_points, 11, __FILE__, __LINE__);
+    testFloatEquals(uniform_ptr->min_x, 0, __FILE__, __LINE__);
+    testFloatEquals(uniform_ptr->max_x, 1, __FILE__, __LINE__);
+    testTruth(uniform_ptr->is_uniform_x, __FILE__, __LINE__);
+    testFloatEquals(uniform_ptr->inv_dx, 10, __FILE__, __LINE__);
+    
+    //  3. compare against brute force, for both irregular and uniform data
+    std::vector<int> data_key_vec = {data_key_1D, data_key_uniform};
+    
+    for (size_t k = 0; k < data_key_vec.size(); k++) {
+        InterpolatorStruct1D* interp_struct_ptr =
+            &(test_interpolator_ptr->interp_map_1D[data_key_vec[k]]);
+        
+        for (int i = 0; i < 1000; i++) {
+            double interp_x = interp_struct_ptr->min_x +
+                ((double)rand() / RAND_MAX) *
+                (interp_struct_ptr->max_x - interp_struct_ptr->min_x);
+            
+            //  include grid points (and bounds)
+            if (i < interp_struct_ptr->n_points) {
+                interp_x = interp_struct_ptr->x_vec[i];
+            }
+            
+            int idx = 0;
+            while (
+                idx < interp_struct_ptr->n_points - 2 and
+                interp_x > interp_struct_ptr->x_vec[idx + 1]
+            ) {
+                idx++;
+            }
+            
+            double x_0 = interp_struct_ptr->x_vec[idx];
+            double x_1 = interp_struct_ptr->x_vec[idx + 1];
+            double y_0 = interp_struct_ptr->y_vec[idx];
+            double y_1 = interp_struct_ptr->y_vec[idx + 1];
+            
+            double expected_interp_y =
+                ((y_1 - y_0) / (x_1 - x_0)) * (interp_x - x_0) + y_0;
+            
+            testFloatEquals(
+                test_interpolator_ptr->interp1D(data_key_vec[k], interp_x),
+                expected_interp_y,
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    return;
+}   /* testUniformGrid_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testCursor_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that cursor-hinted interpolation returns the same results
+///     as stateless interpolation, for both smoothly varying and jumping queries.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param data_key_2D A key used to index into the Interpolator object.
+///
+
+void testCursor_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    InterpolatorStruct1D* struct_1D_ptr =
+        &(test_interpolator_ptr->interp_map_1D[data_key_1D]);
+    
+    InterpolatorStruct2D* struct_2D_ptr =
+        &(test_interpolator_ptr->interp_map_2D[data_key_2D]);
+    
+    InterpolatorCursor cursor_1D;
+    InterpolatorCursor cursor_2D;
+    
+    double interp_x = struct_1D_ptr->min_x;
+    double interp_x_2D = struct_2D_ptr->min_x;
+    double interp_y_2D = struct_2D_ptr->min_y;
+    
+    for (int i = 0; i < 2000; i++) {
+        //  1. smooth sweep (first half), then random jumps (second half)
+        if (i < 1000) {
+            interp_x = struct_1D_ptr->min_x +
+                (struct_1D_ptr->max_x - struct_1D_ptr->min_x) *
+                (0.5 + 0.5 * sin(0.01 * i));
+            
+            interp_x_2D = struct_2D_ptr->min_x +
+                (struct_2D_ptr->max_x - struct_2D_ptr->min_x) *
+                (0.5 + 0.5 * cos(0.01 * i));
+            
+            interp_y_2D = struct_2D_ptr->min_y +
+                (struct_2D_ptr->max_y - struct_2D_ptr->min_y) *
+                (0.5 + 0.5 * sin(0.007 * i));
+        }
+        
+        else {
+            interp_x = struct_1D_ptr->x_vec[rand() % struct_1D_ptr->n_points];
+            
+            if (i % 2 == 0) {
+                interp_x = struct_1D_ptr->min_x +
+                    ((double)rand() / RAND_MAX) *
+                    (struct_1D_ptr->max_x - struct_1D_ptr->min_x);
+            }
+            
+            interp_x_2D = struct_2D_ptr->min_x +
+                ((double)rand() / RAND_MAX) *
+                (struct_2D_ptr->max_x - struct_2D_ptr->min_x);
+            
+            interp_y_2D = struct_2D_ptr->min_y +
+                ((double)rand() / RAND_MAX) *
+                (struct_2D_ptr->max_y - struct_2D_ptr->min_y);
+        }
+        
+        //  2. compare cursor-hinted and stateless interpolation
+        testFloatEquals(
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x, &cursor_1D),
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp2D(
+                data_key_2D,
+                interp_x_2D,
+                interp_y_2D,
+                &cursor_2D
+            ),
+            test_interpolator_ptr->interp2D(data_key_2D, interp_x_2D, interp_y_2D),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testTruth(cursor_1D.idx_x >= 0, __FILE__, __LINE__);
+    testTruth(cursor_1D.idx_x <= struct_1D_ptr->n_points - 2, __FILE__, __LINE__);
+    testTruth(cursor_2D.idx_y >= 0, __FILE__, __LINE__);
+    
+    return;
+}   /* testCursor_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBatch_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that batched interpolation returns the same results as
+///     scalar interpolation, and that out of bounds batches are rejected.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param data_key_2D A key used to index into the Interpolator object.
+///
+
+void testBatch_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    InterpolatorStruct1D* struct_1D_ptr =
+        &(test_interpolator_ptr->interp_map_1D[data_key_1D]);
+    
+    InterpolatorStruct2D* struct_2D_ptr =
+        &(test_interpolator_ptr->interp_map_2D[data_key_2D]);
+    
+    //  1. build query batches
+    int n_queries = 5000;
+    
+    std::vector<double> interp_x_vec_1D(n_queries, 0);
+    std::vector<double> interp_x_vec_2D(n_queries, 0);
+    std::vector<double> interp_y_vec_2D(n_queries, 0);
+    
+    for (int i = 0; i < n_queries; i++) {
+        interp_x_vec_1D[i] = struct_1D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (struct_1D_ptr->max_x - struct_1D_ptr->min_x);
+        
+        interp_x_vec_2D[i] = struct_2D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (struct_2D_ptr->max_x - struct_2D_ptr->min_x);
+        
+        interp_y_vec_2D[i] = struct_2D_ptr->min_y +
+            ((double)rand() / RAND_MAX) * (struct_2D_ptr->max_y - struct_2D_ptr->min_y);
+    }
+    
+    interp_x_vec_1D[0] = struct_1D_ptr->min_x;
+    interp_x_vec_1D[1] = struct_1D_ptr->max_x;
+    
+    //  2. compare batched and scalar interpolation
+    std::vector<double> interp_y_vec_1D;
+    std::vector<double> interp_z_vec_2D;
+    
+    test_interpolator_ptr->interp1DBatch(data_key_1D, &interp_x_vec_1D, &interp_y_vec_1D);
     
+    test_interpolator_ptr->interp2DBatch(
+        data_key_2D,
+        &interp_x_vec_2D,
+        &interp_y_vec_2D,
+        &interp_z_vec_2D
+    );
+    
+    testFloatEquals(interp_y_vec_1D.size(), n_queries, __FILE__, __LINE__);
+    testFloatEquals(interp_z_vec_2D.size(), n_queries, __FILE__, __LINE__);
+    
+    for (int i = 0; i < n_queries; i++) {
+        testFloatEquals(
+            interp_y_vec_1D[i],
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x_vec_1D[i]),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            interp_z_vec_2D[i],
+            test_interpolator_ptr->interp2D(
+                data_key_2D,
+                interp_x_vec_2D[i],
+                interp_y_vec_2D[i]
+            ),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. out of bounds batch
+    interp_x_vec_1D[n_queries / 2] = 2 * struct_1D_ptr->max_x + 1;
     
+    bool error_flag = true;
     try {
-        int data_key_1D = 1;
-        std::string path_2_data_1D =
-            "data/test/interpolation/diesel_fuel_curve.csv";
+        test_interpolator_ptr->interp1DBatch(
+            data_key_1D,
+            &interp_x_vec_1D,
+            &interp_y_vec_1D
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  4. mismatched batch
+    interp_y_vec_2D.pop_back();
+    
+    try {
+        test_interpolator_ptr->interp2DBatch(
+            data_key_2D,
+            &interp_x_vec_2D,
+            &interp_y_vec_2D,
+            &interp_z_vec_2D
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testBatch_Interpolator() */
 
-        testDataRead1D_Interpolator(test_interpolator_ptr, data_key_1D, path_2_data_1D);
-        testBadIndexing1D_Interpolator(test_interpolator_ptr, -99);
-        testInvalidInterpolation1D_Interpolator(test_interpolator_ptr, data_key_1D);
-        testInterpolation1D_Interpolator(test_interpolator_ptr, data_key_1D);
+// ---------------------------------------------------------------------------------- //
 
 
-        int data_key_2D = 2;
-        std::string path_2_data_2D =
-            "data/test/interpolation/wave_energy_converter_normalized_performance_matrix.csv";
 
-        testDataRead2D_Interpolator(test_interpolator_ptr, data_key_2D, path_2_data_2D);
-        testInvalidInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
-        testInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testHandle_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         int data_key_2D
+///     )
+///
+/// \brief Function to check that handle-based interpolation returns the same results
+///     as key-based interpolation, and that bad keys and null handles are rejected.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object.
+///
+/// \param data_key_2D A key used to index into the Interpolator object.
+///
+
+void testHandle_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    int data_key_2D
+)
+{
+    //  1. get handles
+    InterpolatorHandle1D handle_1D = test_interpolator_ptr->getHandle1D(data_key_1D);
+    InterpolatorHandle2D handle_2D = test_interpolator_ptr->getHandle2D(data_key_2D);
+    
+    testTruth(
+        handle_1D.interp_struct_1D_ptr ==
+            &(test_interpolator_ptr->interp_map_1D[data_key_1D]),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        handle_2D.interp_struct_2D_ptr ==
+            &(test_interpolator_ptr->interp_map_2D[data_key_2D]),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. compare handle-based and key-based interpolation
+    for (int i = 0; i < 1000; i++) {
+        double interp_x = handle_1D.interp_struct_1D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (
+                handle_1D.interp_struct_1D_ptr->max_x -
+                handle_1D.interp_struct_1D_ptr->min_x
+            );
+        
+        double interp_x_2D = handle_2D.interp_struct_2D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (
+                handle_2D.interp_struct_2D_ptr->max_x -
+                handle_2D.interp_struct_2D_ptr->min_x
+            );
+        
+        double interp_y_2D = handle_2D.interp_struct_2D_ptr->min_y +
+            ((double)rand() / RAND_MAX) * (
+                handle_2D.interp_struct_2D_ptr->max_y -
+                handle_2D.interp_struct_2D_ptr->min_y
+            );
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp1D(handle_1D, interp_x),
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp2D(handle_2D, interp_x_2D, interp_y_2D),
+            test_interpolator_ptr->interp2D(data_key_2D, interp_x_2D, interp_y_2D),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. bad key
+    bool error_flag = true;
+    try {
+        test_interpolator_ptr->getHandle1D(-99);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  4. null handle
+    InterpolatorHandle2D null_handle_2D;
+    
+    try {
+        test_interpolator_ptr->interp2D(null_handle_2D, 1, 1);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testHandle_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testResample_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         std::string path_2_data_1D
+///     )
+///
+/// \brief Function to check that resampling 1D interpolation data onto a uniform grid
+///     reports the correct maximum deviation, and is exact when the uniform grid
+///     contains the original data points.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param path_2_data_1D A path (either relative or absolute) to the interpolation data.
+///
+
+void testResample_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    std::string path_2_data_1D
+)
+{
+    int data_key_original = 101;
+    int data_key_coarse = 102;
+    int data_key_fine = 103;
+    
+    test_interpolator_ptr->addData1D(data_key_original, path_2_data_1D);
+    test_interpolator_ptr->addData1D(data_key_coarse, path_2_data_1D);
+    
+    InterpolatorHandle1D handle_fine =
+        test_interpolator_ptr->addData1D(data_key_fine, path_2_data_1D);
+    
+    //  1. coarse resampling (deviation is that at original data points)
+    double max_deviation = test_interpolator_ptr->resampleData1D(data_key_coarse, 5);
+    
+    InterpolatorStruct1D* original_ptr =
+        &(test_interpolator_ptr->interp_map_1D[data_key_original]);
+    InterpolatorStruct1D* coarse_ptr =
+        &(test_interpolator_ptr->interp_map_1D[data_key_coarse]);
+    
+    testTruth(coarse_ptr->is_resampled, __FILE__, __LINE__);
+    testTruth(coarse_ptr->is_uniform_x, __FILE__, __LINE__);
+    testFloatEquals(coarse_ptr->n_points, 5, __FILE__, __LINE__);
+    testFloatEquals(coarse_ptr->min_x, original_ptr->min_x, __FILE__, __LINE__);
+    testFloatEquals(coarse_ptr->max_x, original_ptr->max_x, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        coarse_ptr->max_resample_deviation,
+        max_deviation,
+        __FILE__,
+        __LINE__
+    );
+    
+    testGreaterThan(max_deviation, 0, __FILE__, __LINE__);
+    
+    double expected_max_deviation = 0;
+    
+    for (int i = 0; i < 1000 + original_ptr->n_points; i++) {
+        double interp_x = original_ptr->min_x +
+            (i / 999.0) * (original_ptr->max_x - original_ptr->min_x);
+        
+        //  include original data points
+        if (i >= 1000) {
+            interp_x = original_ptr->x_vec[i - 1000];
+        }
+        
+        double deviation = fabs(
+            test_interpolator_ptr->interp1D(data_key_coarse, interp_x) -
+            test_interpolator_ptr->interp1D(data_key_original, interp_x)
+        );
+        
+        testLessThanOrEqualTo(deviation, max_deviation + 1e-9, __FILE__, __LINE__);
+        
+        if (deviation > expected_max_deviation) {
+            expected_max_deviation = deviation;
+        }
+    }
+    
+    testFloatEquals(max_deviation, expected_max_deviation, __FILE__, __LINE__);
+    
+    //  2. fine resampling (grid contains original data points, so exact)
+    max_deviation = test_interpolator_ptr->resampleData1D(data_key_fine, 201);
+    
+    testFloatEquals(max_deviation, 0, __FILE__, __LINE__);
+    
+    for (int i = 0; i < 1000; i++) {
+        double interp_x = original_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (original_ptr->max_x - original_ptr->min_x);
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp1D(handle_fine, interp_x),
+            test_interpolator_ptr->interp1D(data_key_original, interp_x),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. bad resolution
+    bool error_flag = true;
+    try {
+        test_interpolator_ptr->resampleData1D(data_key_fine, 1);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testResample_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBoundsPolicy_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         std::string path_2_data_1D,
+///         std::string path_2_data_2D
+///     )
+///
+/// \brief Function to check that the clamp and extrapolate bounds policies behave as
+///     expected (including in batch), and that the unchecked interpolation methods
+///     agree with the checked methods within the data domain.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param path_2_data_1D A path (either relative or absolute) to the 1D interpolation
+///     data.
+///
+/// \param path_2_data_2D A path (either relative or absolute) to the 2D interpolation
+///     data.
+///
+
+void testBoundsPolicy_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    std::string path_2_data_1D,
+    std::string path_2_data_2D
+)
+{
+    int data_key_1D = 111;
+    int data_key_2D = 112;
+    
+    InterpolatorHandle1D handle_1D =
+        test_interpolator_ptr->addData1D(data_key_1D, path_2_data_1D);
+    InterpolatorHandle2D handle_2D =
+        test_interpolator_ptr->addData2D(data_key_2D, path_2_data_2D);
+    
+    const InterpolatorStruct1D* struct_1D_ptr = handle_1D.interp_struct_1D_ptr;
+    const InterpolatorStruct2D* struct_2D_ptr = handle_2D.interp_struct_2D_ptr;
+    
+    //  1. default is to throw
+    testTruth(
+        struct_1D_ptr->bounds_policy == InterpolatorBoundsPolicy :: INTERP_BOUNDS_THROW,
+        __FILE__,
+        __LINE__
+    );
+    
+    bool error_flag = true;
+    try {
+        test_interpolator_ptr->interp1D(handle_1D, struct_1D_ptr->max_x + 1);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  2. clamp
+    test_interpolator_ptr->setBoundsPolicy1D(
+        data_key_1D,
+        InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP
+    );
+    
+    test_interpolator_ptr->setBoundsPolicy2D(
+        data_key_2D,
+        InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP
+    );
+    
+    testFloatEquals(
+        test_interpolator_ptr->interp1D(handle_1D, struct_1D_ptr->min_x - 1),
+        struct_1D_ptr->y_vec.front(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_interpolator_ptr->interp1D(handle_1D, struct_1D_ptr->max_x + 1),
+        struct_1D_ptr->y_vec.back(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_interpolator_ptr->interp2D(
+            handle_2D,
+            struct_2D_ptr->min_x - 1,
+            struct_2D_ptr->max_y + 1
+        ),
+        test_interpolator_ptr->interp2D(
+            handle_2D,
+            struct_2D_ptr->min_x,
+            struct_2D_ptr->max_y
+        ),
+        __FILE__,
+        __LINE__
+    );
+    
+    std::vector<double> interp_x_vec = {
+        struct_1D_ptr->min_x - 1,
+        struct_1D_ptr->min_x,
+        0.5 * (struct_1D_ptr->min_x + struct_1D_ptr->max_x),
+        struct_1D_ptr->max_x + 1
+    };
+    
+    std::vector<double> interp_y_vec;
+    
+    test_interpolator_ptr->interp1DBatch(data_key_1D, &interp_x_vec, &interp_y_vec);
+    
+    for (size_t i = 0; i < interp_x_vec.size(); i++) {
+        testFloatEquals(
+            interp_y_vec[i],
+            test_interpolator_ptr->interp1D(handle_1D, interp_x_vec[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. extrapolate (linearly, from end intervals)
+    test_interpolator_ptr->setBoundsPolicy1D(
+        data_key_1D,
+        InterpolatorBoundsPolicy :: INTERP_BOUNDS_EXTRAPOLATE
+    );
+    
+    double delta_x = 0.1 * (struct_1D_ptr->max_x - struct_1D_ptr->min_x);
+    
+    testFloatEquals(
+        test_interpolator_ptr->interp1D(handle_1D, struct_1D_ptr->max_x + delta_x),
+        struct_1D_ptr->y_vec.back() + struct_1D_ptr->slope_vec.back() * delta_x,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        test_interpolator_ptr->interp1D(handle_1D, struct_1D_ptr->min_x - delta_x),
+        struct_1D_ptr->y_vec.front() - struct_1D_ptr->slope_vec.front() * delta_x,
+        __FILE__,
+        __LINE__
+    );
+    
+    test_interpolator_ptr->interp1DBatch(data_key_1D, &interp_x_vec, &interp_y_vec);
+    
+    for (size_t i = 0; i < interp_x_vec.size(); i++) {
+        testFloatEquals(
+            interp_y_vec[i],
+            test_interpolator_ptr->interp1D(handle_1D, interp_x_vec[i]),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  4. unchecked agrees with checked (within data domain)
+    InterpolatorCursor cursor;
+    
+    for (int i = 0; i < 1000; i++) {
+        double interp_x = struct_1D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (struct_1D_ptr->max_x - struct_1D_ptr->min_x);
+        
+        double interp_x_2D = struct_2D_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (struct_2D_ptr->max_x - struct_2D_ptr->min_x);
+        
+        double interp_y_2D = struct_2D_ptr->min_y +
+            ((double)rand() / RAND_MAX) * (struct_2D_ptr->max_y - struct_2D_ptr->min_y);
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp1DUnchecked(handle_1D, interp_x, &cursor),
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x),
+            __FILE__,
+            __LINE__
+        );
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp2DUnchecked(
+                handle_2D,
+                interp_x_2D,
+                interp_y_2D,
+                &cursor
+            ),
+            test_interpolator_ptr->interp2D(data_key_2D, interp_x_2D, interp_y_2D),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  5. bad bounds policy
+    try {
+        test_interpolator_ptr->setBoundsPolicy1D(
+            data_key_1D,
+            InterpolatorBoundsPolicy :: N_INTERP_BOUNDS_POLICIES
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testBoundsPolicy_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testBorrow_Interpolator(
+///         Interpolator* test_interpolator_ptr,
+///         int data_key_1D,
+///         std::string path_2_data_1D,
+///         std::string path_2_data_2D
+///     )
+///
+/// \brief Function to check that borrowed interpolation data is shared (rather than
+///     copied) between Interpolators, gives the same results as owned data, and is
+///     read only.
+///
+/// \param test_interpolator_ptr A pointer to the test Interpolator object.
+///
+/// \param data_key_1D A key used to index into the Interpolator object (owned data
+///     read from path_2_data_1D).
+///
+/// \param path_2_data_1D A path (either relative or absolute) to the 1D interpolation
+///     data.
+///
+/// \param path_2_data_2D A path (either relative or absolute) to the 2D interpolation
+///     data.
+///
+
+void testBorrow_Interpolator(
+    Interpolator* test_interpolator_ptr,
+    int data_key_1D,
+    std::string path_2_data_1D,
+    std::string path_2_data_2D
+)
+{
+    int data_key_borrowed_1D = 121;
+    int data_key_borrowed_2D = 122;
+    int data_key_given_1D = 123;
+    
+    Interpolator other_interpolator;
+    
+    //  1. borrowed data is shared between Interpolators
+    InterpolatorHandle1D handle_1D =
+        test_interpolator_ptr->borrowData1D(data_key_borrowed_1D, path_2_data_1D);
+    InterpolatorHandle2D handle_2D =
+        test_interpolator_ptr->borrowData2D(data_key_borrowed_2D, path_2_data_2D);
+    
+    testTruth(
+        other_interpolator.borrowData1D(0, path_2_data_1D).interp_struct_1D_ptr ==
+            handle_1D.interp_struct_1D_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        other_interpolator.borrowData2D(0, path_2_data_2D).interp_struct_2D_ptr ==
+            handle_2D.interp_struct_2D_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_interpolator_ptr->getHandle1D(data_key_borrowed_1D).interp_struct_1D_ptr ==
+            handle_1D.interp_struct_1D_ptr,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_interpolator_ptr->interp_map_1D.count(data_key_borrowed_1D) == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. borrowed data gives the same results as owned data
+    const InterpolatorStruct1D* owned_ptr =
+        test_interpolator_ptr->getHandle1D(data_key_1D).interp_struct_1D_ptr;
+    
+    for (int i = 0; i < 1000; i++) {
+        double interp_x = owned_ptr->min_x +
+            ((double)rand() / RAND_MAX) * (owned_ptr->max_x - owned_ptr->min_x);
+        
+        testFloatEquals(
+            test_interpolator_ptr->interp1D(data_key_borrowed_1D, interp_x),
+            test_interpolator_ptr->interp1D(data_key_1D, interp_x),
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    //  3. given data is shared, not copied
+    std::shared_ptr<const InterpolatorStruct1D> given_ptr =
+        std::make_shared<const InterpolatorStruct1D>(*owned_ptr);
+    
+    testTruth(
+        test_interpolator_ptr->borrowData1D(
+            data_key_given_1D,
+            given_ptr
+        ).interp_struct_1D_ptr == given_ptr.get(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. borrowed data is read only
+    bool error_flag = true;
+    try {
+        test_interpolator_ptr->resampleData1D(data_key_borrowed_1D, 10);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->setBoundsPolicy1D(
+            data_key_borrowed_1D,
+            InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->setBoundsPolicy2D(
+            data_key_borrowed_2D,
+            InterpolatorBoundsPolicy :: INTERP_BOUNDS_CLAMP
+        );
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  5. keys are shared between owned and borrowed data
+    try {
+        test_interpolator_ptr->addData1D(data_key_borrowed_1D, path_2_data_1D);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    try {
+        test_interpolator_ptr->borrowData1D(data_key_1D, path_2_data_1D);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  6. incomplete given data
+    std::shared_ptr<const InterpolatorStruct1D> null_ptr;
+    
+    try {
+        test_interpolator_ptr->borrowData1D(124, null_ptr);
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    return;
+}   /* testBorrow_Interpolator() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\n\tTesting Interpolator");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    Interpolator* test_interpolator_ptr = testConstruct_Interpolator();
+    
+    
+    try {
+        int data_key_1D = 1;
+        std::string path_2_data_1D =
+            "data/test/interpolation/diesel_fuel_curve.csv";
+
+        testDataRead1D_Interpolator(test_interpolator_ptr, data_key_1D, path_2_data_1D);
+        testBadIndexing1D_Interpolator(test_interpolator_ptr, -99);
+        testInvalidInterpolation1D_Interpolator(test_interpolator_ptr, data_key_1D);
+        testInterpolation1D_Interpolator(test_interpolator_ptr, data_key_1D);
+
+
+        int data_key_2D = 2;
+        std::string path_2_data_2D =
+            "data/test/interpolation/wave_energy_converter_normalized_performance_matrix.csv";
+
+        testDataRead2D_Interpolator(test_interpolator_ptr, data_key_2D, path_2_data_2D);
+        testInvalidInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
+        testInterpolation2D_Interpolator(test_interpolator_ptr, data_key_2D);
+        
+        testUniformGrid_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testCursor_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testBatch_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testHandle_Interpolator(test_interpolator_ptr, data_key_1D, data_key_2D);
+        testResample_Interpolator(test_interpolator_ptr, path_2_data_1D);
+        testBoundsPolicy_Interpolator(
+            test_interpolator_ptr,
+            path_2_data_1D,
+            path_2_data_2D
+        );
+        testBorrow_Interpolator(
+            test_interpolator_ptr,
+            data_key_1D,
+            path_2_data_1D,
+            path_2_data_2D
+        );
     }
 
 
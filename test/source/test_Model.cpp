@@ -1764,6 +1764,935 @@ void testFuelConsumptionEmissions_Model(Model* test_model_ptr)
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testWriteResults_Model(Model* test_model_ptr)
+///
+/// \brief Function to check that writeResults() produces a results subdirectory for
+///     every contained asset (asset results are written in parallel).
+///
+/// \param test_model_ptr A pointer to the test Model object.
+///
+
+void testWriteResults_Model(Model* test_model_ptr)
+{
+    std::string write_path = "test/test_results/";
+    test_model_ptr->writeResults(write_path);
+    
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "Model/summary_results.md"),
+        __FILE__,
+        __LINE__
+    );
+    
+    std::vector<std::string> subdirectory_vec = {
+        "Production/Combustion/",
+        "Production/Noncombustion/",
+        "Production/Renewable/",
+        "Storage/"
+    };
+    
+    std::vector<size_t> n_assets_vec = {
+        test_model_ptr->combustion_ptr_vec.size(),
+        test_model_ptr->noncombustion_ptr_vec.size(),
+        test_model_ptr->renewable_ptr_vec.size(),
+        test_model_ptr->storage_ptr_vec.size()
+    };
+    
+    for (size_t i = 0; i < subdirectory_vec.size(); i++) {
+        size_t n_asset_directories = 0;
+        
+        for (
+            const auto& entry :
+            std::filesystem::directory_iterator(write_path + subdirectory_vec[i])
+        ) {
+            testTruth(
+                std::filesystem::is_regular_file(
+                    entry.path() / "time_series_results.csv"
+                ),
+                __FILE__,
+                __LINE__
+            );
+            
+            n_asset_directories++;
+        }
+        
+        testFloatEquals(
+            n_asset_directories,
+            n_assets_vec[i],
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    return;
+}   /* testWriteResults_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testWriteResultsIncremental_Model(Model* test_model_ptr)
+///
+/// \brief Function to check that an incremental writeResults() leaves unchanged
+///     results files untouched, and prunes files which are no longer written.
+///
+/// \param test_model_ptr A pointer to the test Model object.
+///
+
+void testWriteResultsIncremental_Model(Model* test_model_ptr)
+{
+    std::string write_path = "test/test_results/";
+    std::string path_2_model_summary = write_path + "Model/summary_results.md";
+    std::string path_2_model_time_series = write_path + "Model/time_series_results.csv";
+    
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "results_manifest.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  1. nothing changed, so nothing re-written
+    std::filesystem::file_time_type write_time =
+        std::filesystem::last_write_time(path_2_model_summary);
+    
+    test_model_ptr->writeResults(write_path, -1, true);
+    
+    testTruth(
+        std::filesystem::last_write_time(path_2_model_summary) == write_time,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. time series no longer written, so pruned
+    test_model_ptr->writeResults(write_path, 0, true);
+    
+    testTruth(
+        not std::filesystem::exists(path_2_model_time_series),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        std::filesystem::is_regular_file(path_2_model_summary),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  3. restore
+    test_model_ptr->writeResults(write_path, -1, true);
+    
+    testTruth(
+        std::filesystem::is_regular_file(path_2_model_time_series),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testWriteResultsIncremental_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testWriteResultsAsync_Model(Model* test_model_ptr)
+///
+/// \brief Function to check that writeResultsAsync() moves results out of the Model
+///     (leaving it reset) and that the background write completes on flush(), into a
+///     fresh directory.
+///
+/// \param test_model_ptr A pointer to the test Model object.
+///
+
+void testWriteResultsAsync_Model(Model* test_model_ptr)
+{
+    //  1. start from a fresh directory, so that only the background write can
+    //     produce results there
+    std::string write_path = "test/test_results/async/";
+    
+    if (std::filesystem::is_directory(write_path)) {
+        std::filesystem::remove_all(write_path);
+    }
+    
+    testTruth(
+        not std::filesystem::exists(write_path),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. write asynchronously
+    double net_present_cost = test_model_ptr->net_present_cost;
+    
+    std::shared_future<void> future =
+        test_model_ptr->writeResultsAsync(write_path);
+    
+    testTruth(test_model_ptr->combustion_ptr_vec.empty(), __FILE__, __LINE__);
+    testTruth(test_model_ptr->noncombustion_ptr_vec.empty(), __FILE__, __LINE__);
+    testTruth(test_model_ptr->renewable_ptr_vec.empty(), __FILE__, __LINE__);
+    testTruth(test_model_ptr->storage_ptr_vec.empty(), __FILE__, __LINE__);
+    
+    testFloatEquals(
+        test_model_ptr->net_present_cost,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    test_model_ptr->flush();
+    
+    testTruth(
+        future.wait_for(std::chrono::seconds(0)) == std::future_status::ready,
+        __FILE__,
+        __LINE__
+    );
+    
+    future.get();
+    
+    //  3. check that the background write produced results
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "Model/summary_results.md"),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "Model/time_series_results.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    testGreaterThan(
+        net_present_cost,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testWriteResultsAsync_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testStreaming_Model(
+///         ModelInputs test_model_inputs,
+///         std::string path_2_solar_resource_data,
+///         std::string path_2_wave_resource_data,
+///         std::string path_2_hydro_resource_data
+///     )
+///
+/// \brief Function to test that a streaming Model (run window by window) reproduces
+///     the totals and economics of an otherwise identical non-streaming Model.
+///
+/// \param test_model_inputs A ModelInputs structure for the Model constructor.
+///
+/// \param path_2_solar_resource_data A path (either relative or absolute) to the solar
+///     resource data.
+///
+/// \param path_2_wave_resource_data A path (either relative or absolute) to the wave
+///     resource data.
+///
+/// \param path_2_hydro_resource_data A path (either relative or absolute) to the hydro
+///     resource data.
+///
+
+void testStreaming_Model(
+    ModelInputs test_model_inputs,
+    std::string path_2_solar_resource_data,
+    std::string path_2_wave_resource_data,
+    std::string path_2_hydro_resource_data
+)
+{
+    //  1. construct full and streaming models
+    int window_points = 1000;
+    
+    Model full_model(test_model_inputs);
+    
+    test_model_inputs.stream_window_points = window_points;
+    Model streaming_model(test_model_inputs);
+    
+    testTruth(streaming_model.electrical_load.is_streaming, __FILE__, __LINE__);
+    testTruth(streaming_model.resources.lazy_loading, __FILE__, __LINE__);
+    
+    testFloatEquals(
+        streaming_model.electrical_load.n_points,
+        window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.electrical_load.n_points_total,
+        full_model.electrical_load.n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.electrical_load.n_years,
+        full_model.electrical_load.n_years,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.electrical_load.max_load_kW,
+        full_model.electrical_load.max_load_kW,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  2. add identical resources and assets
+    Model* model_ptr_array[2] = {&full_model, &streaming_model};
+    
+    for (int i = 0; i < 2; i++) {
+        model_ptr_array[i]->addResource(
+            RenewableType :: SOLAR,
+            path_2_solar_resource_data,
+            0
+        );
+        
+        model_ptr_array[i]->addResource(
+            RenewableType :: WAVE,
+            path_2_wave_resource_data,
+            1
+        );
+        
+        model_ptr_array[i]->addResource(
+            NoncombustionType :: HYDRO,
+            path_2_hydro_resource_data,
+            2
+        );
+        
+        HydroInputs hydro_inputs;
+        hydro_inputs.noncombustion_inputs.production_inputs.capacity_kW = 300;
+        hydro_inputs.reservoir_capacity_m3 = 100000;
+        hydro_inputs.init_reservoir_state = 0.5;
+        hydro_inputs.noncombustion_inputs.production_inputs.is_sunk = true;
+        hydro_inputs.resource_key = 2;
+        
+        model_ptr_array[i]->addHydro(hydro_inputs);
+        
+        DieselInputs diesel_inputs;
+        diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 400;
+        
+        model_ptr_array[i]->addDiesel(diesel_inputs);
+        
+        SolarInputs solar_inputs;
+        solar_inputs.resource_key = 0;
+        
+        model_ptr_array[i]->addSolar(solar_inputs);
+        
+        WaveInputs wave_inputs;
+        wave_inputs.resource_key = 1;
+        
+        model_ptr_array[i]->addWave(wave_inputs);
+        
+        LiIonInputs liion_inputs;
+        
+        model_ptr_array[i]->addLiIon(liion_inputs);
+    }
+    
+    //  3. streaming resources are registered (windowed), not read in full (and an
+    //     unbound resource is never streamed)
+    streaming_model.addResource(RenewableType :: SOLAR, path_2_solar_resource_data, 3);
+    
+    testTruth(
+        streaming_model.resources.resource_map_1D.empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. run both, writing streamed windows to sink
+    std::string sink_path = "test/test_results/Streaming/";
+    
+    if (std::filesystem::is_directory(sink_path)) {
+        std::filesystem::remove_all(sink_path);
+    }
+    
+    streaming_model.stream_sink_path = sink_path;
+    
+    full_model.run();
+    streaming_model.run();
+    
+    //  5. check that memory is bounded by window
+    testTruth(
+        streaming_model.electrical_load.n_points <= window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        (int)streaming_model.electrical_load.load_vec_kW.size() <= window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        (int)streaming_model.combustion_ptr_vec[0]->production_vec_kW.size() <=
+            window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        (int)streaming_model.resources.resource_map_1D[0].size() <= window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        streaming_model.resources.resource_map_1D.count(3) == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        std::filesystem::is_regular_file(sink_path + "window_0/Model/time_series_results.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        std::filesystem::is_regular_file(sink_path + "window_8/Model/time_series_results.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  6. check that streaming reproduces full (non-streaming) results
+    testFloatEquals(
+        streaming_model.total_dispatch_kWh,
+        full_model.total_dispatch_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.total_fuel_consumed_L,
+        full_model.total_fuel_consumed_L,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.total_emissions.CO2_kg,
+        full_model.total_emissions.CO2_kg,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.net_present_cost,
+        full_model.net_present_cost,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.levellized_cost_of_energy_kWh,
+        full_model.levellized_cost_of_energy_kWh,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.renewable_penetration,
+        full_model.renewable_penetration,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  7. running again without reset() is an error
+    bool error_flag = true;
+    
+    try {
+        streaming_model.run();
+        error_flag = false;
+    } catch (...) {
+        // Task failed successfully! =P
+    }
+    
+    if (not error_flag) {
+        expectedErrorNotDetected(__FILE__, __LINE__);
+    }
+    
+    //  8. reset() rewinds the stream
+    streaming_model.reset();
+    
+    testFloatEquals(
+        streaming_model.electrical_load.window_start,
+        0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testFloatEquals(
+        streaming_model.electrical_load.n_points,
+        window_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testStreaming_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testFastKernels_Model(
+///         ModelInputs test_model_inputs,
+///         std::string path_2_tidal_resource_data,
+///         std::string path_2_wave_resource_data,
+///         std::string path_2_wind_resource_data
+///     )
+///
+/// \brief Function to test that a Model in fast kernels mode reproduces the summary
+///     outputs of an otherwise identical (exact) Model. Asset production and
+///     degradation agree to within the kernel error, whereas dispatch level outputs
+///     may differ more, since dispatch decisions are discrete (see bench_FastMath.cpp).
+///
+/// \param test_model_inputs A ModelInputs structure for the Model constructor.
+///
+/// \param path_2_tidal_resource_data A path (either relative or absolute) to the tidal
+///     resource data.
+///
+/// \param path_2_wave_resource_data A path (either relative or absolute) to the wave
+///     resource data.
+///
+/// \param path_2_wind_resource_data A path (either relative or absolute) to the wind
+///     resource data.
+///
+
+void testFastKernels_Model(
+    ModelInputs test_model_inputs,
+    std::string path_2_tidal_resource_data,
+    std::string path_2_wave_resource_data,
+    std::string path_2_wind_resource_data
+)
+{
+    //  1. construct exact and fast models
+    Model exact_model(test_model_inputs);
+    
+    test_model_inputs.fast_kernels = true;
+    Model fast_model(test_model_inputs);
+    
+    testTruth(not exact_model.fast_kernels, __FILE__, __LINE__);
+    testTruth(fast_model.fast_kernels, __FILE__, __LINE__);
+    
+    //  2. add identical resources and assets (using every accelerated model)
+    Model* model_ptr_array[2] = {&exact_model, &fast_model};
+    
+    for (int i = 0; i < 2; i++) {
+        model_ptr_array[i]->addResource(
+            RenewableType :: TIDAL,
+            path_2_tidal_resource_data,
+            0
+        );
+        
+        model_ptr_array[i]->addResource(
+            RenewableType :: WAVE,
+            path_2_wave_resource_data,
+            1
+        );
+        
+        model_ptr_array[i]->addResource(
+            RenewableType :: WIND,
+            path_2_wind_resource_data,
+            2
+        );
+        
+        DieselInputs diesel_inputs;
+        diesel_inputs.combustion_inputs.production_inputs.capacity_kW = 400;
+        
+        model_ptr_array[i]->addDiesel(diesel_inputs);
+        
+        TidalInputs tidal_inputs;
+        tidal_inputs.resource_key = 0;
+        tidal_inputs.power_model = TidalPowerProductionModel :: TIDAL_POWER_EXPONENTIAL;
+        
+        model_ptr_array[i]->addTidal(tidal_inputs);
+        
+        WaveInputs wave_inputs;
+        wave_inputs.resource_key = 1;
+        wave_inputs.power_model = WavePowerProductionModel :: WAVE_POWER_GAUSSIAN;
+        
+        model_ptr_array[i]->addWave(wave_inputs);
+        
+        WindInputs wind_inputs;
+        wind_inputs.resource_key = 2;
+        wind_inputs.power_model = WindPowerProductionModel :: WIND_POWER_EXPONENTIAL;
+        
+        model_ptr_array[i]->addWind(wind_inputs);
+        
+        LiIonInputs liion_inputs;
+        
+        model_ptr_array[i]->addLiIon(liion_inputs);
+    }
+    
+    testTruth(fast_model.combustion_ptr_vec[0]->fast_kernels, __FILE__, __LINE__);
+    testTruth(fast_model.renewable_ptr_vec[0]->fast_kernels, __FILE__, __LINE__);
+    testTruth(fast_model.storage_ptr_vec[0]->fast_kernels, __FILE__, __LINE__);
+    testTruth(not exact_model.storage_ptr_vec[0]->fast_kernels, __FILE__, __LINE__);
+    
+    //  3. run both
+    exact_model.run();
+    fast_model.run();
+    
+    //  4. check asset production and degradation (kernel error)
+    for (size_t i = 0; i < exact_model.renewable_ptr_vec.size(); i++) {
+        testLessThanOrEqualTo(
+            fabs(
+                fast_model.renewable_ptr_vec[i]->total_production_kWh /
+                exact_model.renewable_ptr_vec[i]->total_production_kWh - 1
+            ),
+            1e-6,
+            __FILE__,
+            __LINE__
+        );
+    }
+    
+    testFloatEquals(
+        ((LiIon*)(fast_model.storage_ptr_vec[0]))->SOH,
+        ((LiIon*)(exact_model.storage_ptr_vec[0]))->SOH,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  5. check Model summary outputs (dispatch level)
+    testLessThanOrEqualTo(
+        fabs(fast_model.net_present_cost / exact_model.net_present_cost - 1),
+        1e-3,
+        __FILE__,
+        __LINE__
+    );
+    
+    testLessThanOrEqualTo(
+        fabs(
+            fast_model.levellized_cost_of_energy_kWh /
+            exact_model.levellized_cost_of_energy_kWh - 1
+        ),
+        1e-3,
+        __FILE__,
+        __LINE__
+    );
+    
+    testLessThanOrEqualTo(
+        fabs(fast_model.total_fuel_consumed_L / exact_model.total_fuel_consumed_L - 1),
+        1e-3,
+        __FILE__,
+        __LINE__
+    );
+    
+    testLessThanOrEqualTo(
+        fabs(fast_model.total_dispatch_kWh / exact_model.total_dispatch_kWh - 1),
+        1e-6,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testFastKernels_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSharedNormalizedResponse_Model(
+///         ModelInputs test_model_inputs,
+///         std::string path_2_tidal_resource_data,
+///         std::string path_2_wave_resource_data,
+///         std::string path_2_wind_resource_data
+///     )
+///
+/// \brief Function to test that Renewable assets which differ only in size share a
+///     normalized response (and so have their normalized production evaluated once
+///     by the Controller), and that this gives exactly the same production as
+///     evaluating every asset on its own.
+///
+/// \param test_model_inputs A ModelInputs structure for the Model constructor.
+///
+/// \param path_2_tidal_resource_data A path (either relative or absolute) to the tidal
+///     resource data.
+///
+/// \param path_2_wave_resource_data A path (either relative or absolute) to the wave
+///     resource data.
+///
+/// \param path_2_wind_resource_data A path (either relative or absolute) to the wind
+///     resource data.
+///
+
+void testSharedNormalizedResponse_Model(
+    ModelInputs test_model_inputs,
+    std::string path_2_tidal_resource_data,
+    std::string path_2_wave_resource_data,
+    std::string path_2_wind_resource_data
+)
+{
+    //  1. construct Model, add resources
+    Model test_model(test_model_inputs);
+    
+    test_model.addResource(RenewableType :: TIDAL, path_2_tidal_resource_data, 0);
+    test_model.addResource(RenewableType :: WAVE, path_2_wave_resource_data, 1);
+    test_model.addResource(RenewableType :: WIND, path_2_wind_resource_data, 2);
+    
+    DieselInputs diesel_inputs;
+    test_model.addDiesel(diesel_inputs);
+    
+    //  2. add assets which differ only in size (and one which differs in response)
+    TidalInputs tidal_inputs;
+    tidal_inputs.resource_key = 0;
+    
+    tidal_inputs.renewable_inputs.production_inputs.capacity_kW = 100;
+    test_model.addTidal(tidal_inputs);
+    
+    tidal_inputs.renewable_inputs.production_inputs.capacity_kW = 350;
+    test_model.addTidal(tidal_inputs);
+    
+    WaveInputs wave_inputs;
+    wave_inputs.resource_key = 1;
+    wave_inputs.power_model = WavePowerProductionModel :: WAVE_POWER_GAUSSIAN;
+    
+    wave_inputs.renewable_inputs.production_inputs.capacity_kW = 100;
+    test_model.addWave(wave_inputs);
+    
+    wave_inputs.renewable_inputs.production_inputs.capacity_kW = 275;
+    test_model.addWave(wave_inputs);
+    
+    wave_inputs.power_model = WavePowerProductionModel :: WAVE_POWER_PARABOLOID;
+    test_model.addWave(wave_inputs);
+    
+    WindInputs wind_inputs;
+    wind_inputs.resource_key = 2;
+    
+    wind_inputs.renewable_inputs.production_inputs.capacity_kW = 100;
+    test_model.addWind(wind_inputs);
+    
+    wind_inputs.renewable_inputs.production_inputs.capacity_kW = 600;
+    wind_inputs.n_turbines = 3;
+    wind_inputs.turbine_factor_vec = {1, 0.9, 0.8};
+    test_model.addWind(wind_inputs);
+    
+    //  3. check normalized response keys
+    std::vector<Renewable*>* renewable_ptr_vec_ptr = &(test_model.renewable_ptr_vec);
+    
+    testTruth(
+        not renewable_ptr_vec_ptr->at(0)->getNormalizedResponseKey().empty(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        renewable_ptr_vec_ptr->at(0)->getNormalizedResponseKey() ==
+        renewable_ptr_vec_ptr->at(1)->getNormalizedResponseKey(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        renewable_ptr_vec_ptr->at(2)->getNormalizedResponseKey() ==
+        renewable_ptr_vec_ptr->at(3)->getNormalizedResponseKey(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        renewable_ptr_vec_ptr->at(3)->getNormalizedResponseKey() !=
+        renewable_ptr_vec_ptr->at(4)->getNormalizedResponseKey(),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        renewable_ptr_vec_ptr->at(5)->getNormalizedResponseKey() ==
+        renewable_ptr_vec_ptr->at(6)->getNormalizedResponseKey(),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  4. run, then check that shared production is exactly the production of
+    //     each asset evaluated on its own
+    test_model.run();
+    
+    for (size_t i = 0; i < renewable_ptr_vec_ptr->size(); i++) {
+        Renewable* renewable_ptr = renewable_ptr_vec_ptr->at(i);
+        
+        for (int j = 0; j < test_model.electrical_load.n_points; j++) {
+            double dt_hrs = test_model.electrical_load.dt_vec_hrs[j];
+            double production_kW = 0;
+            
+            if (renewable_ptr->type == RenewableType :: WAVE) {
+                production_kW = renewable_ptr->computeProductionkW(
+                    j,
+                    dt_hrs,
+                    test_model.resources.resource_map_2D[1][j][0],
+                    test_model.resources.resource_map_2D[1][j][1]
+                );
+            }
+            
+            else {
+                production_kW = renewable_ptr->computeProductionkW(
+                    j,
+                    dt_hrs,
+                    test_model.resources.resource_map_1D[
+                        renewable_ptr->resource_key
+                    ][j]
+                );
+            }
+            
+            testTruth(
+                renewable_ptr->production_vec_kW[j] == production_kW,
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    testFloatEquals(
+        renewable_ptr_vec_ptr->at(1)->total_production_kWh /
+            renewable_ptr_vec_ptr->at(0)->total_production_kWh,
+        3.5,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testSharedNormalizedResponse_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testSeriesProduction_Model(
+///         ModelInputs test_model_inputs,
+///         std::string path_2_solar_resource_data,
+///         std::string path_2_tidal_resource_data,
+///         std::string path_2_wave_resource_data
+///     )
+///
+/// \brief Function to test that the production series computed by the Controller
+///     (see Renewable::computeProductionSeries()) is exactly the production given by
+///     Renewable::computeProductionkW() at each timestep, for solar (both power
+///     production models), tidal, and wave assets.
+///
+/// \param test_model_inputs A ModelInputs structure for the Model constructor.
+///
+/// \param path_2_solar_resource_data A path (either relative or absolute) to the solar
+///     resource data.
+///
+/// \param path_2_tidal_resource_data A path (either relative or absolute) to the tidal
+///     resource data.
+///
+/// \param path_2_wave_resource_data A path (either relative or absolute) to the wave
+///     resource data.
+///
+
+void testSeriesProduction_Model(
+    ModelInputs test_model_inputs,
+    std::string path_2_solar_resource_data,
+    std::string path_2_tidal_resource_data,
+    std::string path_2_wave_resource_data
+)
+{
+    //  1. construct Model, add resources
+    Model test_model(test_model_inputs);
+    
+    test_model.addResource(RenewableType :: SOLAR, path_2_solar_resource_data, 0);
+    test_model.addResource(RenewableType :: TIDAL, path_2_tidal_resource_data, 1);
+    test_model.addResource(RenewableType :: WAVE, path_2_wave_resource_data, 2);
+    
+    DieselInputs diesel_inputs;
+    test_model.addDiesel(diesel_inputs);
+    
+    //  2. add assets
+    SolarInputs solar_inputs;
+    solar_inputs.resource_key = 0;
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_SIMPLE;
+    test_model.addSolar(solar_inputs);
+    
+    solar_inputs.power_model = SolarPowerProductionModel :: SOLAR_POWER_DETAILED;
+    test_model.addSolar(solar_inputs);
+    
+    TidalInputs tidal_inputs;
+    tidal_inputs.resource_key = 1;
+    test_model.addTidal(tidal_inputs);
+    
+    WaveInputs wave_inputs;
+    wave_inputs.resource_key = 2;
+    test_model.addWave(wave_inputs);
+    
+    //  3. run, then check that series production is exactly the production at each
+    //     timestep
+    test_model.run();
+    
+    std::vector<Renewable*>* renewable_ptr_vec_ptr = &(test_model.renewable_ptr_vec);
+    
+    testFloatEquals(renewable_ptr_vec_ptr->size(), 4, __FILE__, __LINE__);
+    
+    for (size_t i = 0; i < renewable_ptr_vec_ptr->size(); i++) {
+        Renewable* renewable_ptr = renewable_ptr_vec_ptr->at(i);
+        
+        testGreaterThan(renewable_ptr->total_production_kWh, 0, __FILE__, __LINE__);
+        
+        for (int j = 0; j < test_model.electrical_load.n_points; j++) {
+            double dt_hrs = test_model.electrical_load.dt_vec_hrs[j];
+            double production_kW = 0;
+            
+            if (renewable_ptr->type == RenewableType :: WAVE) {
+                production_kW = renewable_ptr->computeProductionkW(
+                    j,
+                    dt_hrs,
+                    test_model.resources.resource_map_2D[2][j][0],
+                    test_model.resources.resource_map_2D[2][j][1]
+                );
+            }
+            
+            else {
+                production_kW = renewable_ptr->computeProductionkW(
+                    j,
+                    dt_hrs,
+                    test_model.resources.resource_map_1D[
+                        renewable_ptr->resource_key
+                    ][j]
+                );
+            }
+            
+            testTruth(
+                renewable_ptr->production_vec_kW[j] == production_kW,
+                __FILE__,
+                __LINE__
+            );
+        }
+    }
+    
+    return;
+}   /* testSeriesProduction_Model() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -1887,7 +2816,37 @@ int main(int argc, char** argv)
         testEconomics_Model(test_model_ptr);
         testFuelConsumptionEmissions_Model(test_model_ptr);
         
-        test_model_ptr->writeResults("test/test_results/");
+        testWriteResults_Model(test_model_ptr);
+        testWriteResultsIncremental_Model(test_model_ptr);
+        testWriteResultsAsync_Model(test_model_ptr);
+        
+        testStreaming_Model(
+            test_model_inputs,
+            path_2_solar_resource_data,
+            path_2_wave_resource_data,
+            path_2_hydro_resource_data
+        );
+        
+        testFastKernels_Model(
+            test_model_inputs,
+            path_2_tidal_resource_data,
+            path_2_wave_resource_data,
+            path_2_wind_resource_data
+        );
+        
+        testSharedNormalizedResponse_Model(
+            test_model_inputs,
+            path_2_tidal_resource_data,
+            path_2_wave_resource_data,
+            path_2_wind_resource_data
+        );
+        
+        testSeriesProduction_Model(
+            test_model_inputs,
+            path_2_solar_resource_data,
+            path_2_tidal_resource_data,
+            path_2_wave_resource_data
+        );
     }
 
 
@@ -777,6 +777,80 @@ void testAddHydroResource_Resources(
 
 
 
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testLazyLoading_Resources(
+///         ElectricalLoad* test_electrical_load_ptr,
+///         std::string path_2_solar_resource_data
+///     )
+///
+/// \brief Function to test that a lazily loading Resources object registers resources
+///     on addResource() and only reads them on loadResource1D().
+///
+/// \param test_electrical_load_ptr A pointer to the test ElectricalLoad object.
+///
+/// \param path_2_solar_resource_data A path (either relative or absolute) to the solar
+///     resource data.
+///
+
+void testLazyLoading_Resources(
+    ElectricalLoad* test_electrical_load_ptr,
+    std::string path_2_solar_resource_data
+)
+{
+    Resources lazy_resources;
+    lazy_resources.lazy_loading = true;
+    
+    int resource_key = 0;
+    
+    lazy_resources.addResource(
+        RenewableType::SOLAR,
+        path_2_solar_resource_data,
+        resource_key,
+        test_electrical_load_ptr
+    );
+    
+    testTruth(
+        lazy_resources.resource_map_1D.count(resource_key) == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        lazy_resources.registration_map_1D.count(resource_key) == 1,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        lazy_resources.path_map_1D[resource_key] == path_2_solar_resource_data,
+        __FILE__,
+        __LINE__
+    );
+    
+    lazy_resources.loadResource1D(resource_key, test_electrical_load_ptr);
+    
+    testFloatEquals(
+        lazy_resources.resource_map_1D[resource_key].size(),
+        test_electrical_load_ptr->n_points,
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        lazy_resources.registration_map_1D.count(resource_key) == 0,
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testLazyLoading_Resources() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
 // ---------------------------------------------------------------------------------- //
 
 int main(int argc, char** argv)
@@ -869,6 +943,12 @@ int main(int argc, char** argv)
             path_2_hydro_resource_data,
             hydro_resource_key
         );
+        
+        
+        testLazyLoading_Resources(
+            test_electrical_load_ptr,
+            path_2_solar_resource_data
+        );
     }
 
 
@@ -0,0 +1,265 @@
+/*
+ * PGMcpp : PRIMED Grid Modelling (in C++)
+ * Copyright 2023 (C)
+ * 
+ * Anthony Truelove MASc, P.Eng.
+ * email:  gears1763@tutanota.com
+ * github: gears1763-2
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ * 
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ * 
+ *  CONTINUED USE OF THIS SOFTWARE CONSTITUTES ACCEPTANCE OF THESE TERMS.
+ *
+ */
+
+
+
+
+///
+/// \file test_ResultsManifest.cpp
+///
+/// \brief Testing suite for ResultsManifest class.
+///
+/// A suite of tests for the ResultsManifest class.
+///
+
+
+#include "../utils/testing_utils.h"
+#include "../../header/ResultsManifest.h"
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testComputeHash_ResultsManifest(void)
+///
+/// \brief A function to check the content hash against known FNV-1a (64-bit) values.
+///
+
+void testComputeHash_ResultsManifest(void)
+{
+    ResultsManifest test_results_manifest;
+    
+    testTruth(
+        test_results_manifest.computeHash("") == "cbf29ce484222325",
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_results_manifest.computeHash("a") == "af63dc4c8601ec8c",
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_results_manifest.computeHash("foobar") == "85944171f73967e8",
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testComputeHash_ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testFirstWrite_ResultsManifest(std::string write_path)
+///
+/// \brief A function to check that every file is written (and recorded) when no
+///     manifest pre-exists.
+///
+/// \param write_path A path (either relative or absolute) to the test results directory.
+///
+
+void testFirstWrite_ResultsManifest(std::string write_path)
+{
+    ResultsManifest test_results_manifest(write_path);
+    
+    testTruth(test_results_manifest.previous_hash_map.empty(), __FILE__, __LINE__);
+    
+    std::filesystem::create_directory(write_path + "asset_0/");
+    std::filesystem::create_directory(write_path + "asset_1/");
+    
+    testTruth(
+        test_results_manifest.writeFile(write_path + "asset_0/results.csv", "0,1,2\n"),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        test_results_manifest.writeFile(write_path + "asset_1/results.csv", "3,4,5\n"),
+        __FILE__,
+        __LINE__
+    );
+    
+    test_results_manifest.prune();
+    test_results_manifest.writeManifest();
+    
+    testFloatEquals(test_results_manifest.n_files_written, 2, __FILE__, __LINE__);
+    testFloatEquals(test_results_manifest.n_files_skipped, 0, __FILE__, __LINE__);
+    testFloatEquals(test_results_manifest.n_files_pruned, 0, __FILE__, __LINE__);
+    
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "results_manifest.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testFirstWrite_ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+///
+/// \fn void testIncrementalWrite_ResultsManifest(std::string write_path)
+///
+/// \brief A function to check that unchanged files are skipped, changed files are
+///     re-written, and stale files (and their emptied directories) are pruned.
+///
+/// \param write_path A path (either relative or absolute) to the test results directory.
+///
+
+void testIncrementalWrite_ResultsManifest(std::string write_path)
+{
+    ResultsManifest test_results_manifest(write_path);
+    
+    testFloatEquals(
+        test_results_manifest.previous_hash_map.size(),
+        2,
+        __FILE__,
+        __LINE__
+    );
+    
+    //  unchanged (skipped)
+    testTruth(
+        not test_results_manifest.writeFile(
+            write_path + "asset_0/results.csv",
+            "0,1,2\n"
+        ),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  new (written), asset_1 no longer written (pruned)
+    std::filesystem::create_directory(write_path + "asset_2/");
+    
+    testTruth(
+        test_results_manifest.writeFile(write_path + "asset_2/results.csv", "6,7,8\n"),
+        __FILE__,
+        __LINE__
+    );
+    
+    test_results_manifest.prune();
+    test_results_manifest.writeManifest();
+    
+    testFloatEquals(test_results_manifest.n_files_written, 1, __FILE__, __LINE__);
+    testFloatEquals(test_results_manifest.n_files_skipped, 1, __FILE__, __LINE__);
+    testFloatEquals(test_results_manifest.n_files_pruned, 1, __FILE__, __LINE__);
+    
+    testTruth(
+        std::filesystem::is_regular_file(write_path + "asset_0/results.csv"),
+        __FILE__,
+        __LINE__
+    );
+    
+    testTruth(
+        not std::filesystem::exists(write_path + "asset_1/"),
+        __FILE__,
+        __LINE__
+    );
+    
+    //  changed (re-written)
+    ResultsManifest test_results_manifest_changed(write_path);
+    
+    testTruth(
+        test_results_manifest_changed.writeFile(
+            write_path + "asset_0/results.csv",
+            "0,1,3\n"
+        ),
+        __FILE__,
+        __LINE__
+    );
+    
+    return;
+}   /* testIncrementalWrite_ResultsManifest() */
+
+// ---------------------------------------------------------------------------------- //
+
+
+
+// ---------------------------------------------------------------------------------- //
+
+int main(int argc, char** argv)
+{
+    #ifdef _WIN32
+        activateVirtualTerminal();
+    #endif  /* _WIN32 */
+    
+    printGold("\tTesting ResultsManifest");
+    
+    #ifdef _WIN32
+        std::cout << std::endl;
+    #endif
+    
+    srand(time(NULL));
+    
+    
+    std::string write_path = "test/test_results/ResultsManifest/";
+    
+    std::filesystem::remove_all(write_path);
+    std::filesystem::create_directories(write_path);
+    
+    
+    try {
+        testComputeHash_ResultsManifest();
+        testFirstWrite_ResultsManifest(write_path);
+        testIncrementalWrite_ResultsManifest(write_path);
+    }
+
+
+    catch (...) {
+        printGold(" .......................... ");
+        printRed("FAIL");
+        std::cout << std::endl;
+        throw;
+    }
+
+
+    printGold(" .......................... ");
+    printGreen("PASS");
+    std::cout << std::endl;
+    return 0;
+}   /* main() */
+
+// ---------------------------------------------------------------------------------- //